@@ -1,7 +1,12 @@
 #include <stdio.h>
 #include <string.h>
 #include <inttypes.h>
+#include <algorithm>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 
 #include <binaryninjaapi.h>
@@ -13,6 +18,9 @@
 using namespace BinaryNinja; // for ::LogDebug, etc.
 
 #include "disassembler.h"
+#include "vle.h"
+#include "prologue.h"
+#include "syscalls.h"
 #include "assembler.h"
 
 #include "il.h"
@@ -146,6 +154,74 @@ enum ElfPpcRelocationType
 	MAX_ELF_PPC_RELOCATION
 };
 
+/* ppc64 relocations that have no 32-bit counterpart, or that reuse a number
+   the 32-bit ABI assigns to something else */
+enum ElfPpc64RelocationType
+{
+	R_PPC64_ADDR30             = 37,  // word30   (S + A - P) >> 2
+	R_PPC64_ADDR64             = 38,  // doubleword64 S + A
+	R_PPC64_ADDR16_HIGHER      = 39,  // half16   #higher(S + A)
+	R_PPC64_ADDR16_HIGHERA     = 40,  // half16   #highera(S + A)
+	R_PPC64_ADDR16_HIGHEST     = 41,  // half16   #highest(S + A)
+	R_PPC64_ADDR16_HIGHESTA    = 42,  // half16   #highesta(S + A)
+	R_PPC64_UADDR64            = 43,  // doubleword64 S + A
+	R_PPC64_REL64              = 44,  // doubleword64 S + A - P
+	R_PPC64_PLT64              = 45,  // doubleword64 L + A
+	R_PPC64_PLTREL64           = 46,  // doubleword64 L + A - P
+	R_PPC64_TOC16              = 47,  // half16*  S + A - .TOC.
+	R_PPC64_TOC16_LO           = 48,  // half16   #lo(S + A - .TOC.)
+	R_PPC64_TOC16_HI           = 49,  // half16   #hi(S + A - .TOC.)
+	R_PPC64_TOC16_HA           = 50,  // half16   #ha(S + A - .TOC.)
+	R_PPC64_TOC                = 51,  // doubleword64 .TOC.
+	R_PPC64_PLTGOT16           = 52,
+	R_PPC64_PLTGOT16_LO        = 53,
+	R_PPC64_PLTGOT16_HI        = 54,
+	R_PPC64_PLTGOT16_HA        = 55,
+	R_PPC64_ADDR16_DS          = 56,  // half16ds* (S + A) >> 2
+	R_PPC64_ADDR16_LO_DS       = 57,
+	R_PPC64_GOT16_DS           = 58,
+	R_PPC64_GOT16_LO_DS        = 59,
+	R_PPC64_PLT16_LO_DS        = 60,
+	R_PPC64_SECTOFF_DS         = 61,
+	R_PPC64_SECTOFF_LO_DS      = 62,
+	R_PPC64_TOC16_DS           = 63,
+	R_PPC64_TOC16_LO_DS        = 64,
+	R_PPC64_PLTGOT16_DS        = 65,
+	R_PPC64_PLTGOT16_LO_DS     = 66,
+	R_PPC64_DTPMOD64           = 68,
+	R_PPC64_TPREL64            = 73,
+	R_PPC64_DTPREL64           = 78,
+	R_PPC64_GOT_TPREL16_DS     = 87,
+	R_PPC64_GOT_TPREL16_LO_DS  = 88,
+	R_PPC64_GOT_DTPREL16_DS    = 91,
+	R_PPC64_GOT_DTPREL16_LO_DS = 92,
+	R_PPC64_TPREL16_DS         = 95,
+	R_PPC64_TPREL16_LO_DS      = 96,
+	R_PPC64_TPREL16_HIGHER     = 97,
+	R_PPC64_TPREL16_HIGHERA    = 98,
+	R_PPC64_TPREL16_HIGHEST    = 99,
+	R_PPC64_TPREL16_HIGHESTA   = 100,
+	R_PPC64_DTPREL16_DS        = 101,
+	R_PPC64_DTPREL16_LO_DS     = 102,
+	R_PPC64_DTPREL16_HIGHER    = 103,
+	R_PPC64_DTPREL16_HIGHERA   = 104,
+	R_PPC64_DTPREL16_HIGHEST   = 105,
+	R_PPC64_DTPREL16_HIGHESTA  = 106,
+	R_PPC64_TLSGD              = 107, // none, marks a __tls_get_addr call
+	R_PPC64_TLSLD              = 108,
+	R_PPC64_TOCSAVE            = 109, // none, marks a nop that may become std r2
+	R_PPC64_ADDR16_HIGH        = 110,
+	R_PPC64_ADDR16_HIGHA       = 111,
+	R_PPC64_TPREL16_HIGH       = 112,
+	R_PPC64_TPREL16_HIGHA      = 113,
+	R_PPC64_DTPREL16_HIGH      = 114,
+	R_PPC64_DTPREL16_HIGHA     = 115,
+	R_PPC64_REL24_NOTOC        = 116,
+	R_PPC64_ADDR64_LOCAL       = 117,
+	R_PPC64_ENTRY              = 118, // none, marks a global entry point
+	R_PPC64_JMP_IREL           = 247
+};
+
 static const char* GetRelocationString(MachoPpcRelocationType relocType)
 {
 	static const char* relocTable[] =
@@ -276,11 +352,169 @@ static const char* GetRelocationString(ElfPpcRelocationType relocType)
 	return "Unknown PPC relocation";
 }
 
+static const char* GetRelocationString(ElfPpc64RelocationType relocType)
+{
+	static map<ElfPpc64RelocationType, const char*> relocTable = {
+		{R_PPC64_ADDR30, "R_PPC64_ADDR30"},
+		{R_PPC64_ADDR64, "R_PPC64_ADDR64"},
+		{R_PPC64_ADDR16_HIGHER, "R_PPC64_ADDR16_HIGHER"},
+		{R_PPC64_ADDR16_HIGHERA, "R_PPC64_ADDR16_HIGHERA"},
+		{R_PPC64_ADDR16_HIGHEST, "R_PPC64_ADDR16_HIGHEST"},
+		{R_PPC64_ADDR16_HIGHESTA, "R_PPC64_ADDR16_HIGHESTA"},
+		{R_PPC64_UADDR64, "R_PPC64_UADDR64"},
+		{R_PPC64_REL64, "R_PPC64_REL64"},
+		{R_PPC64_PLT64, "R_PPC64_PLT64"},
+		{R_PPC64_PLTREL64, "R_PPC64_PLTREL64"},
+		{R_PPC64_TOC16, "R_PPC64_TOC16"},
+		{R_PPC64_TOC16_LO, "R_PPC64_TOC16_LO"},
+		{R_PPC64_TOC16_HI, "R_PPC64_TOC16_HI"},
+		{R_PPC64_TOC16_HA, "R_PPC64_TOC16_HA"},
+		{R_PPC64_TOC, "R_PPC64_TOC"},
+		{R_PPC64_PLTGOT16, "R_PPC64_PLTGOT16"},
+		{R_PPC64_PLTGOT16_LO, "R_PPC64_PLTGOT16_LO"},
+		{R_PPC64_PLTGOT16_HI, "R_PPC64_PLTGOT16_HI"},
+		{R_PPC64_PLTGOT16_HA, "R_PPC64_PLTGOT16_HA"},
+		{R_PPC64_ADDR16_DS, "R_PPC64_ADDR16_DS"},
+		{R_PPC64_ADDR16_LO_DS, "R_PPC64_ADDR16_LO_DS"},
+		{R_PPC64_GOT16_DS, "R_PPC64_GOT16_DS"},
+		{R_PPC64_GOT16_LO_DS, "R_PPC64_GOT16_LO_DS"},
+		{R_PPC64_PLT16_LO_DS, "R_PPC64_PLT16_LO_DS"},
+		{R_PPC64_SECTOFF_DS, "R_PPC64_SECTOFF_DS"},
+		{R_PPC64_SECTOFF_LO_DS, "R_PPC64_SECTOFF_LO_DS"},
+		{R_PPC64_TOC16_DS, "R_PPC64_TOC16_DS"},
+		{R_PPC64_TOC16_LO_DS, "R_PPC64_TOC16_LO_DS"},
+		{R_PPC64_PLTGOT16_DS, "R_PPC64_PLTGOT16_DS"},
+		{R_PPC64_PLTGOT16_LO_DS, "R_PPC64_PLTGOT16_LO_DS"},
+		{R_PPC64_DTPMOD64, "R_PPC64_DTPMOD64"},
+		{R_PPC64_TPREL64, "R_PPC64_TPREL64"},
+		{R_PPC64_DTPREL64, "R_PPC64_DTPREL64"},
+		{R_PPC64_GOT_TPREL16_DS, "R_PPC64_GOT_TPREL16_DS"},
+		{R_PPC64_GOT_TPREL16_LO_DS, "R_PPC64_GOT_TPREL16_LO_DS"},
+		{R_PPC64_GOT_DTPREL16_DS, "R_PPC64_GOT_DTPREL16_DS"},
+		{R_PPC64_GOT_DTPREL16_LO_DS, "R_PPC64_GOT_DTPREL16_LO_DS"},
+		{R_PPC64_TPREL16_DS, "R_PPC64_TPREL16_DS"},
+		{R_PPC64_TPREL16_LO_DS, "R_PPC64_TPREL16_LO_DS"},
+		{R_PPC64_TPREL16_HIGHER, "R_PPC64_TPREL16_HIGHER"},
+		{R_PPC64_TPREL16_HIGHERA, "R_PPC64_TPREL16_HIGHERA"},
+		{R_PPC64_TPREL16_HIGHEST, "R_PPC64_TPREL16_HIGHEST"},
+		{R_PPC64_TPREL16_HIGHESTA, "R_PPC64_TPREL16_HIGHESTA"},
+		{R_PPC64_DTPREL16_DS, "R_PPC64_DTPREL16_DS"},
+		{R_PPC64_DTPREL16_LO_DS, "R_PPC64_DTPREL16_LO_DS"},
+		{R_PPC64_DTPREL16_HIGHER, "R_PPC64_DTPREL16_HIGHER"},
+		{R_PPC64_DTPREL16_HIGHERA, "R_PPC64_DTPREL16_HIGHERA"},
+		{R_PPC64_DTPREL16_HIGHEST, "R_PPC64_DTPREL16_HIGHEST"},
+		{R_PPC64_DTPREL16_HIGHESTA, "R_PPC64_DTPREL16_HIGHESTA"},
+		{R_PPC64_TLSGD, "R_PPC64_TLSGD"},
+		{R_PPC64_TLSLD, "R_PPC64_TLSLD"},
+		{R_PPC64_TOCSAVE, "R_PPC64_TOCSAVE"},
+		{R_PPC64_ADDR16_HIGH, "R_PPC64_ADDR16_HIGH"},
+		{R_PPC64_ADDR16_HIGHA, "R_PPC64_ADDR16_HIGHA"},
+		{R_PPC64_TPREL16_HIGH, "R_PPC64_TPREL16_HIGH"},
+		{R_PPC64_TPREL16_HIGHA, "R_PPC64_TPREL16_HIGHA"},
+		{R_PPC64_DTPREL16_HIGH, "R_PPC64_DTPREL16_HIGH"},
+		{R_PPC64_DTPREL16_HIGHA, "R_PPC64_DTPREL16_HIGHA"},
+		{R_PPC64_REL24_NOTOC, "R_PPC64_REL24_NOTOC"},
+		{R_PPC64_ADDR64_LOCAL, "R_PPC64_ADDR64_LOCAL"},
+		{R_PPC64_ENTRY, "R_PPC64_ENTRY"},
+		{R_PPC64_JMP_IREL, "R_PPC64_JMP_IREL"}
+	};
+	if (relocTable.count(relocType))
+		return relocTable.at(relocType);
+	/* everything else keeps its 32-bit meaning */
+	return GetRelocationString((ElfPpcRelocationType)relocType);
+}
+
+/* Per view state shared by the recognizers, calling conventions and
+	relocation handlers. Entries are dropped when the view is finalized, so
+	a later view allocated at the same address never sees them. Callers
+	build a missing entry outside the lock and Insert() it; if two threads
+	race, the first entry stored wins and both get it back. */
+class PpcViewCacheBase
+{
+	static std::mutex& RegistryMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	static vector<PpcViewCacheBase*>& Registry()
+	{
+		static vector<PpcViewCacheBase*> caches;
+		return caches;
+	}
+
+	protected:
+	PpcViewCacheBase()
+	{
+		std::lock_guard<std::mutex> lock(RegistryMutex());
+		Registry().push_back(this);
+	}
+
+	public:
+	virtual ~PpcViewCacheBase() {}
+	virtual void Evict(BinaryView* view) = 0;
+
+	static void EvictAll(BinaryView* view)
+	{
+		std::lock_guard<std::mutex> lock(RegistryMutex());
+		for (PpcViewCacheBase* cache : Registry())
+			cache->Evict(view);
+	}
+};
+
+template <typename T>
+class PpcViewCache: public PpcViewCacheBase
+{
+	std::mutex mutex, buildMutex;
+	map<BNBinaryView*, shared_ptr<T>> entries; /* keyed on the core view, wrappers come and go */
+
+	public:
+	shared_ptr<T> Find(BinaryView* view)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = entries.find(view->GetObject());
+		return (it == entries.end()) ? nullptr : it->second;
+	}
+
+	shared_ptr<T> Insert(BinaryView* view, shared_ptr<T> value)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return entries.emplace(view->GetObject(), value).first->second;
+	}
+
+	/* for entries too costly to build twice: the first caller builds it,
+	   concurrent ones wait for that */
+	shared_ptr<T> FindOrBuild(BinaryView* view, const std::function<shared_ptr<T>()>& build)
+	{
+		if (shared_ptr<T> value = Find(view))
+			return value;
+
+		std::lock_guard<std::mutex> lock(buildMutex);
+		if (shared_ptr<T> value = Find(view))
+			return value;
+		return Insert(view, build());
+	}
+
+	virtual void Evict(BinaryView* view) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		entries.erase(view->GetObject());
+	}
+};
+
+/* arch.ppc.conditionRegisters per view, read when its first instruction is
+   lifted so a view can also be opened with it through its load options */
+static PpcViewCache<bool> crRegisterModes;
+
 /* class Architecture from binaryninjaapi.h */
 class PowerpcArchitecture: public Architecture
 {
-	private:
+	protected:
 	BNEndianness endian;
+	bool is64Bit;
+	bool crRegisters; /* model cr0-cr7 as registers instead of flags, by default */
+
+	private:
 
 	/* this can maybe be moved to the API later */
 	BNRegisterInfo RegisterInfo(uint32_t fullWidthReg, size_t offset, size_t size, bool zeroExtend = false)
@@ -293,12 +527,30 @@ class PowerpcArchitecture: public Architecture
 		return result;
 	}
 
+	/* the model of the view being lifted, or the default without one */
+	bool UseCrRegisters(LowLevelILFunction& il)
+	{
+		Ref<Function> func = il.GetFunction();
+		if (!func)
+			return crRegisters;
+
+		BinaryView* view = func->GetView().GetPtr();
+		shared_ptr<bool> mode = crRegisterModes.Find(view);
+		if (!mode)
+			mode = crRegisterModes.Insert(view,
+				make_shared<bool>(Settings::Instance()->Get<bool>("arch.ppc.conditionRegisters", view)));
+		return *mode;
+	}
+
 	public:
 
 	/* initialization list */
-	PowerpcArchitecture(const char* name, BNEndianness endian_): Architecture(name)
+	PowerpcArchitecture(const char* name, BNEndianness endian_, bool is64Bit_ = false,
+		bool crRegisters_ = false): Architecture(name)
 	{
 		endian = endian_;
+		is64Bit = is64Bit_;
+		crRegisters = crRegisters_;
 	}
 
 	/*************************************************************************/
@@ -374,18 +626,18 @@ class PowerpcArchitecture: public Architecture
 		{
 			case 18: /* b (b, ba, bl, bla) */
 			{
-				uint32_t target = raw_insn & 0x03fffffc;
-
-				/* sign extend target */
-				if ((target >> 25) & 1)
-					target |= 0xfc000000;
-
-				/* account for absolute addressing */
-				if (!(raw_insn & 2))
-					target += (uint32_t) addr;
+				uint32_t target = BranchTarget(raw_insn, (uint32_t) addr);
 
+				/* "bl .+4" only loads LR with the next address, no call. On
+				   ppc64 the callee is left to the lifted call: a call to an
+				   ELFv2 local entry is lifted as one to its global entry (see
+				   ElfV2CallTarget), which takes the two words before the
+				   target and only the lifter can read those. */
 				if (raw_insn & 1)
-					result.AddBranch(CallDestination, target);
+				{
+					if (target != addr + 4 && !is64Bit)
+						result.AddBranch(CallDestination, target);
+				}
 				else
 					result.AddBranch(UnconditionalBranch, target);
 
@@ -405,6 +657,8 @@ class PowerpcArchitecture: public Architecture
 				if (!(raw_insn & 2))
 					target += (uint32_t) addr;
 
+				/* a branch to the next instruction, including the PIC thunk
+				   "bcl 20,31,.+4", only affects LR (and CTR) */
 				if (target != addr + 4)
 				{
 					if ((bo & 0x14) == 0x14)
@@ -445,7 +699,11 @@ class PowerpcArchitecture: public Architecture
 				result.AddBranch(UnresolvedBranch);
 				break;
 			case PPC_INS_RFI:
-				result.AddBranch(UnresolvedBranch);
+			case PPC_INS_RFID:
+			case PPC_INS_RFCI:
+			case PPC_INS_RFDI:
+			case PPC_INS_RFMCI:
+				result.AddBranch(FunctionReturn);
 				break;
 		}
 
@@ -453,6 +711,14 @@ class PowerpcArchitecture: public Architecture
 		return true;
 	}
 
+	uint32_t ReadWord(const uint8_t *data)
+	{
+		uint32_t insword = *(const uint32_t *)data;
+		if(endian == BigEndian)
+			insword = bswap32(insword);
+		return insword;
+	}
+
 	bool DoesQualifyForLocalDisassembly(const uint8_t *data)
 	{
 		uint32_t insword = *(uint32_t *)data;
@@ -729,6 +995,7 @@ class PowerpcArchitecture: public Architecture
 	virtual bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len, LowLevelILFunction& il) override
 	{
 		bool rc = false;
+		bool crFields = UseCrRegisters(il);
 
 		if (len < 4) {
 			MYLOG("ERROR: need at least 4 bytes\n");
@@ -742,7 +1009,26 @@ class PowerpcArchitecture: public Architecture
 		struct decomp_result res;
 
 		if (DoesQualifyForLocalDisassembly(data)) {
-			il.AddInstruction(il.Unimplemented());
+			uint32_t insword = ReadWord(data);
+			if (!GetLowLevelILForLocalInstruction(il, insword, crFields))
+				il.AddInstruction(il.Unimplemented());
+			rc = true;
+			len = 4;
+			goto cleanup;
+		}
+
+		/* at an ELFv2 global entry r12 holds the entry address, so the TOC
+		   pointer computed into r2 is a constant */
+		if (is64Bit && len >= 8 && IsElfV2GlobalEntry(ReadWord(data), ReadWord(data + 4))) {
+			int32_t hi = (int16_t)(ReadWord(data) & 0xffff);
+			il.AddInstruction(il.SetRegister(4, PPC_REG_R2, il.ConstPointer(4, addr + (int64_t)hi * 0x10000)));
+			rc = true;
+			len = 4;
+			goto cleanup;
+		}
+
+		/* seen this word before, skip decoding altogether */
+		if (GetCachedLowLevelILForPPCInstruction(il, data, endian == LittleEndian, crFields)) {
 			rc = true;
 			len = 4;
 			goto cleanup;
@@ -754,7 +1040,7 @@ class PowerpcArchitecture: public Architecture
 			goto cleanup;
 		}
 
-		rc = GetLowLevelILForPPCInstruction(this, il, data, addr, &res, endian == LittleEndian);
+		rc = GetLowLevelILForPPCInstruction(this, il, data, addr, &res, endian == LittleEndian, crFields);
 		len = 4;
 
 		cleanup:
@@ -915,6 +1201,10 @@ class PowerpcArchitecture: public Architecture
 			case IL_FLAGGROUP_CR0_GE: return il.Not(0, il.Flag(flagBase + IL_FLAG_LT));
 			case IL_FLAGGROUP_CR0_EQ: return il.Flag(flagBase + IL_FLAG_EQ);
 			case IL_FLAGGROUP_CR0_NE: return il.Not(0, il.Flag(flagBase + IL_FLAG_EQ));
+			case IL_FLAGGROUP_CR0_FIELD:
+				return il.Or(4,
+					il.Or(4, il.FlagBit(4, flagBase + IL_FLAG_LT, 3), il.FlagBit(4, flagBase + IL_FLAG_GT, 2)),
+					il.Or(4, il.FlagBit(4, flagBase + IL_FLAG_EQ, 1), il.FlagBit(4, flagBase + IL_FLAG_SO, 0)));
 		}
 
 		return il.Unimplemented();
@@ -922,6 +1212,25 @@ class PowerpcArchitecture: public Architecture
 
 	virtual string GetRegisterName(uint32_t regId) override
 	{
+		if (regId == PPC_REG_FPSCR)
+			return "fpscr";
+		if (regId == PPC_REG_ACC)
+			return "acc";
+		if (regId >= PPC_REG_R0_UPPER && regId <= PPC_REG_R31_UPPER)
+			return "r" + to_string(regId - PPC_REG_R0_UPPER) + "h";
+		if (regId == PPC_REG_MSR)
+			return "msr";
+		if (regId >= PPC_REG_SPR0 && regId <= PPC_REG_SPR1023)
+		{
+			switch (regId - PPC_REG_SPR0)
+			{
+				#define SPR_NAME(number, name) case number: return name;
+				PPC_SPRS(SPR_NAME)
+				#undef SPR_NAME
+				default: return "spr" + to_string(regId - PPC_REG_SPR0);
+			}
+		}
+
 		const char *result = powerpc_reg_to_str(regId);
 
 		if(result == NULL)
@@ -1262,7 +1571,7 @@ class PowerpcArchitecture: public Architecture
 	 */
 	virtual vector<uint32_t> GetAllSemanticFlagGroups() override
 	{
-		return vector<uint32_t> {
+		vector<uint32_t> result = {
 			IL_FLAGGROUP_CR0_LT, IL_FLAGGROUP_CR0_LE, IL_FLAGGROUP_CR0_GT,
 			IL_FLAGGROUP_CR0_GE, IL_FLAGGROUP_CR0_EQ, IL_FLAGGROUP_CR0_NE,
 			IL_FLAGGROUP_CR1_LT, IL_FLAGGROUP_CR1_LE, IL_FLAGGROUP_CR1_GT,
@@ -1280,6 +1589,11 @@ class PowerpcArchitecture: public Architecture
 			IL_FLAGGROUP_CR7_LT, IL_FLAGGROUP_CR7_LE, IL_FLAGGROUP_CR7_GT,
 			IL_FLAGGROUP_CR7_GE, IL_FLAGGROUP_CR7_EQ, IL_FLAGGROUP_CR7_NE,
 		};
+
+		for (uint32_t i = 0; i < 8; i++)
+			result.push_back(i * 10 + IL_FLAGGROUP_CR0_FIELD);
+
+		return result;
 	}
 
 	virtual std::string GetSemanticFlagGroupName(uint32_t semGroup) override
@@ -1296,6 +1610,7 @@ class PowerpcArchitecture: public Architecture
 			case IL_FLAGGROUP_CR0_GE: suffix = "ge"; break;
 			case IL_FLAGGROUP_CR0_EQ: suffix = "eq"; break;
 			case IL_FLAGGROUP_CR0_NE: suffix = "ne"; break;
+			case IL_FLAGGROUP_CR0_FIELD: suffix = "field"; break;
 			default: suffix = "invalid"; break;
 		}
 
@@ -1307,6 +1622,10 @@ class PowerpcArchitecture: public Architecture
 	virtual std::vector<uint32_t> GetFlagsRequiredForSemanticFlagGroup(uint32_t semGroup) override
 	{
 		uint32_t flag = IL_FLAG_LT + ((semGroup / 10) * 4); // get to flags from the right cr
+
+		if (semGroup % 10 == IL_FLAGGROUP_CR0_FIELD)
+			return { flag, flag + 1, flag + 2, flag + 3 };
+
 		flag += ((semGroup % 10) / 2);
 
 		return { flag };
@@ -1504,6 +1823,7 @@ class PowerpcArchitecture: public Architecture
 			PPC_REG_F8, PPC_REG_F9, PPC_REG_F10, PPC_REG_F11, PPC_REG_F12, PPC_REG_F13, PPC_REG_F14, PPC_REG_F15,
 			PPC_REG_F16, PPC_REG_F17, PPC_REG_F18, PPC_REG_F19, PPC_REG_F20, PPC_REG_F21, PPC_REG_F22, PPC_REG_F23,
 			PPC_REG_F24, PPC_REG_F25, PPC_REG_F26, PPC_REG_F27, PPC_REG_F28, PPC_REG_F29, PPC_REG_F30, PPC_REG_F31,
+			PPC_REG_FPSCR,
 
 			PPC_REG_LR,
 
@@ -1524,9 +1844,21 @@ class PowerpcArchitecture: public Architecture
 			PPC_REG_VS32, PPC_REG_VS33, PPC_REG_VS34, PPC_REG_VS35, PPC_REG_VS36, PPC_REG_VS37, PPC_REG_VS38, PPC_REG_VS39,
 			PPC_REG_VS40, PPC_REG_VS41, PPC_REG_VS42, PPC_REG_VS43, PPC_REG_VS44, PPC_REG_VS45, PPC_REG_VS46, PPC_REG_VS47,
 			PPC_REG_VS48, PPC_REG_VS49, PPC_REG_VS50, PPC_REG_VS51, PPC_REG_VS52, PPC_REG_VS53, PPC_REG_VS54, PPC_REG_VS55,
-			PPC_REG_VS56, PPC_REG_VS57, PPC_REG_VS58, PPC_REG_VS59, PPC_REG_VS60, PPC_REG_VS61, PPC_REG_VS62, PPC_REG_VS63
+			PPC_REG_VS56, PPC_REG_VS57, PPC_REG_VS58, PPC_REG_VS59, PPC_REG_VS60, PPC_REG_VS61, PPC_REG_VS62, PPC_REG_VS63,
+
+			PPC_REG_ACC,
+
+			PPC_REG_MSR
 		};
 
+		for (uint32_t reg = PPC_REG_R0_UPPER; reg <= PPC_REG_R31_UPPER; reg++)
+			result.push_back(reg);
+
+		/* lr, ctr and vrsave have capstone ids, the tb write numbers alias */
+		for (uint32_t spr = 0; spr < 1024; spr++)
+			if (spr != 8 && spr != 9 && spr != 256 && spr != 284 && spr != 285)
+				result.push_back(PPC_REG_SPR0 + spr);
+
 		return result;
 	}
 
@@ -1559,38 +1891,40 @@ class PowerpcArchitecture: public Architecture
 			case PPC_REG_CR6: return RegisterInfo(PPC_REG_CR6, 0, 4);
 			case PPC_REG_CR7: return RegisterInfo(PPC_REG_CR7, 0, 4);
 			case PPC_REG_CTR: return RegisterInfo(PPC_REG_CTR, 0, 4);
-			case PPC_REG_F0: return RegisterInfo(PPC_REG_F0, 0, 4);
-			case PPC_REG_F1: return RegisterInfo(PPC_REG_F1, 0, 4);
-			case PPC_REG_F2: return RegisterInfo(PPC_REG_F2, 0, 4);
-			case PPC_REG_F3: return RegisterInfo(PPC_REG_F3, 0, 4);
-			case PPC_REG_F4: return RegisterInfo(PPC_REG_F4, 0, 4);
-			case PPC_REG_F5: return RegisterInfo(PPC_REG_F5, 0, 4);
-			case PPC_REG_F6: return RegisterInfo(PPC_REG_F6, 0, 4);
-			case PPC_REG_F7: return RegisterInfo(PPC_REG_F7, 0, 4);
-			case PPC_REG_F8: return RegisterInfo(PPC_REG_F8, 0, 4);
-			case PPC_REG_F9: return RegisterInfo(PPC_REG_F9, 0, 4);
-			case PPC_REG_F10: return RegisterInfo(PPC_REG_F10, 0, 4);
-			case PPC_REG_F11: return RegisterInfo(PPC_REG_F11, 0, 4);
-			case PPC_REG_F12: return RegisterInfo(PPC_REG_F12, 0, 4);
-			case PPC_REG_F13: return RegisterInfo(PPC_REG_F13, 0, 4);
-			case PPC_REG_F14: return RegisterInfo(PPC_REG_F14, 0, 4);
-			case PPC_REG_F15: return RegisterInfo(PPC_REG_F15, 0, 4);
-			case PPC_REG_F16: return RegisterInfo(PPC_REG_F16, 0, 4);
-			case PPC_REG_F17: return RegisterInfo(PPC_REG_F17, 0, 4);
-			case PPC_REG_F18: return RegisterInfo(PPC_REG_F18, 0, 4);
-			case PPC_REG_F19: return RegisterInfo(PPC_REG_F19, 0, 4);
-			case PPC_REG_F20: return RegisterInfo(PPC_REG_F20, 0, 4);
-			case PPC_REG_F21: return RegisterInfo(PPC_REG_F21, 0, 4);
-			case PPC_REG_F22: return RegisterInfo(PPC_REG_F22, 0, 4);
-			case PPC_REG_F23: return RegisterInfo(PPC_REG_F23, 0, 4);
-			case PPC_REG_F24: return RegisterInfo(PPC_REG_F24, 0, 4);
-			case PPC_REG_F25: return RegisterInfo(PPC_REG_F25, 0, 4);
-			case PPC_REG_F26: return RegisterInfo(PPC_REG_F26, 0, 4);
-			case PPC_REG_F27: return RegisterInfo(PPC_REG_F27, 0, 4);
-			case PPC_REG_F28: return RegisterInfo(PPC_REG_F28, 0, 4);
-			case PPC_REG_F29: return RegisterInfo(PPC_REG_F29, 0, 4);
-			case PPC_REG_F30: return RegisterInfo(PPC_REG_F30, 0, 4);
-			case PPC_REG_F31: return RegisterInfo(PPC_REG_F31, 0, 4);
+			/* f0-f31 are the first doubleword of vs0-vs31, v0-v31 are vs32-vs63 */
+			case PPC_REG_F0: return RegisterInfo(PPC_REG_VS0, 8, 8);
+			case PPC_REG_F1: return RegisterInfo(PPC_REG_VS1, 8, 8);
+			case PPC_REG_F2: return RegisterInfo(PPC_REG_VS2, 8, 8);
+			case PPC_REG_F3: return RegisterInfo(PPC_REG_VS3, 8, 8);
+			case PPC_REG_F4: return RegisterInfo(PPC_REG_VS4, 8, 8);
+			case PPC_REG_F5: return RegisterInfo(PPC_REG_VS5, 8, 8);
+			case PPC_REG_F6: return RegisterInfo(PPC_REG_VS6, 8, 8);
+			case PPC_REG_F7: return RegisterInfo(PPC_REG_VS7, 8, 8);
+			case PPC_REG_F8: return RegisterInfo(PPC_REG_VS8, 8, 8);
+			case PPC_REG_F9: return RegisterInfo(PPC_REG_VS9, 8, 8);
+			case PPC_REG_F10: return RegisterInfo(PPC_REG_VS10, 8, 8);
+			case PPC_REG_F11: return RegisterInfo(PPC_REG_VS11, 8, 8);
+			case PPC_REG_F12: return RegisterInfo(PPC_REG_VS12, 8, 8);
+			case PPC_REG_F13: return RegisterInfo(PPC_REG_VS13, 8, 8);
+			case PPC_REG_F14: return RegisterInfo(PPC_REG_VS14, 8, 8);
+			case PPC_REG_F15: return RegisterInfo(PPC_REG_VS15, 8, 8);
+			case PPC_REG_F16: return RegisterInfo(PPC_REG_VS16, 8, 8);
+			case PPC_REG_F17: return RegisterInfo(PPC_REG_VS17, 8, 8);
+			case PPC_REG_F18: return RegisterInfo(PPC_REG_VS18, 8, 8);
+			case PPC_REG_F19: return RegisterInfo(PPC_REG_VS19, 8, 8);
+			case PPC_REG_F20: return RegisterInfo(PPC_REG_VS20, 8, 8);
+			case PPC_REG_F21: return RegisterInfo(PPC_REG_VS21, 8, 8);
+			case PPC_REG_F22: return RegisterInfo(PPC_REG_VS22, 8, 8);
+			case PPC_REG_F23: return RegisterInfo(PPC_REG_VS23, 8, 8);
+			case PPC_REG_F24: return RegisterInfo(PPC_REG_VS24, 8, 8);
+			case PPC_REG_F25: return RegisterInfo(PPC_REG_VS25, 8, 8);
+			case PPC_REG_F26: return RegisterInfo(PPC_REG_VS26, 8, 8);
+			case PPC_REG_F27: return RegisterInfo(PPC_REG_VS27, 8, 8);
+			case PPC_REG_F28: return RegisterInfo(PPC_REG_VS28, 8, 8);
+			case PPC_REG_F29: return RegisterInfo(PPC_REG_VS29, 8, 8);
+			case PPC_REG_F30: return RegisterInfo(PPC_REG_VS30, 8, 8);
+			case PPC_REG_F31: return RegisterInfo(PPC_REG_VS31, 8, 8);
+			case PPC_REG_FPSCR: return RegisterInfo(PPC_REG_FPSCR, 0, 4);
 			case PPC_REG_LR: return RegisterInfo(PPC_REG_LR, 0, 4);
 			case PPC_REG_R0: return RegisterInfo(PPC_REG_R0, 0, 4);
 			case PPC_REG_R1: return RegisterInfo(PPC_REG_R1, 0, 4);
@@ -1624,104 +1958,109 @@ class PowerpcArchitecture: public Architecture
 			case PPC_REG_R29: return RegisterInfo(PPC_REG_R29, 0, 4);
 			case PPC_REG_R30: return RegisterInfo(PPC_REG_R30, 0, 4);
 			case PPC_REG_R31: return RegisterInfo(PPC_REG_R31, 0, 4);
-			case PPC_REG_V0: return RegisterInfo(PPC_REG_V0, 0, 4);
-			case PPC_REG_V1: return RegisterInfo(PPC_REG_V1, 0, 4);
-			case PPC_REG_V2: return RegisterInfo(PPC_REG_V2, 0, 4);
-			case PPC_REG_V3: return RegisterInfo(PPC_REG_V3, 0, 4);
-			case PPC_REG_V4: return RegisterInfo(PPC_REG_V4, 0, 4);
-			case PPC_REG_V5: return RegisterInfo(PPC_REG_V5, 0, 4);
-			case PPC_REG_V6: return RegisterInfo(PPC_REG_V6, 0, 4);
-			case PPC_REG_V7: return RegisterInfo(PPC_REG_V7, 0, 4);
-			case PPC_REG_V8: return RegisterInfo(PPC_REG_V8, 0, 4);
-			case PPC_REG_V9: return RegisterInfo(PPC_REG_V9, 0, 4);
-			case PPC_REG_V10: return RegisterInfo(PPC_REG_V10, 0, 4);
-			case PPC_REG_V11: return RegisterInfo(PPC_REG_V11, 0, 4);
-			case PPC_REG_V12: return RegisterInfo(PPC_REG_V12, 0, 4);
-			case PPC_REG_V13: return RegisterInfo(PPC_REG_V13, 0, 4);
-			case PPC_REG_V14: return RegisterInfo(PPC_REG_V14, 0, 4);
-			case PPC_REG_V15: return RegisterInfo(PPC_REG_V15, 0, 4);
-			case PPC_REG_V16: return RegisterInfo(PPC_REG_V16, 0, 4);
-			case PPC_REG_V17: return RegisterInfo(PPC_REG_V17, 0, 4);
-			case PPC_REG_V18: return RegisterInfo(PPC_REG_V18, 0, 4);
-			case PPC_REG_V19: return RegisterInfo(PPC_REG_V19, 0, 4);
-			case PPC_REG_V20: return RegisterInfo(PPC_REG_V20, 0, 4);
-			case PPC_REG_V21: return RegisterInfo(PPC_REG_V21, 0, 4);
-			case PPC_REG_V22: return RegisterInfo(PPC_REG_V22, 0, 4);
-			case PPC_REG_V23: return RegisterInfo(PPC_REG_V23, 0, 4);
-			case PPC_REG_V24: return RegisterInfo(PPC_REG_V24, 0, 4);
-			case PPC_REG_V25: return RegisterInfo(PPC_REG_V25, 0, 4);
-			case PPC_REG_V26: return RegisterInfo(PPC_REG_V26, 0, 4);
-			case PPC_REG_V27: return RegisterInfo(PPC_REG_V27, 0, 4);
-			case PPC_REG_V28: return RegisterInfo(PPC_REG_V28, 0, 4);
-			case PPC_REG_V29: return RegisterInfo(PPC_REG_V29, 0, 4);
-			case PPC_REG_V30: return RegisterInfo(PPC_REG_V30, 0, 4);
-			case PPC_REG_V31: return RegisterInfo(PPC_REG_V31, 0, 4);
+			case PPC_REG_V0: return RegisterInfo(PPC_REG_VS32, 0, 16);
+			case PPC_REG_V1: return RegisterInfo(PPC_REG_VS33, 0, 16);
+			case PPC_REG_V2: return RegisterInfo(PPC_REG_VS34, 0, 16);
+			case PPC_REG_V3: return RegisterInfo(PPC_REG_VS35, 0, 16);
+			case PPC_REG_V4: return RegisterInfo(PPC_REG_VS36, 0, 16);
+			case PPC_REG_V5: return RegisterInfo(PPC_REG_VS37, 0, 16);
+			case PPC_REG_V6: return RegisterInfo(PPC_REG_VS38, 0, 16);
+			case PPC_REG_V7: return RegisterInfo(PPC_REG_VS39, 0, 16);
+			case PPC_REG_V8: return RegisterInfo(PPC_REG_VS40, 0, 16);
+			case PPC_REG_V9: return RegisterInfo(PPC_REG_VS41, 0, 16);
+			case PPC_REG_V10: return RegisterInfo(PPC_REG_VS42, 0, 16);
+			case PPC_REG_V11: return RegisterInfo(PPC_REG_VS43, 0, 16);
+			case PPC_REG_V12: return RegisterInfo(PPC_REG_VS44, 0, 16);
+			case PPC_REG_V13: return RegisterInfo(PPC_REG_VS45, 0, 16);
+			case PPC_REG_V14: return RegisterInfo(PPC_REG_VS46, 0, 16);
+			case PPC_REG_V15: return RegisterInfo(PPC_REG_VS47, 0, 16);
+			case PPC_REG_V16: return RegisterInfo(PPC_REG_VS48, 0, 16);
+			case PPC_REG_V17: return RegisterInfo(PPC_REG_VS49, 0, 16);
+			case PPC_REG_V18: return RegisterInfo(PPC_REG_VS50, 0, 16);
+			case PPC_REG_V19: return RegisterInfo(PPC_REG_VS51, 0, 16);
+			case PPC_REG_V20: return RegisterInfo(PPC_REG_VS52, 0, 16);
+			case PPC_REG_V21: return RegisterInfo(PPC_REG_VS53, 0, 16);
+			case PPC_REG_V22: return RegisterInfo(PPC_REG_VS54, 0, 16);
+			case PPC_REG_V23: return RegisterInfo(PPC_REG_VS55, 0, 16);
+			case PPC_REG_V24: return RegisterInfo(PPC_REG_VS56, 0, 16);
+			case PPC_REG_V25: return RegisterInfo(PPC_REG_VS57, 0, 16);
+			case PPC_REG_V26: return RegisterInfo(PPC_REG_VS58, 0, 16);
+			case PPC_REG_V27: return RegisterInfo(PPC_REG_VS59, 0, 16);
+			case PPC_REG_V28: return RegisterInfo(PPC_REG_VS60, 0, 16);
+			case PPC_REG_V29: return RegisterInfo(PPC_REG_VS61, 0, 16);
+			case PPC_REG_V30: return RegisterInfo(PPC_REG_VS62, 0, 16);
+			case PPC_REG_V31: return RegisterInfo(PPC_REG_VS63, 0, 16);
 			case PPC_REG_VRSAVE: return RegisterInfo(PPC_REG_VRSAVE, 0, 4);
-			case PPC_REG_VS0: return RegisterInfo(PPC_REG_VS0, 0, 4);
-			case PPC_REG_VS1: return RegisterInfo(PPC_REG_VS1, 0, 4);
-			case PPC_REG_VS2: return RegisterInfo(PPC_REG_VS2, 0, 4);
-			case PPC_REG_VS3: return RegisterInfo(PPC_REG_VS3, 0, 4);
-			case PPC_REG_VS4: return RegisterInfo(PPC_REG_VS4, 0, 4);
-			case PPC_REG_VS5: return RegisterInfo(PPC_REG_VS5, 0, 4);
-			case PPC_REG_VS6: return RegisterInfo(PPC_REG_VS6, 0, 4);
-			case PPC_REG_VS7: return RegisterInfo(PPC_REG_VS7, 0, 4);
-			case PPC_REG_VS8: return RegisterInfo(PPC_REG_VS8, 0, 4);
-			case PPC_REG_VS9: return RegisterInfo(PPC_REG_VS9, 0, 4);
-			case PPC_REG_VS10: return RegisterInfo(PPC_REG_VS10, 0, 4);
-			case PPC_REG_VS11: return RegisterInfo(PPC_REG_VS11, 0, 4);
-			case PPC_REG_VS12: return RegisterInfo(PPC_REG_VS12, 0, 4);
-			case PPC_REG_VS13: return RegisterInfo(PPC_REG_VS13, 0, 4);
-			case PPC_REG_VS14: return RegisterInfo(PPC_REG_VS14, 0, 4);
-			case PPC_REG_VS15: return RegisterInfo(PPC_REG_VS15, 0, 4);
-			case PPC_REG_VS16: return RegisterInfo(PPC_REG_VS16, 0, 4);
-			case PPC_REG_VS17: return RegisterInfo(PPC_REG_VS17, 0, 4);
-			case PPC_REG_VS18: return RegisterInfo(PPC_REG_VS18, 0, 4);
-			case PPC_REG_VS19: return RegisterInfo(PPC_REG_VS19, 0, 4);
-			case PPC_REG_VS20: return RegisterInfo(PPC_REG_VS20, 0, 4);
-			case PPC_REG_VS21: return RegisterInfo(PPC_REG_VS21, 0, 4);
-			case PPC_REG_VS22: return RegisterInfo(PPC_REG_VS22, 0, 4);
-			case PPC_REG_VS23: return RegisterInfo(PPC_REG_VS23, 0, 4);
-			case PPC_REG_VS24: return RegisterInfo(PPC_REG_VS24, 0, 4);
-			case PPC_REG_VS25: return RegisterInfo(PPC_REG_VS25, 0, 4);
-			case PPC_REG_VS26: return RegisterInfo(PPC_REG_VS26, 0, 4);
-			case PPC_REG_VS27: return RegisterInfo(PPC_REG_VS27, 0, 4);
-			case PPC_REG_VS28: return RegisterInfo(PPC_REG_VS28, 0, 4);
-			case PPC_REG_VS29: return RegisterInfo(PPC_REG_VS29, 0, 4);
-			case PPC_REG_VS30: return RegisterInfo(PPC_REG_VS30, 0, 4);
-			case PPC_REG_VS31: return RegisterInfo(PPC_REG_VS31, 0, 4);
-			case PPC_REG_VS32: return RegisterInfo(PPC_REG_VS32, 0, 4);
-			case PPC_REG_VS33: return RegisterInfo(PPC_REG_VS33, 0, 4);
-			case PPC_REG_VS34: return RegisterInfo(PPC_REG_VS34, 0, 4);
-			case PPC_REG_VS35: return RegisterInfo(PPC_REG_VS35, 0, 4);
-			case PPC_REG_VS36: return RegisterInfo(PPC_REG_VS36, 0, 4);
-			case PPC_REG_VS37: return RegisterInfo(PPC_REG_VS37, 0, 4);
-			case PPC_REG_VS38: return RegisterInfo(PPC_REG_VS38, 0, 4);
-			case PPC_REG_VS39: return RegisterInfo(PPC_REG_VS39, 0, 4);
-			case PPC_REG_VS40: return RegisterInfo(PPC_REG_VS40, 0, 4);
-			case PPC_REG_VS41: return RegisterInfo(PPC_REG_VS41, 0, 4);
-			case PPC_REG_VS42: return RegisterInfo(PPC_REG_VS42, 0, 4);
-			case PPC_REG_VS43: return RegisterInfo(PPC_REG_VS43, 0, 4);
-			case PPC_REG_VS44: return RegisterInfo(PPC_REG_VS44, 0, 4);
-			case PPC_REG_VS45: return RegisterInfo(PPC_REG_VS45, 0, 4);
-			case PPC_REG_VS46: return RegisterInfo(PPC_REG_VS46, 0, 4);
-			case PPC_REG_VS47: return RegisterInfo(PPC_REG_VS47, 0, 4);
-			case PPC_REG_VS48: return RegisterInfo(PPC_REG_VS48, 0, 4);
-			case PPC_REG_VS49: return RegisterInfo(PPC_REG_VS49, 0, 4);
-			case PPC_REG_VS50: return RegisterInfo(PPC_REG_VS50, 0, 4);
-			case PPC_REG_VS51: return RegisterInfo(PPC_REG_VS51, 0, 4);
-			case PPC_REG_VS52: return RegisterInfo(PPC_REG_VS52, 0, 4);
-			case PPC_REG_VS53: return RegisterInfo(PPC_REG_VS53, 0, 4);
-			case PPC_REG_VS54: return RegisterInfo(PPC_REG_VS54, 0, 4);
-			case PPC_REG_VS55: return RegisterInfo(PPC_REG_VS55, 0, 4);
-			case PPC_REG_VS56: return RegisterInfo(PPC_REG_VS56, 0, 4);
-			case PPC_REG_VS57: return RegisterInfo(PPC_REG_VS57, 0, 4);
-			case PPC_REG_VS58: return RegisterInfo(PPC_REG_VS58, 0, 4);
-			case PPC_REG_VS59: return RegisterInfo(PPC_REG_VS59, 0, 4);
-			case PPC_REG_VS60: return RegisterInfo(PPC_REG_VS60, 0, 4);
-			case PPC_REG_VS61: return RegisterInfo(PPC_REG_VS61, 0, 4);
-			case PPC_REG_VS62: return RegisterInfo(PPC_REG_VS62, 0, 4);
-			case PPC_REG_VS63: return RegisterInfo(PPC_REG_VS63, 0, 4);
+			case PPC_REG_VS0: return RegisterInfo(PPC_REG_VS0, 0, 16);
+			case PPC_REG_VS1: return RegisterInfo(PPC_REG_VS1, 0, 16);
+			case PPC_REG_VS2: return RegisterInfo(PPC_REG_VS2, 0, 16);
+			case PPC_REG_VS3: return RegisterInfo(PPC_REG_VS3, 0, 16);
+			case PPC_REG_VS4: return RegisterInfo(PPC_REG_VS4, 0, 16);
+			case PPC_REG_VS5: return RegisterInfo(PPC_REG_VS5, 0, 16);
+			case PPC_REG_VS6: return RegisterInfo(PPC_REG_VS6, 0, 16);
+			case PPC_REG_VS7: return RegisterInfo(PPC_REG_VS7, 0, 16);
+			case PPC_REG_VS8: return RegisterInfo(PPC_REG_VS8, 0, 16);
+			case PPC_REG_VS9: return RegisterInfo(PPC_REG_VS9, 0, 16);
+			case PPC_REG_VS10: return RegisterInfo(PPC_REG_VS10, 0, 16);
+			case PPC_REG_VS11: return RegisterInfo(PPC_REG_VS11, 0, 16);
+			case PPC_REG_VS12: return RegisterInfo(PPC_REG_VS12, 0, 16);
+			case PPC_REG_VS13: return RegisterInfo(PPC_REG_VS13, 0, 16);
+			case PPC_REG_VS14: return RegisterInfo(PPC_REG_VS14, 0, 16);
+			case PPC_REG_VS15: return RegisterInfo(PPC_REG_VS15, 0, 16);
+			case PPC_REG_VS16: return RegisterInfo(PPC_REG_VS16, 0, 16);
+			case PPC_REG_VS17: return RegisterInfo(PPC_REG_VS17, 0, 16);
+			case PPC_REG_VS18: return RegisterInfo(PPC_REG_VS18, 0, 16);
+			case PPC_REG_VS19: return RegisterInfo(PPC_REG_VS19, 0, 16);
+			case PPC_REG_VS20: return RegisterInfo(PPC_REG_VS20, 0, 16);
+			case PPC_REG_VS21: return RegisterInfo(PPC_REG_VS21, 0, 16);
+			case PPC_REG_VS22: return RegisterInfo(PPC_REG_VS22, 0, 16);
+			case PPC_REG_VS23: return RegisterInfo(PPC_REG_VS23, 0, 16);
+			case PPC_REG_VS24: return RegisterInfo(PPC_REG_VS24, 0, 16);
+			case PPC_REG_VS25: return RegisterInfo(PPC_REG_VS25, 0, 16);
+			case PPC_REG_VS26: return RegisterInfo(PPC_REG_VS26, 0, 16);
+			case PPC_REG_VS27: return RegisterInfo(PPC_REG_VS27, 0, 16);
+			case PPC_REG_VS28: return RegisterInfo(PPC_REG_VS28, 0, 16);
+			case PPC_REG_VS29: return RegisterInfo(PPC_REG_VS29, 0, 16);
+			case PPC_REG_VS30: return RegisterInfo(PPC_REG_VS30, 0, 16);
+			case PPC_REG_VS31: return RegisterInfo(PPC_REG_VS31, 0, 16);
+			case PPC_REG_VS32: return RegisterInfo(PPC_REG_VS32, 0, 16);
+			case PPC_REG_VS33: return RegisterInfo(PPC_REG_VS33, 0, 16);
+			case PPC_REG_VS34: return RegisterInfo(PPC_REG_VS34, 0, 16);
+			case PPC_REG_VS35: return RegisterInfo(PPC_REG_VS35, 0, 16);
+			case PPC_REG_VS36: return RegisterInfo(PPC_REG_VS36, 0, 16);
+			case PPC_REG_VS37: return RegisterInfo(PPC_REG_VS37, 0, 16);
+			case PPC_REG_VS38: return RegisterInfo(PPC_REG_VS38, 0, 16);
+			case PPC_REG_VS39: return RegisterInfo(PPC_REG_VS39, 0, 16);
+			case PPC_REG_VS40: return RegisterInfo(PPC_REG_VS40, 0, 16);
+			case PPC_REG_VS41: return RegisterInfo(PPC_REG_VS41, 0, 16);
+			case PPC_REG_VS42: return RegisterInfo(PPC_REG_VS42, 0, 16);
+			case PPC_REG_VS43: return RegisterInfo(PPC_REG_VS43, 0, 16);
+			case PPC_REG_VS44: return RegisterInfo(PPC_REG_VS44, 0, 16);
+			case PPC_REG_VS45: return RegisterInfo(PPC_REG_VS45, 0, 16);
+			case PPC_REG_VS46: return RegisterInfo(PPC_REG_VS46, 0, 16);
+			case PPC_REG_VS47: return RegisterInfo(PPC_REG_VS47, 0, 16);
+			case PPC_REG_VS48: return RegisterInfo(PPC_REG_VS48, 0, 16);
+			case PPC_REG_VS49: return RegisterInfo(PPC_REG_VS49, 0, 16);
+			case PPC_REG_VS50: return RegisterInfo(PPC_REG_VS50, 0, 16);
+			case PPC_REG_VS51: return RegisterInfo(PPC_REG_VS51, 0, 16);
+			case PPC_REG_VS52: return RegisterInfo(PPC_REG_VS52, 0, 16);
+			case PPC_REG_VS53: return RegisterInfo(PPC_REG_VS53, 0, 16);
+			case PPC_REG_VS54: return RegisterInfo(PPC_REG_VS54, 0, 16);
+			case PPC_REG_VS55: return RegisterInfo(PPC_REG_VS55, 0, 16);
+			case PPC_REG_VS56: return RegisterInfo(PPC_REG_VS56, 0, 16);
+			case PPC_REG_VS57: return RegisterInfo(PPC_REG_VS57, 0, 16);
+			case PPC_REG_VS58: return RegisterInfo(PPC_REG_VS58, 0, 16);
+			case PPC_REG_VS59: return RegisterInfo(PPC_REG_VS59, 0, 16);
+			case PPC_REG_VS60: return RegisterInfo(PPC_REG_VS60, 0, 16);
+			case PPC_REG_VS61: return RegisterInfo(PPC_REG_VS61, 0, 16);
+			case PPC_REG_VS62: return RegisterInfo(PPC_REG_VS62, 0, 16);
+			case PPC_REG_VS63: return RegisterInfo(PPC_REG_VS63, 0, 16);
+			case PPC_REG_ACC: return RegisterInfo(PPC_REG_ACC, 0, 8);
+			case PPC_REG_MSR: return RegisterInfo(PPC_REG_MSR, 0, 4);
 			default:
+				if ((regId >= PPC_REG_R0_UPPER && regId <= PPC_REG_R31_UPPER) ||
+				  (regId >= PPC_REG_SPR0 && regId <= PPC_REG_SPR1023))
+					return RegisterInfo(regId, 0, 4);
 				//LogError("%s(%d == \"%s\") invalid argument", __func__,
 				//  regId, powerpc_reg_to_str(regId));
 				return RegisterInfo(0,0,0);
@@ -1740,6 +2079,133 @@ class PowerpcArchitecture: public Architecture
 		return PPC_REG_LR;
 	}
 
+	/*************************************************************************/
+	/* INTRINSICS */
+	/*************************************************************************/
+
+	virtual string GetIntrinsicName(uint32_t intrinsic) override
+	{
+		switch (intrinsic)
+		{
+			case PPC_INTRIN_BSWAP16: return "__bswap16";
+			case PPC_INTRIN_BSWAP32: return "__bswap32";
+			case PPC_INTRIN_BSWAP64: return "__bswap64";
+			case PPC_INTRIN_XXPERMR: return "__xxpermr";
+			#define VECTOR_NAME(id, name, inputs, output) case PPC_INTRIN_##id: return "__" name;
+			VECTOR_INTRINSICS(VECTOR_NAME)
+			SPE_INTRINSICS(VECTOR_NAME)
+			#undef VECTOR_NAME
+			default: return "";
+		}
+	}
+
+	/* the VECTOR_INTRINSICS signature letters */
+	static Ref<Type> GetVectorIntrinsicType(char kind)
+	{
+		switch (kind)
+		{
+			case 'v':
+			case 'V': return Type::IntegerType(16, false);
+			case 'd':
+			case 'D': return Type::FloatType(8);
+			case 'b': return Type::IntegerType(1, false);
+			case 'h': return Type::IntegerType(2, false);
+			default: return Type::IntegerType(4, false);
+		}
+	}
+
+	virtual vector<uint32_t> GetAllIntrinsics() override
+	{
+		vector<uint32_t> result = {
+			PPC_INTRIN_BSWAP16,
+			PPC_INTRIN_BSWAP32,
+			PPC_INTRIN_BSWAP64,
+			PPC_INTRIN_XXPERMR
+		};
+
+		for (uint32_t intrinsic = PPC_INTRIN_VECTOR_BASE + 1; intrinsic < PPC_INTRIN_VECTOR_END; intrinsic++)
+			result.push_back(intrinsic);
+		for (uint32_t intrinsic = PPC_INTRIN_SPE_BASE + 1; intrinsic < PPC_INTRIN_SPE_END; intrinsic++)
+			result.push_back(intrinsic);
+
+		return result;
+	}
+
+	virtual vector<NameAndType> GetIntrinsicInputs(uint32_t intrinsic) override
+	{
+		vector<NameAndType> result;
+
+		switch (intrinsic)
+		{
+			case PPC_INTRIN_BSWAP16:
+				result.push_back(NameAndType("value", Type::IntegerType(2, false)));
+				break;
+			case PPC_INTRIN_BSWAP32:
+				result.push_back(NameAndType("value", Type::IntegerType(4, false)));
+				break;
+			case PPC_INTRIN_BSWAP64:
+				result.push_back(NameAndType("value", Type::IntegerType(8, false)));
+				break;
+			case PPC_INTRIN_XXPERMR:
+				for (int i = 0; i < 3; i++)
+					result.push_back(NameAndType(Type::IntegerType(16, false)));
+				break;
+			#define VECTOR_INPUTS(id, name, inputs, output) \
+			case PPC_INTRIN_##id: \
+				for (const char* kind = inputs; *kind; kind++) \
+					result.push_back(NameAndType(GetVectorIntrinsicType(*kind))); \
+				break;
+			VECTOR_INTRINSICS(VECTOR_INPUTS)
+			#undef VECTOR_INPUTS
+			#define SPE_INPUTS(id, name, inputs, output) \
+			case PPC_INTRIN_##id: \
+				for (const char* kind = inputs; *kind; kind++) \
+				{ \
+					if (*kind == 'a') \
+						result.push_back(NameAndType("acc", Type::IntegerType(8, false))); \
+					else \
+						for (int i = 0; i < 2; i++) \
+							result.push_back(NameAndType(Type::IntegerType(4, false))); \
+				} \
+				break;
+			SPE_INTRINSICS(SPE_INPUTS)
+			#undef SPE_INPUTS
+		}
+
+		return result;
+	}
+
+	virtual vector<Confidence<Ref<Type>>> GetIntrinsicOutputs(uint32_t intrinsic) override
+	{
+		switch (intrinsic)
+		{
+			case PPC_INTRIN_BSWAP32:
+				return { Type::IntegerType(4, false) };
+			case PPC_INTRIN_BSWAP16:
+				return { Type::IntegerType(2, false) };
+			case PPC_INTRIN_BSWAP64:
+				return { Type::IntegerType(8, false) };
+			case PPC_INTRIN_XXPERMR:
+				return { Type::IntegerType(16, false) };
+			#define VECTOR_OUTPUTS(id, name, inputs, output) \
+			case PPC_INTRIN_##id: \
+				if (!output) \
+					return vector<Confidence<Ref<Type>>>(); \
+				return { GetVectorIntrinsicType(output) };
+			VECTOR_INTRINSICS(VECTOR_OUTPUTS)
+			#undef VECTOR_OUTPUTS
+			#define SPE_OUTPUTS(id, name, inputs, output) \
+			case PPC_INTRIN_##id: \
+				if (output == 'E') \
+					return { Type::IntegerType(4, false), Type::IntegerType(4, false), Type::IntegerType(8, false) }; \
+				return { Type::IntegerType(4, false), Type::IntegerType(4, false) };
+			SPE_INTRINSICS(SPE_OUTPUTS)
+			#undef SPE_OUTPUTS
+			default:
+				return vector<Confidence<Ref<Type>>>();
+		}
+	}
+
 	/*************************************************************************/
 
 	virtual bool CanAssemble() override
@@ -2027,160 +2493,1799 @@ class PowerpcArchitecture: public Architecture
 
 };
 
-class PpcImportedFunctionRecognizer: public FunctionRecognizer
+/* e200 cores execute a mix of 16-bit "se_" and 32-bit "e_" VLE instructions
+	alongside the Book E encodings they share with classic PowerPC. Anything
+	the VLE decoder reports as VLE_INS_BOOKE is handed back to the regular
+	PowerpcArchitecture paths. */
+class PowerpcVleArchitecture: public PowerpcArchitecture
 {
-	private:
-	bool RecognizeELFPLTEntries(BinaryView* data, Function* func, LowLevelILFunction* il)
-	{
-		MYLOG("%s()\n", __func__);
-		LowLevelILInstruction lis, lwz, mtctr, tmp;
-		int64_t entry, constGotBase;
-		uint32_t regGotBase, regJump;
-
-		// lis   r11, 0x1002     ; r11 -> base of GOT
-		// lwz   r11, ???(r11)   ; get GOT[???]
-		// mtctr r11             ; move to ctr
-		// bctr                  ; branch to ctr
-		if(il->GetInstructionCount() != 4)
-			return false;
+	public:
 
-		//
-		// LIS   r11, 0x1002
-		//
-		lis = il->GetInstruction(0);
-		if(lis.operation != LLIL_SET_REG)
-			return false;
-		/* get the constant, address of GOT */
-		tmp = lis.GetSourceExpr<LLIL_SET_REG>();
-		if ((tmp.operation != LLIL_CONST) && (tmp.operation != LLIL_CONST_PTR) && (tmp.operation != LLIL_EXTERN_PTR))
-			return false;
-		constGotBase = tmp.GetConstant();
-		/* get the destination register, is assigned the address of GOT */
-		regGotBase = lis.GetDestRegister<LLIL_SET_REG>();
-		//
-		// LWZ   r11, ???(r11)
-		//
-		lwz = il->GetInstruction(1);
-		if(lwz.operation != LLIL_SET_REG)
-			return false;
+	PowerpcVleArchitecture(const char* name, BNEndianness endian_): PowerpcArchitecture(name, endian_)
+	{
+	}
 
-		if(lwz.GetDestRegister<LLIL_SET_REG>() != regGotBase) // lwz must assign to same reg
-			return false;
+	virtual size_t GetInstructionAlignment() const override
+	{
+		return 2;
+	}
 
-		tmp = lwz.GetSourceExpr<LLIL_SET_REG>(); // lwz must read from LOAD
-		if(tmp.operation != LLIL_LOAD)
-			return false;
+	virtual bool CanAssemble() override
+	{
+		return false;
+	}
 
-		// "dereference" the load(...) to get either:
-		tmp = tmp.GetSourceExpr<LLIL_LOAD>();
-		// r11         (LLIL_REG)
-		if(tmp.operation == LLIL_REG) {
-			if(regGotBase != tmp.GetSourceRegister<LLIL_REG>()) // lwz must read from same reg
-				return false;
+	virtual bool GetInstructionInfo(const uint8_t* data, uint64_t addr,
+		size_t maxLen, InstructionInfo& result) override
+	{
+		struct vle_insn insn;
 
-			entry = constGotBase;
+		if(vle_decompose(data, maxLen, (uint32_t)addr, endian == LittleEndian, &insn)) {
+			MYLOG("ERROR: vle_decompose()\n");
+			return false;
 		}
-		// r11 + ???   (LLIL_ADD)
-		else if(tmp.operation == LLIL_ADD) {
-			LowLevelILInstruction lhs, rhs;
 
-			lhs = tmp.GetLeftExpr<LLIL_ADD>();
-			rhs = tmp.GetRightExpr<LLIL_ADD>();
+		if (insn.id == VLE_INS_BOOKE)
+			return PowerpcArchitecture::GetInstructionInfo(data, addr, maxLen, result);
 
-			if(lhs.operation != LLIL_REG)
-				return false;
-			if(lhs.GetSourceRegister<LLIL_REG>() != regGotBase)
-				return false;
+		switch (insn.id)
+		{
+			case VLE_INS_SE_B:
+			case VLE_INS_E_B:
+				if (insn.lk)
+				{
+					if (insn.operands[0].label != addr + insn.size)
+						result.AddBranch(CallDestination, insn.operands[0].label);
+				}
+				else
+					result.AddBranch(UnconditionalBranch, insn.operands[0].label);
+				break;
+			case VLE_INS_SE_BC:
+			case VLE_INS_E_BC:
+			{
+				uint32_t target = insn.operands[insn.op_count - 1].label;
 
-			if(rhs.operation != LLIL_CONST)
-				return false;
+				if (target != addr + insn.size && !insn.lk)
+				{
+					result.AddBranch(FalseBranch, addr + insn.size);
+					result.AddBranch(TrueBranch, target);
+				}
 
-			entry = constGotBase + rhs.GetConstant();
+				break;
+			}
+			case VLE_INS_SE_BLR:
+			case VLE_INS_SE_RFI:
+			case VLE_INS_SE_RFCI:
+			case VLE_INS_SE_RFDI:
+			case VLE_INS_SE_RFMCI:
+				result.AddBranch(FunctionReturn);
+				break;
+			case VLE_INS_SE_BCTR:
+			case VLE_INS_SE_ILLEGAL:
+				result.AddBranch(UnresolvedBranch);
+				break;
 		}
-		else {
+
+		result.length = insn.size;
+		return true;
+	}
+
+	virtual bool GetInstructionText(const uint8_t* data, uint64_t addr, size_t& len, vector<InstructionTextToken>& result) override
+	{
+		char buf[32];
+		size_t strlenMnem;
+		struct vle_insn insn;
+
+		if(vle_decompose(data, len, (uint32_t)addr, endian == LittleEndian, &insn)) {
+			MYLOG("ERROR: vle_decompose()\n");
 			return false;
 		}
 
-		//
-		// MTCTR
-		//
-		mtctr = il->GetInstruction(2);
-		if(mtctr.operation != LLIL_SET_REG)
-			return false;
-		/* from regGotBase */
-		tmp = mtctr.GetSourceExpr();
-		if(tmp.operation != LLIL_REG)
-			return false;
-		if(tmp.GetSourceRegister<LLIL_REG>() != regGotBase)
-			return false;
-		/* to new register (probably CTR) */
-		regJump = mtctr.GetDestRegister<LLIL_SET_REG>();
-
-		//
-		// JUMP
-		//
-		tmp = il->GetInstruction(3);
-		if((tmp.operation != LLIL_JUMP) && (tmp.operation != LLIL_TAILCALL))
-			return false;
-		tmp = (tmp.operation == LLIL_JUMP) ? tmp.GetDestExpr<LLIL_JUMP>() : tmp.GetDestExpr<LLIL_TAILCALL>();
-		if(tmp.operation != LLIL_REG)
-			return false;
-		if(tmp.GetSourceRegister<LLIL_REG>() != regJump)
-			return false;
+		if (insn.id == VLE_INS_BOOKE)
+			return PowerpcArchitecture::GetInstructionText(data, addr, len, result);
 
-		// done!
-		Ref<Symbol> sym = data->GetSymbolByAddress(entry);
-		if (!sym) {
-			return false;
+		/* mnemonic */
+		char mnem[32];
+		vle_mnemonic(&insn, mnem, sizeof(mnem));
+		result.emplace_back(InstructionToken, mnem);
+
+		/* padding between mnemonic and operands */
+		memset(buf, ' ', 8);
+		strlenMnem = strlen(mnem);
+		if(strlenMnem < 8)
+			buf[8-strlenMnem] = '\0';
+		else
+			buf[1] = '\0';
+		result.emplace_back(TextToken, buf);
+
+		/* operands */
+		for(int i=0; i<insn.op_count; ++i) {
+			struct vle_op *op = &(insn.operands[i]);
+
+			switch(op->type) {
+				case VLE_OP_REG:
+					result.emplace_back(RegisterToken, GetRegisterName(op->reg));
+					break;
+				case VLE_OP_IMM:
+					if (op->imm < 0 && op->imm > -0x10000)
+						snprintf(buf, sizeof(buf), "-0x%x", -op->imm);
+					else
+						snprintf(buf, sizeof(buf), "0x%x", op->imm);
+					result.emplace_back(IntegerToken, buf, op->imm, 4);
+					break;
+				case VLE_OP_MEM:
+					// eg: se_lwz r3, 4(r1)
+					snprintf(buf, sizeof(buf), "%d", op->mem.disp);
+					result.emplace_back(IntegerToken, buf, op->mem.disp, 4);
+
+					result.emplace_back(TextToken, "(");
+					result.emplace_back(RegisterToken, GetRegisterName(op->mem.base));
+					result.emplace_back(TextToken, ")");
+					break;
+				case VLE_OP_CRBIT:
+					result.emplace_back(TextToken, GetFlagName(op->crbit));
+					break;
+				case VLE_OP_LABEL:
+					snprintf(buf, sizeof(buf), "0x%x", op->label);
+					result.emplace_back(CodeRelativeAddressToken, buf, op->label, 4);
+					break;
+				case VLE_OP_INVALID:
+				default:
+					result.emplace_back(TextToken, "???");
+			}
+
+			if(i < insn.op_count-1)
+				result.emplace_back(OperandSeparatorToken, ", ");
 		}
-		if (sym->GetType() != ImportAddressSymbol) {
+
+		len = insn.size;
+		return true;
+	}
+
+	virtual bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len, LowLevelILFunction& il) override
+	{
+		struct vle_insn insn;
+
+		if(vle_decompose(data, len, (uint32_t)addr, endian == LittleEndian, &insn)) {
+			MYLOG("ERROR: vle_decompose()\n");
+			il.AddInstruction(il.Undefined());
 			return false;
 		}
-		data->DefineImportedFunction(sym, func);
 
-		return true;
+		if (insn.id == VLE_INS_BOOKE)
+			return PowerpcArchitecture::GetInstructionLowLevelIL(data, addr, len, il);
+
+		len = insn.size;
+		return GetLowLevelILForVLEInstruction(this, il, addr, &insn);
 	}
 
-	bool RecognizeMachoPLTEntries(BinaryView* data, Function* func, LowLevelILFunction* il)
+	/*************************************************************************/
+
+	virtual bool IsAlwaysBranchPatchAvailable(const uint8_t* data, uint64_t addr, size_t len) override
 	{
-		(void)data;
-		(void)func;
-		(void)il;
+		struct vle_insn insn;
 
-		MYLOG("%s()\n", __func__);
+		if(vle_decompose(data, len, (uint32_t)addr, endian == LittleEndian, &insn))
+			return false;
 
-		return false;
+		return insn.id == VLE_INS_SE_BC || insn.id == VLE_INS_E_BC;
 	}
 
-	public:
-	virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il) override
+	virtual bool IsInvertBranchPatchAvailable(const uint8_t* data, uint64_t addr, size_t len) override
 	{
-		if (RecognizeELFPLTEntries(data, func, il))
-			return true;
-		else if (RecognizeMachoPLTEntries(data, func, il))
+		struct vle_insn insn;
+
+		if(vle_decompose(data, len, (uint32_t)addr, endian == LittleEndian, &insn))
+			return false;
+
+		/* only the BO32 conditions on a CR bit can be inverted */
+		if (insn.id == VLE_INS_SE_BC)
 			return true;
+		if (insn.id == VLE_INS_E_BC)
+			return (insn.bo & 0x10) == 0;
 		return false;
 	}
-};
 
-class PpcSvr4CallingConvention: public CallingConvention
-{
-public:
-	PpcSvr4CallingConvention(Architecture* arch): CallingConvention(arch, "svr4")
+	virtual bool IsSkipAndReturnZeroPatchAvailable(const uint8_t* data, uint64_t addr, size_t len) override
 	{
+		(void)data;
+		(void)addr;
+		(void)len;
+		return false;
 	}
 
+	virtual bool IsSkipAndReturnValuePatchAvailable(const uint8_t* data, uint64_t addr, size_t len) override
+	{
+		(void)data;
+		(void)addr;
+		(void)len;
+		return false;
+	}
+
+	/*************************************************************************/
+
+	/* read/write the halfwords of a VLE instruction in target byte order */
+	uint16_t ReadHalf(const uint8_t* data)
+	{
+		return (endian == LittleEndian) ? (data[1] << 8 | data[0]) : (data[0] << 8 | data[1]);
+	}
+
+	void WriteHalf(uint8_t* data, uint16_t hw)
+	{
+		if (endian == LittleEndian) {
+			data[0] = hw & 0xff;
+			data[1] = hw >> 8;
+		} else {
+			data[0] = hw >> 8;
+			data[1] = hw & 0xff;
+		}
+	}
+
+	virtual bool ConvertToNop(uint8_t* data, uint64_t, size_t len) override
+	{
+		MYLOG("%s()\n", __func__);
+
+		/* se_nop is the simplified mnemonic for se_or r0, r0 */
+		if(len < 2)
+			return false;
+		for(size_t i=0; i<len/2; ++i)
+			WriteHalf(data + 2*i, 0x4400);
+		return true;
+	}
+
+	virtual bool AlwaysBranch(uint8_t* data, uint64_t addr, size_t len) override
+	{
+		struct vle_insn insn;
+
+		MYLOG("%s()\n", __func__);
+
+		if(vle_decompose(data, len, (uint32_t)addr, endian == LittleEndian, &insn))
+			return false;
+
+		if (insn.id == VLE_INS_SE_BC) {
+			/* BD8 form: keep the displacement, rewrite as se_b */
+			WriteHalf(data, 0xe800 | (insn.insword & 0xff));
+			return true;
+		}
+
+		if (insn.id == VLE_INS_E_BC) {
+			/* BD15 -> BD24 form, keeping LK */
+			int32_t bd = (int16_t)(insn.insword & 0xfffe);
+			uint32_t iw = 0x78000000 | ((uint32_t)bd & 0x01fffffe) | (insn.insword & 1);
+			WriteHalf(data, iw >> 16);
+			WriteHalf(data + 2, iw & 0xffff);
+			return true;
+		}
+
+		return false;
+	}
+
+	virtual bool InvertBranch(uint8_t* data, uint64_t addr, size_t len) override
+	{
+		MYLOG("%s()\n", __func__);
+
+		if(!IsInvertBranchPatchAvailable(data, addr, len))
+			return false;
+
+		/* flip the "branch if true" bit of BO16/BO32 */
+		uint16_t hw = ReadHalf(data);
+		if ((hw & 0xf000) == 0xe000)
+			WriteHalf(data, hw ^ 0x0400);
+		else
+			WriteHalf(data, hw ^ 0x0010);
+		return true;
+	}
+};
+
+/* GetAddressSize() is 4 for every flavor, GPRs are lifted as 4 bytes */
+static bool Is64BitArchitecture(Architecture* arch)
+{
+	string name = arch->GetName();
+	return name == "ppc64" || name == "ppc64_le";
+}
+
+/* how far back the recognizers look for the definition of a register */
+#define IL_SEARCH_WINDOW 32
+
+static bool ReadWord(BinaryView* data, Architecture* arch, uint64_t addr, uint32_t& value)
+{
+	if (data->Read(&value, addr, 4) != 4)
+		return false;
+	if (arch->GetEndianness() == BigEndian)
+		value = bswap32(value);
+	return true;
+}
+
+static bool ReadDoubleword(BinaryView* data, Architecture* arch, uint64_t addr, uint64_t& value)
+{
+	uint32_t hi, lo;
+	if (!ReadWord(data, arch, addr, hi) || !ReadWord(data, arch, addr + 4, lo))
+		return false;
+	if (arch->GetEndianness() == LittleEndian)
+		swap(hi, lo);
+	value = ((uint64_t)hi << 32) | lo;
+	return true;
+}
+
+/* find the most recent assignment to reg before instruction index i */
+static bool FindDefinition(LowLevelILFunction* il, size_t i, uint32_t reg, LowLevelILInstruction& def, size_t& defIndex)
+{
+	for (size_t n = 0; n < IL_SEARCH_WINDOW && i > 0; ++n)
+	{
+		LowLevelILInstruction instr = il->GetInstruction(--i);
+
+		if (instr.operation == LLIL_CALL)
+			return false;
+		if (instr.operation != LLIL_SET_REG)
+			continue;
+		if (instr.GetDestRegister<LLIL_SET_REG>() != reg)
+			continue;
+
+		def = instr.GetSourceExpr<LLIL_SET_REG>();
+		defIndex = i;
+		return true;
+	}
+
+	return false;
+}
+
+/* follow register copies until something other than a register */
+static bool Chase(LowLevelILFunction* il, LowLevelILInstruction& expr, size_t& i)
+{
+	for (int depth = 0; expr.operation == LLIL_REG; ++depth)
+	{
+		if (depth > 4 || !FindDefinition(il, i, expr.GetSourceRegister<LLIL_REG>(), expr, i))
+			return false;
+	}
+
+	return true;
+}
+
+/* a register read at instruction i that nothing before it writes, eg: the
+	TOC pointer in r2, holds whatever the calling convention says it holds
+	on entry */
+static bool GetIncomingValue(LowLevelILFunction* il, size_t i, uint32_t reg, uint64_t& value)
+{
+	if (i > IL_SEARCH_WINDOW)
+		return false;
+	while (i > 0)
+	{
+		LowLevelILInstruction instr = il->GetInstruction(--i);
+		if (instr.operation == LLIL_CALL)
+			return false;
+		if (instr.operation == LLIL_SET_REG && instr.GetDestRegister<LLIL_SET_REG>() == reg)
+			return false;
+	}
+
+	Ref<Function> func = il->GetFunction();
+	if (!func)
+		return false;
+	Ref<CallingConvention> cc = func->GetCallingConvention().GetValue();
+	if (!cc && func->GetPlatform())
+		cc = func->GetPlatform()->GetDefaultCallingConvention();
+	if (!cc)
+		return false;
+
+	RegisterValue incoming = cc->GetIncomingRegisterValue(reg, func);
+	if (incoming.state != ConstantValue && incoming.state != ConstantPointerValue)
+		return false;
+	value = (uint64_t)incoming.value;
+	return true;
+}
+
+static uint64_t WrapToSize(uint64_t value, size_t size)
+{
+	if (size && size < 8)
+		value &= (1ULL << (8 * size)) - 1;
+	return value;
+}
+
+/* constant fold an expression, following register definitions and
+	loading from memory (eg: GOT entries and function descriptors). Values
+	are 64 bits wide and wrapped to the size of each expression. */
+static bool Evaluate(BinaryView* data, Architecture* arch, LowLevelILFunction* il, size_t i,
+	LowLevelILInstruction expr, uint64_t& value, int depth = 0)
+{
+	uint64_t left, right;
+
+	if (depth > 8)
+		return false;
+	if (!Chase(il, expr, i))
+	{
+		if (expr.operation != LLIL_REG || !GetIncomingValue(il, i, expr.GetSourceRegister<LLIL_REG>(), value))
+			return false;
+		value = WrapToSize(value, expr.size);
+		return true;
+	}
+
+	switch (expr.operation)
+	{
+		case LLIL_CONST:
+		case LLIL_CONST_PTR:
+			value = (uint64_t)expr.GetConstant();
+			break;
+		case LLIL_ADD:
+		case LLIL_SUB:
+		case LLIL_OR:
+		case LLIL_LSL:
+			if (!Evaluate(data, arch, il, i, expr.GetLeftExpr(), left, depth + 1))
+				return false;
+			if (!Evaluate(data, arch, il, i, expr.GetRightExpr(), right, depth + 1))
+				return false;
+
+			switch (expr.operation)
+			{
+				case LLIL_ADD: value = left + right; break;
+				case LLIL_SUB: value = left - right; break;
+				case LLIL_OR: value = left | right; break;
+				default: value = left << (right & 63); break;
+			}
+			break;
+		case LLIL_LOW_PART:
+		case LLIL_ZX:
+			if (!Evaluate(data, arch, il, i, expr.GetSourceExpr(), value, depth + 1))
+				return false;
+			break;
+		case LLIL_LOAD:
+		{
+			uint32_t word;
+			if (!Evaluate(data, arch, il, i, expr.GetSourceExpr<LLIL_LOAD>(), left, depth + 1))
+				return false;
+			if (expr.size == 8)
+				return ReadDoubleword(data, arch, left, value);
+			if (expr.size != 4 || !ReadWord(data, arch, left, word))
+				return false;
+			value = word;
+			break;
+		}
+		default:
+			return false;
+	}
+
+	value = WrapToSize(value, expr.size);
+	return true;
+}
+
+/* PLT and call stubs, matched against the raw instruction words. Each stub
+	computes the address of the slot holding the import's address from a
+	base (absolute, the GOT pointer in r30, the TOC pointer in r2, or the
+	stub's own address for BSS-PLT entries) plus the immediates collected
+	from the STUB_HA and STUB_LO words. */
+enum PpcStubOp
+{
+	STUB_MATCH, /* must match, contributes nothing */
+	STUB_HA,    /* addis/lis: high adjusted 16 bits */
+	STUB_LO,    /* addi/lwz: low signed 16 bits */
+	STUB_LO_DS  /* ld: low signed 16 bits, DS form */
+};
+
+enum PpcStubBase
+{
+	STUB_BASE_ABS,
+	STUB_BASE_GOT,
+	STUB_BASE_TOC,
+	STUB_BASE_SELF
+};
+
+struct PpcStubWord
+{
+	uint32_t mask;
+	uint32_t value;
+	PpcStubOp op;
+};
+
+#define STUB_MAX_WORDS 8
+
+struct PpcStubPattern
+{
+	const char* name;
+	PpcStubBase base;
+	int64_t bias; /* added to the base, eg: the PIC label inside the stub */
+	size_t count;
+	PpcStubWord words[STUB_MAX_WORDS];
+};
+
+static const PpcStubPattern stubPatterns[] = {
+	/* lis r11, hi; lwz r11, lo(r11); mtctr r11; bctr */
+	{ "plt32", STUB_BASE_ABS, 0, 4, {
+		{ 0xffff0000, 0x3d600000, STUB_HA },
+		{ 0xffff0000, 0x816b0000, STUB_LO },
+		{ 0xffffffff, 0x7d6903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* Secure-PLT, -fPIC: addis r11, r30, hi; lwz r11, lo(r11); mtctr r11; bctr */
+	{ "secure-plt-pic", STUB_BASE_GOT, 0, 4, {
+		{ 0xffff0000, 0x3d7e0000, STUB_HA },
+		{ 0xffff0000, 0x816b0000, STUB_LO },
+		{ 0xffffffff, 0x7d6903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* Secure-PLT, -fpic: lwz r11, lo(r30); mtctr r11; bctr */
+	{ "secure-plt-pic-small", STUB_BASE_GOT, 0, 3, {
+		{ 0xffff0000, 0x817e0000, STUB_LO },
+		{ 0xffffffff, 0x7d6903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* BSS-PLT entry, patched by the dynamic linker: li r11, index; b resolve */
+	{ "bss-plt", STUB_BASE_SELF, 0, 2, {
+		{ 0xffff0000, 0x39600000, STUB_MATCH },
+		{ 0xfc000003, 0x48000000, STUB_MATCH } } },
+	/* ELFv1: std r2, 40(r1); addis r12, r2, hi; ld r11, lo(r12); mtctr r11;
+		ld r2, lo+8(r12); ld r11, lo+16(r12); bctr */
+	{ "elfv1-env", STUB_BASE_TOC, 0, 7, {
+		{ 0xffffffff, 0xf8410028, STUB_MATCH },
+		{ 0xffff0000, 0x3d820000, STUB_HA },
+		{ 0xffff0003, 0xe96c0000, STUB_LO_DS },
+		{ 0xffffffff, 0x7d6903a6, STUB_MATCH },
+		{ 0xffff0003, 0xe84c0000, STUB_MATCH },
+		{ 0xffff0003, 0xe96c0000, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* ELFv1 without the environment pointer load */
+	{ "elfv1", STUB_BASE_TOC, 0, 6, {
+		{ 0xffffffff, 0xf8410028, STUB_MATCH },
+		{ 0xffff0000, 0x3d820000, STUB_HA },
+		{ 0xffff0003, 0xe96c0000, STUB_LO_DS },
+		{ 0xffffffff, 0x7d6903a6, STUB_MATCH },
+		{ 0xffff0003, 0xe84c0000, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* ELFv2: std r2, 24(r1); addis r12, r2, hi; ld r12, lo(r12); mtctr r12; bctr */
+	{ "elfv2", STUB_BASE_TOC, 0, 5, {
+		{ 0xffffffff, 0xf8410018, STUB_MATCH },
+		{ 0xffff0000, 0x3d820000, STUB_HA },
+		{ 0xffff0003, 0xe98c0000, STUB_LO_DS },
+		{ 0xffffffff, 0x7d8903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* ELFv2, r2 already saved by the caller */
+	{ "elfv2-nosave", STUB_BASE_TOC, 0, 4, {
+		{ 0xffff0000, 0x3d820000, STUB_HA },
+		{ 0xffff0003, 0xe98c0000, STUB_LO_DS },
+		{ 0xffffffff, 0x7d8903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+};
+
+static const PpcStubPattern machoStubPatterns[] = {
+	/* __picsymbolstub1: mflr r0; bcl 20, 31, L1; L1: mflr r11;
+		addis r11, r11, ha16(lazy_ptr - L1); mtlr r0;
+		lwzu r12, lo16(lazy_ptr - L1)(r11); mtctr r12; bctr */
+	{ "picsymbolstub1", STUB_BASE_SELF, 8, 8, {
+		{ 0xffffffff, 0x7c0802a6, STUB_MATCH },
+		{ 0xffffffff, 0x429f0005, STUB_MATCH },
+		{ 0xffffffff, 0x7d6802a6, STUB_MATCH },
+		{ 0xffff0000, 0x3d6b0000, STUB_HA },
+		{ 0xffffffff, 0x7c0803a6, STUB_MATCH },
+		{ 0xffff0000, 0x858b0000, STUB_LO },
+		{ 0xffffffff, 0x7d8903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+	/* __symbol_stub1: lis r11, ha16(lazy_ptr); lwzu r12, lo16(lazy_ptr)(r11);
+		mtctr r12; bctr */
+	{ "symbol_stub1", STUB_BASE_ABS, 0, 4, {
+		{ 0xffff0000, 0x3d600000, STUB_HA },
+		{ 0xffff0000, 0x858b0000, STUB_LO },
+		{ 0xffffffff, 0x7d8903a6, STUB_MATCH },
+		{ 0xffffffff, 0x4e800420, STUB_MATCH } } },
+};
+
+class PpcImportedFunctionRecognizer: public FunctionRecognizer
+{
+	private:
+	/* candidate values of a stub's base register */
+	vector<uint64_t> GetStubBases(BinaryView* data, PpcStubBase base, uint64_t stub)
+	{
+		vector<uint64_t> result;
+		Ref<Section> section;
+		Ref<Symbol> sym;
+
+		switch (base)
+		{
+			case STUB_BASE_ABS:
+				result.push_back(0);
+				break;
+			case STUB_BASE_SELF:
+				result.push_back(stub);
+				break;
+			case STUB_BASE_GOT:
+				/* -fPIC points r30 into the middle of .got2, -fpic at the GOT */
+				if ((section = data->GetSectionByName(".got2")))
+					result.push_back(section->GetStart() + 0x8000);
+				if ((sym = data->GetSymbolByRawName("_GLOBAL_OFFSET_TABLE_")))
+					result.push_back(sym->GetAddress());
+				if ((section = data->GetSectionByName(".got")))
+					result.push_back(section->GetStart());
+				break;
+			case STUB_BASE_TOC:
+				if ((sym = data->GetSymbolByRawName(".TOC.")))
+					result.push_back(sym->GetAddress());
+				if ((section = data->GetSectionByName(".got")))
+					result.push_back(section->GetStart() + 0x8000);
+				if ((section = data->GetSectionByName(".toc")))
+					result.push_back(section->GetStart() + 0x8000);
+				break;
+		}
+
+		return result;
+	}
+
+	bool RecognizeStubs(BinaryView* data, Function* func, const PpcStubPattern* patterns, size_t patternCount)
+	{
+		Ref<Architecture> arch = func->GetArchitecture();
+		uint64_t start = func->GetStart();
+		uint32_t words[STUB_MAX_WORDS];
+		size_t available = 0;
+
+		while (available < STUB_MAX_WORDS && ReadWord(data, arch, start + 4*available, words[available]))
+			available++;
+
+		for (size_t n = 0; n < patternCount; ++n)
+		{
+			const PpcStubPattern& pattern = patterns[n];
+			if (pattern.count > available)
+				continue;
+
+			int64_t offset = 0;
+			size_t i;
+			for (i = 0; i < pattern.count; ++i)
+			{
+				const PpcStubWord& w = pattern.words[i];
+				if ((words[i] & w.mask) != w.value)
+					break;
+
+				switch (w.op)
+				{
+					case STUB_HA: offset += (int64_t)(int16_t)(words[i] & 0xffff) * 0x10000; break;
+					case STUB_LO: offset += (int16_t)(words[i] & 0xffff); break;
+					case STUB_LO_DS: offset += (int16_t)(words[i] & 0xfffc); break;
+					default: break;
+				}
+			}
+
+			if (i != pattern.count)
+				continue;
+
+			MYLOG("matched %s stub at 0x%" PRIx64 "\n", pattern.name, start);
+
+			for (uint64_t base : GetStubBases(data, pattern.base, start))
+			{
+				uint64_t slot = base + pattern.bias + offset;
+				if (arch->GetAddressSize() == 4)
+					slot &= 0xffffffff;
+
+				Ref<Symbol> sym = data->GetSymbolByAddress(slot);
+				if (!sym || sym->GetType() != ImportAddressSymbol)
+					continue;
+
+				data->DefineImportedFunction(sym, func);
+				return true;
+			}
+
+			return false;
+		}
+
+		return false;
+	}
+
+	bool RecognizeELFPLTEntries(BinaryView* data, Function* func, LowLevelILFunction* il)
+	{
+		MYLOG("%s()\n", __func__);
+		(void)il;
+
+		return RecognizeStubs(data, func, stubPatterns, sizeof(stubPatterns) / sizeof(stubPatterns[0]));
+	}
+
+	bool RecognizeMachoPLTEntries(BinaryView* data, Function* func, LowLevelILFunction* il)
+	{
+		MYLOG("%s()\n", __func__);
+		(void)il;
+
+		return RecognizeStubs(data, func, machoStubPatterns, sizeof(machoStubPatterns) / sizeof(machoStubPatterns[0]));
+	}
+
+	public:
+	virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il) override
+	{
+		if (RecognizeELFPLTEntries(data, func, il))
+			return true;
+		else if (RecognizeMachoPLTEntries(data, func, il))
+			return true;
+		return false;
+	}
+};
+
+/* Resolves the bctr at the end of a switch statement:
+
+	lis    r9, table@ha            ; or lwz r9, table@got(r30)
+	addi   r9, r9, table@l
+	cmplwi r3, N                   ; N+1 entries
+	bgt    default
+	slwi   r0, r3, 2
+	lwzx   r0, r9, r0
+	add    r0, r0, r9              ; PIC: entries are relative to the table
+	mtctr  r0
+	bctr
+
+   The targets are handed to the core directly. They live on the function, so
+   the table is walked again whenever the function is (re)created. */
+class PpcSwitchRecognizer: public FunctionRecognizer
+{
+	static const size_t MAX_ENTRIES = 4096;
+
+	/* match "index << 2", allowing for the mask rlwinm puts on the index */
+	bool MatchScaledIndex(LowLevelILFunction* il, size_t i, LowLevelILInstruction expr, uint32_t& reg, size_t& regIndex)
+	{
+		if (!Chase(il, expr, i))
+			return false;
+		if (expr.operation != LLIL_LSL)
+			return false;
+
+		LowLevelILInstruction amount = expr.GetRightExpr<LLIL_LSL>();
+		if (amount.operation != LLIL_CONST || amount.GetConstant() != 2)
+			return false;
+
+		LowLevelILInstruction index = expr.GetLeftExpr<LLIL_LSL>();
+		if (index.operation == LLIL_AND)
+			index = index.GetLeftExpr<LLIL_AND>();
+		if (index.operation != LLIL_REG)
+			return false;
+
+		reg = index.GetSourceRegister<LLIL_REG>();
+		regIndex = i;
+		return true;
+	}
+
+	/* match "[base + (index << 2)].d" */
+	bool MatchTableLoad(BinaryView* data, Architecture* arch, LowLevelILFunction* il, size_t i,
+		LowLevelILInstruction expr, uint64_t& base, uint32_t& reg, size_t& regIndex)
+	{
+		if (!Chase(il, expr, i))
+			return false;
+		if (expr.operation != LLIL_LOAD || expr.size != 4)
+			return false;
+
+		LowLevelILInstruction addr = expr.GetSourceExpr<LLIL_LOAD>();
+		if (!Chase(il, addr, i) || addr.operation != LLIL_ADD)
+			return false;
+
+		LowLevelILInstruction lhs = addr.GetLeftExpr<LLIL_ADD>();
+		LowLevelILInstruction rhs = addr.GetRightExpr<LLIL_ADD>();
+
+		if (MatchScaledIndex(il, i, rhs, reg, regIndex) && Evaluate(data, arch, il, i, lhs, base))
+			return true;
+		if (MatchScaledIndex(il, i, lhs, reg, regIndex) && Evaluate(data, arch, il, i, rhs, base))
+			return true;
+		return false;
+	}
+
+	/* a compare is a flag setting sub, or with cr registers a cr field set
+	 * whose lt bit is ((left < right) << 3) */
+	bool MatchCompare(LowLevelILInstruction instr, LowLevelILInstruction& compare)
+	{
+		if (instr.operation == LLIL_SUB && instr.flags)
+		{
+			compare = instr;
+			return true;
+		}
+
+		if (instr.operation != LLIL_SET_REG)
+			return false;
+		uint32_t dest = instr.GetDestRegister<LLIL_SET_REG>();
+		if (dest < PPC_REG_CR0 || dest > PPC_REG_CR7)
+			return false;
+
+		LowLevelILInstruction expr = instr.GetSourceExpr<LLIL_SET_REG>();
+		for (int n = 0; n < 2 && expr.operation == LLIL_OR; n++)
+			expr = expr.GetLeftExpr<LLIL_OR>();
+		if (expr.operation != LLIL_LSL)
+			return false;
+		expr = expr.GetLeftExpr<LLIL_LSL>();
+		if (expr.operation != LLIL_BOOL_TO_INT)
+			return false;
+		expr = expr.GetSourceExpr<LLIL_BOOL_TO_INT>();
+		if (expr.operation != LLIL_CMP_ULT && expr.operation != LLIL_CMP_SLT)
+			return false;
+
+		compare = expr;
+		return true;
+	}
+
+	/* find "cmplwi index, N" guarding the table, following register copies */
+	bool FindBound(LowLevelILFunction* il, size_t i, uint32_t reg, size_t& count)
+	{
+		for (size_t n = 0; n < IL_SEARCH_WINDOW && i > 0; ++n)
+		{
+			LowLevelILInstruction instr = il->GetInstruction(--i);
+
+			LowLevelILInstruction compare;
+			if (MatchCompare(instr, compare))
+			{
+				LowLevelILInstruction lhs = compare.GetLeftExpr();
+				LowLevelILInstruction rhs = compare.GetRightExpr();
+
+				if (lhs.operation == LLIL_REG && lhs.GetSourceRegister<LLIL_REG>() == reg &&
+					rhs.operation == LLIL_CONST)
+				{
+					count = (size_t)(uint32_t)rhs.GetConstant() + 1;
+					return count <= MAX_ENTRIES;
+				}
+			}
+			else if (instr.operation == LLIL_SET_REG && instr.GetDestRegister<LLIL_SET_REG>() == reg)
+			{
+				LowLevelILInstruction src = instr.GetSourceExpr<LLIL_SET_REG>();
+				if (src.operation != LLIL_REG)
+					return false;
+				reg = src.GetSourceRegister<LLIL_REG>();
+			}
+		}
+
+		return false;
+	}
+
+	bool ResolveJump(BinaryView* data, Architecture* arch, LowLevelILFunction* il, size_t jumpIndex,
+		vector<uint64_t>& targets)
+	{
+		LowLevelILInstruction dest = il->GetInstruction(jumpIndex).GetDestExpr<LLIL_JUMP>();
+		size_t i = jumpIndex;
+		uint64_t base, rel = 0;
+		uint32_t reg;
+		size_t regIndex, count;
+		bool relative = false;
+
+		if (!Chase(il, dest, i))
+			return false;
+
+		if (!MatchTableLoad(data, arch, il, i, dest, base, reg, regIndex))
+		{
+			/* relative table: [base + (index << 2)].d + rel */
+			if (dest.operation != LLIL_ADD)
+				return false;
+
+			LowLevelILInstruction lhs = dest.GetLeftExpr<LLIL_ADD>();
+			LowLevelILInstruction rhs = dest.GetRightExpr<LLIL_ADD>();
+
+			if (MatchTableLoad(data, arch, il, i, lhs, base, reg, regIndex))
+				relative = Evaluate(data, arch, il, i, rhs, rel);
+			else if (MatchTableLoad(data, arch, il, i, rhs, base, reg, regIndex))
+				relative = Evaluate(data, arch, il, i, lhs, rel);
+
+			if (!relative)
+				return false;
+		}
+
+		if (!FindBound(il, regIndex, reg, count))
+			return false;
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			uint32_t entry;
+			if (!ReadWord(data, arch, base + 4*n, entry))
+				return false;
+
+			uint32_t target = relative ? (uint32_t)rel + entry : entry;
+			if ((target & 3) || !data->IsOffsetExecutable(target))
+				return false;
+
+			targets.push_back(target);
+		}
+
+		return !targets.empty();
+	}
+
+	public:
+	virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il) override
+	{
+		Ref<Architecture> arch = func->GetArchitecture();
+
+		for (size_t i = 0; i < il->GetInstructionCount(); ++i)
+		{
+			LowLevelILInstruction jump = il->GetInstruction(i);
+			if (jump.operation != LLIL_JUMP)
+				continue;
+
+			LowLevelILInstruction dest = jump.GetDestExpr<LLIL_JUMP>();
+			if (dest.operation != LLIL_REG || dest.GetSourceRegister<LLIL_REG>() != PPC_REG_CTR)
+				continue;
+
+			vector<uint64_t> targets;
+			if (!ResolveJump(data, arch, il, i, targets))
+				continue;
+
+			vector<ArchAndAddr> branches;
+			for (auto target : targets)
+				branches.push_back(ArchAndAddr(arch, target));
+			func->SetAutoIndirectBranches(arch, jump.address, branches);
+		}
+
+		/* the targets are a side effect, later recognizers still get a look */
+		return false;
+	}
+};
+
+/* Linux system calls: "sc" with a constant in r0. Where the table has a
+	signature, the site gets it as an auto call type adjustment so the
+	arguments in r3..r8 come out typed. */
+/* parsed prototypes per view, keyed on (number << 1) | is64; failures are
+	kept as well so each is only reported once */
+struct PpcSyscallTypes
+{
+	std::mutex mutex;
+	map<uint64_t, Ref<Type>> types;
+};
+
+static PpcViewCache<PpcSyscallTypes> syscallTypes;
+
+class PpcSyscallRecognizer: public FunctionRecognizer
+{
+	Ref<Type> ParseSyscallType(BinaryView* data, const char* name, const ppc_syscall* entry)
+	{
+		if (!entry->ret)
+			return nullptr;
+
+		QualifiedNameAndType result;
+		string errors;
+		string text = string(entry->ret) + " " + name + "(" + entry->args + ")";
+		if (!data->ParseTypeString(text, result, errors))
+		{
+			LogWarn("Failed to parse system call type \"%s\": %s", text.c_str(), errors.c_str());
+			return nullptr;
+		}
+		return result.type;
+	}
+
+	Ref<Type> GetSyscallType(BinaryView* data, uint64_t number, bool is64, const char* name, const ppc_syscall* entry)
+	{
+		auto cache = syscallTypes.Find(data);
+		if (!cache)
+			cache = syscallTypes.Insert(data, make_shared<PpcSyscallTypes>());
+
+		uint64_t key = (number << 1) | (is64 ? 1 : 0);
+		{
+			std::lock_guard<std::mutex> lock(cache->mutex);
+			auto it = cache->types.find(key);
+			if (it != cache->types.end())
+				return it->second;
+		}
+
+		Ref<Type> type = ParseSyscallType(data, name, entry);
+		std::lock_guard<std::mutex> lock(cache->mutex);
+		return cache->types.emplace(key, type).first->second;
+	}
+
+	public:
+	virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il) override
+	{
+		Ref<Architecture> arch = func->GetArchitecture();
+		bool is64 = Is64BitArchitecture(arch);
+
+		for (size_t i = 0; i < il->GetInstructionCount(); ++i)
+		{
+			LowLevelILInstruction instr = il->GetInstruction(i);
+			if (instr.operation != LLIL_SYSCALL)
+				continue;
+
+			LowLevelILInstruction def;
+			size_t defIndex;
+			uint64_t number;
+			if (!FindDefinition(il, i, PPC_REG_R0, def, defIndex))
+				continue;
+			if (!Evaluate(data, arch, il, defIndex, def, number))
+				continue;
+
+			const ppc_syscall* entry = ppc_linux_syscall(number, is64);
+			if (!entry)
+				continue;
+
+			const char* name = (is64 && entry->name64) ? entry->name64 : entry->name;
+			Ref<Type> type = GetSyscallType(data, number, is64, name, entry);
+			if (type)
+				func->SetAutoCallTypeAdjustment(arch, instr.address, Confidence<Ref<Type>>(type));
+		}
+
+		return false;
+	}
+};
+
+/* ELFv1 (big endian ppc64) symbols and function pointers refer to function
+	descriptors in .opd rather than to code:
+
+	.opd:	.quad entry, toc, env
+
+   The descriptors are parsed once per view into a table sorted by address. */
+struct PpcFunctionDescriptor
+{
+	uint64_t addr;
+	uint64_t entry;
+	uint64_t toc;
+	uint64_t env;
+};
+
+static shared_ptr<vector<PpcFunctionDescriptor>> LoadFunctionDescriptors(BinaryView* data)
+{
+	auto table = make_shared<vector<PpcFunctionDescriptor>>();
+
+	Ref<Section> opd = data->GetSectionByName(".opd");
+	if (!opd)
+		return table;
+
+	DataBuffer buf = data->ReadBuffer(opd->GetStart(), opd->GetLength());
+	const uint8_t* bytes = (const uint8_t*)buf.GetData();
+
+	auto quad = [&](size_t offset) {
+		uint64_t value = 0;
+		for (size_t i = 0; i < 8; ++i)
+			value = (value << 8) | bytes[offset + i];
+		return value;
+	};
+
+	for (size_t offset = 0; offset + 24 <= buf.GetLength(); offset += 24)
+	{
+		PpcFunctionDescriptor desc = {opd->GetStart() + offset, quad(offset), quad(offset + 8), quad(offset + 16)};
+		if (desc.entry)
+			table->push_back(desc);
+	}
+
+	sort(table->begin(), table->end(),
+		[](const PpcFunctionDescriptor& a, const PpcFunctionDescriptor& b) { return a.addr < b.addr; });
+	return table;
+}
+
+static PpcViewCache<vector<PpcFunctionDescriptor>> functionDescriptors;
+
+/* the view's descriptors, sorted by address */
+static shared_ptr<vector<PpcFunctionDescriptor>> GetFunctionDescriptors(BinaryView* data)
+{
+	return functionDescriptors.FindOrBuild(data, [&]() { return LoadFunctionDescriptors(data); });
+}
+
+static const PpcFunctionDescriptor* FindFunctionDescriptor(const vector<PpcFunctionDescriptor>& table, uint64_t addr)
+{
+	auto it = lower_bound(table.begin(), table.end(), addr,
+		[](const PpcFunctionDescriptor& desc, uint64_t a) { return desc.addr < a; });
+	if (it == table.end() || it->addr != addr)
+		return nullptr;
+	return &(*it);
+}
+
+/* move the function symbols from the descriptors to the code they describe,
+	and make sure every entry point gets analyzed. Run once per view, when
+	its initial analysis completes. */
+static void DefineFunctionDescriptorEntries(BinaryView* data)
+{
+	Ref<Architecture> arch = data->GetDefaultArchitecture();
+	if (!arch || arch->GetName() != "ppc64")
+		return;
+
+	Ref<Platform> platform = data->GetDefaultPlatform();
+	auto table = GetFunctionDescriptors(data);
+	for (auto& desc : *table)
+	{
+		if (!data->IsOffsetExecutable(desc.entry))
+			continue;
+
+		Ref<Symbol> sym = data->GetSymbolByAddress(desc.addr);
+		if (sym && sym->GetType() == FunctionSymbol)
+		{
+			data->DefineAutoSymbol(new Symbol(DataSymbol, sym->GetShortName(), desc.addr));
+			data->DefineAutoSymbol(new Symbol(FunctionSymbol, sym->GetShortName(), desc.entry));
+		}
+
+		if (data->GetAnalysisFunctionsForAddress(desc.entry).empty())
+			data->AddFunctionForAnalysis(platform, desc.entry);
+	}
+}
+
+class PpcFunctionDescriptorRecognizer: public FunctionRecognizer
+{
+	public:
+	virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il) override
+	{
+		auto table = GetFunctionDescriptors(data);
+		if (table->empty())
+			return false;
+
+		/* a function created on a descriptor is data, analyze the code it
+			describes instead; one the user made is left alone */
+		if (const PpcFunctionDescriptor* desc = FindFunctionDescriptor(*table, func->GetStart()))
+		{
+			if (data->IsOffsetExecutable(desc->entry) && data->GetAnalysisFunctionsForAddress(desc->entry).empty())
+				data->AddFunctionForAnalysis(func->GetPlatform(), desc->entry);
+			if (!func->WasAutomaticallyDiscovered())
+				return false;
+			data->RemoveAnalysisFunction(func);
+			return true;
+		}
+
+		/* calls through a descriptor: ld r0, 0(rX); mtctr r0; bctrl, with rX
+			usually loaded from the TOC */
+		Ref<Architecture> arch = func->GetArchitecture();
+		for (size_t i = 0; i < il->GetInstructionCount(); ++i)
+		{
+			LowLevelILInstruction call = il->GetInstruction(i);
+			if (call.operation != LLIL_CALL)
+				continue;
+
+			LowLevelILInstruction dest = call.GetDestExpr<LLIL_CALL>();
+			size_t defIndex = i;
+			uint64_t addr;
+
+			if (!Chase(il, dest, defIndex))
+				continue;
+			if (dest.operation == LLIL_LOW_PART)
+				dest = dest.GetSourceExpr<LLIL_LOW_PART>();
+			if (dest.operation != LLIL_LOAD || dest.size != 8)
+				continue;
+			if (!Evaluate(data, arch, il, defIndex, dest.GetSourceExpr<LLIL_LOAD>(), addr))
+				continue;
+
+			const PpcFunctionDescriptor* desc = FindFunctionDescriptor(*table, addr);
+			if (desc && data->IsOffsetExecutable(desc->entry) && data->GetAnalysisFunctionsForAddress(desc->entry).empty())
+				data->AddFunctionForAnalysis(func->GetPlatform(), desc->entry);
+		}
+
+		return false;
+	}
+};
+
+/* Out of line register save/restore helpers used by -Os and EABI code. Each
+	family is a ladder of stores (or loads) of rN..r31 relative to a base
+	register, entered part way down depending on the first register saved:
+
+	_savegpr_14:	stw r14, -72(r11)
+	_savegpr_15:	stw r15, -68(r11)
+			...
+			stw r31, -4(r11)
+			blr
+
+   The restore ladders that also reload LR (the _x variants, which pop the
+   frame from r11 too, and _restgpr0_N) return to their caller's caller: they
+   are branched to as the caller's exit. The lifter turns those branches into
+   tail calls by name, so the helpers get named before anything else and the
+   functions branching to them are reanalyzed.
+
+   The helpers get calling conventions that clobber only r0 (and for the
+   restore families, the registers they reload), so calling one doesn't
+   invalidate the rest of the caller's registers. */
+enum PpcLadderTail
+{
+	LADDER_TAIL_BLR,       /* blr */
+	LADDER_TAIL_EXIT,      /* lwz r0, 4(r11); mr r1, r11; mtlr r0; blr */
+	LADDER_TAIL_SAVE_LR,   /* std r0, 16(r1); blr */
+	LADDER_TAIL_RESTORE_LR /* ld r0, 16(r1); mtlr r0; blr */
+};
+
+struct PpcSaveRestoreFamily
+{
+	const char* name;
+	uint32_t opcode; /* primary opcode of the ladder */
+	uint32_t base;   /* base register number */
+	uint32_t size;   /* bytes per register */
+	PpcLadderTail tail;
+};
+
+static const PpcSaveRestoreFamily saveRestoreFamilies[] = {
+	{ "_savegpr_%d", 0x90000000, 11, 4, LADDER_TAIL_BLR },     /* stw */
+	{ "_restgpr_%d_x", 0x80000000, 11, 4, LADDER_TAIL_EXIT },  /* lwz */
+	{ "_restgpr_%d", 0x80000000, 11, 4, LADDER_TAIL_BLR },     /* lwz */
+	{ "_savefpr_%d", 0xd8000000, 11, 8, LADDER_TAIL_BLR },     /* stfd */
+	{ "_restfpr_%d_x", 0xc8000000, 11, 8, LADDER_TAIL_EXIT },  /* lfd */
+	{ "_restfpr_%d", 0xc8000000, 11, 8, LADDER_TAIL_BLR },     /* lfd */
+	{ "_savegpr0_%d", 0xf8000000, 1, 8, LADDER_TAIL_SAVE_LR }, /* std */
+	{ "_restgpr0_%d", 0xe8000000, 1, 8, LADDER_TAIL_RESTORE_LR }, /* ld */
+	{ "_savegpr1_%d", 0xf8000000, 12, 8, LADDER_TAIL_BLR },    /* std */
+	{ "_restgpr1_%d", 0xe8000000, 12, 8, LADDER_TAIL_BLR },    /* ld */
+};
+
+class PpcSaveRestoreRecognizer: public FunctionRecognizer
+{
+	/* the words a tail adds besides the final blr. They are matched as a
+		set, libgcc interleaves them with the end of the ladder:
+
+		_restgpr_31_x:	lwz r0, 4(r11)
+				lwz r31, -4(r11)
+				mtlr r0
+				mr r1, r11
+				blr */
+	static vector<uint32_t> GetTailWords(PpcLadderTail tail)
+	{
+		switch (tail)
+		{
+			case LADDER_TAIL_EXIT: return { 0x800b0004, 0x7d615b78, 0x7c0803a6 };
+			case LADDER_TAIL_SAVE_LR: return { 0xf8010010 };
+			case LADDER_TAIL_RESTORE_LR: return { 0xe8010010, 0x7c0803a6 };
+			default: return {};
+		}
+	}
+
+	/* returns the first register of the ladder entered at addr, or 0 */
+	uint32_t MatchLadder(BinaryView* data, Architecture* arch, uint64_t addr, const PpcSaveRestoreFamily& family)
+	{
+		vector<uint32_t> tail = GetTailWords(family.tail);
+		vector<bool> seen(tail.size(), false);
+		size_t seenCount = 0;
+		uint32_t first = 0, next = 0;
+
+		for (uint32_t n = 0; n < 32 + tail.size(); ++n)
+		{
+			uint32_t iw;
+			if (!ReadWord(data, arch, addr + 4*n, iw))
+				return 0;
+
+			if (iw == 0x4e800020) /* blr */
+				return (next == 32 && seenCount == tail.size()) ? first : 0;
+
+			auto it = find(tail.begin(), tail.end(), iw);
+			if (it != tail.end() && !seen[it - tail.begin()])
+			{
+				seen[it - tail.begin()] = true;
+				seenCount++;
+				continue;
+			}
+
+			if ((iw & 0xfc1f0000) != (family.opcode | (family.base << 16)))
+				return 0;
+
+			uint32_t reg = (iw >> 21) & 0x1f;
+			if (!first)
+			{
+				/* r14..r31 are the non-volatile registers */
+				if (reg < 14)
+					return 0;
+				first = next = reg;
+			}
+			if (reg != next)
+				return 0;
+			if ((int16_t)(iw & 0xffff) != -(int32_t)((32 - reg) * family.size))
+				return 0;
+			next++;
+		}
+
+		return 0;
+	}
+
+	public:
+	virtual bool RecognizeLowLevelIL(BinaryView* data, Function* func, LowLevelILFunction* il) override
+	{
+		(void)il;
+
+		Ref<Architecture> arch = func->GetArchitecture();
+		uint64_t start = func->GetStart();
+
+		for (auto& family : saveRestoreFamilies)
+		{
+			uint32_t first = MatchLadder(data, arch, start, family);
+			if (!first)
+				continue;
+
+			if (!data->GetSymbolByAddress(start))
+			{
+				char name[32];
+				snprintf(name, sizeof(name), family.name, first);
+				data->DefineAutoSymbol(new Symbol(FunctionSymbol, name, start));
+
+				/* branches to an exit were lifted before it had its name */
+				if (family.tail == LADDER_TAIL_EXIT || family.tail == LADDER_TAIL_RESTORE_LR)
+				{
+					for (auto& ref : data->GetCodeReferences(start))
+						if (ref.func)
+							ref.func->Reanalyze();
+				}
+			}
+
+			bool restore = strncmp(family.name, "_rest", 5) == 0;
+			Ref<CallingConvention> conv = arch->GetCallingConventionByName(restore ? "regrestore-helper" : "regsave-helper");
+			if (conv)
+				func->SetAutoCallingConvention(conv);
+			func->SetAutoCanReturn(true);
+			return true;
+		}
+
+		return false;
+	}
+};
+
+/* EABI small data areas: r13 points 0x8000 into .sdata/.sbss and r2 points
+	0x8000 into .sdata2/.sbss2, so a signed 16-bit offset reaches the whole area.
+	Neither is ever written after startup, which lets the calling convention
+	hand their values to every function instead of leaving each access for
+	dataflow to resolve.
+
+   The bases come from the _SDA_BASE_/_SDA2_BASE_ symbols, or from the code
+   crt0 runs to set the registers up. The calling convention keeps them per
+   view and drops them whenever one of those symbols changes. */
+struct PpcSmallDataBases
+{
+	bool hasSda, hasSda2;
+	uint64_t sda, sda2;
+	bool fromSymbols; /* both came from their symbols and won't change */
+};
+
+/* how much of each startup routine is searched for the register setup */
+#define STARTUP_SEARCH_WINDOW 0x100
+
+/* where crt0 sets r13 and r2: the entry point, and __eabi which EABI
+	startup code calls on the way to main */
+static vector<uint64_t> GetStartupCode(BinaryView* view)
+{
+	vector<uint64_t> result;
+	if (view->GetEntryPoint())
+		result.push_back(view->GetEntryPoint());
+	for (const char* name : {"_start", "__start", "__eabi"})
+	{
+		Ref<Symbol> sym = view->GetSymbolByRawName(name);
+		if (sym && find(result.begin(), result.end(), sym->GetAddress()) == result.end())
+			result.push_back(sym->GetAddress());
+	}
+	return result;
+}
+
+/* same as below in VLE: e_lis rN, hi; e_add16i rN, rN, lo | e_add2i. rN, lo |
+	e_or2i rN, lo. 32-bit VLE instructions are only halfword aligned. */
+static bool FindVleRegisterInit(BinaryView* view, uint64_t start, uint32_t reg, uint64_t& value)
+{
+	uint32_t lis = 0x7000e000 | (reg << 21);
+	uint32_t add16i = 0x1c000000 | (reg << 21) | (reg << 16);
+	uint32_t add2i = 0x70008800 | (reg << 16);
+	uint32_t or2i = 0x7000c000 | (reg << 21);
+
+	DataBuffer buf = view->ReadBuffer(start & ~1ULL, STARTUP_SEARCH_WINDOW);
+	const uint8_t* bytes = (const uint8_t*)buf.GetData();
+	size_t len = buf.GetLength() & ~1ULL;
+
+	auto word = [&](size_t offset) {
+		return ((uint32_t)bytes[offset] << 24) | ((uint32_t)bytes[offset + 1] << 16) |
+			((uint32_t)bytes[offset + 2] << 8) | (uint32_t)bytes[offset + 3];
+	};
+
+	for (size_t offset = 0; offset + 8 <= len; offset += 2)
+	{
+		uint32_t iw = word(offset);
+		if ((iw & 0xffe0f800) != lis)
+			continue;
+
+		uint32_t hi = ((iw >> 16) & 0x1f) << 11 | (iw & 0x7ff);
+		uint32_t lo = word(offset + 4);
+		if ((lo & 0xffff0000) == add16i)
+			value = ((hi << 16) + (int16_t)(lo & 0xffff)) & 0xffffffff;
+		else if ((lo & 0xfc1ff800) == add2i)
+			value = ((hi << 16) + (int16_t)(((lo >> 21) & 0x1f) << 11 | (lo & 0x7ff))) & 0xffffffff;
+		else if ((lo & 0xffe0f800) == or2i)
+			value = (hi << 16) | ((lo >> 16) & 0x1f) << 11 | (lo & 0x7ff);
+		else
+			continue;
+		return true;
+	}
+
+	return false;
+}
+
+/* look for the crt0 initialization: lis rN, hi; addi|ori rN, rN, lo */
+static bool FindRegisterInit(BinaryView* view, uint64_t start, uint32_t reg, uint64_t& value)
+{
+	Ref<Architecture> arch = view->GetDefaultArchitecture();
+	if (arch && arch->GetName() == "ppc_vle")
+		return FindVleRegisterInit(view, start, reg, value);
+
+	bool lil_end = view->GetDefaultEndianness() == LittleEndian;
+	uint32_t lis = 0x3c000000 | (reg << 21);
+	uint32_t addi = 0x38000000 | (reg << 21) | (reg << 16);
+	uint32_t ori = 0x60000000 | (reg << 21) | (reg << 16);
+
+	DataBuffer buf = view->ReadBuffer(start & ~3ULL, STARTUP_SEARCH_WINDOW);
+	const uint8_t* bytes = (const uint8_t*)buf.GetData();
+	size_t count = buf.GetLength() / 4;
+
+	auto word = [&](size_t i) {
+		uint32_t iw = *(const uint32_t*)(bytes + 4 * i);
+		return lil_end ? iw : bswap32(iw);
+	};
+
+	for (size_t i = 0; i < count; i++)
+	{
+		uint32_t iw = word(i);
+		if ((iw & 0xffff0000) != lis)
+			continue;
+
+		/* the low half usually follows directly, allow a little scheduling */
+		for (size_t j = i + 1; j < count && j <= i + 4; j++)
+		{
+			uint32_t lo = word(j);
+			if ((lo & 0xffff0000) == addi)
+			{
+				value = ((uint64_t)(iw & 0xffff) << 16) + (int16_t)(lo & 0xffff);
+				value &= 0xffffffff;
+				return true;
+			}
+			if ((lo & 0xffff0000) == ori)
+			{
+				value = ((iw & 0xffff) << 16) | (lo & 0xffff);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/* symbol first, then the startup code, then (for relocations, where the
+	linker would have defined the symbol that way) the section */
+static bool FindSmallDataBase(BinaryView* view, const vector<uint64_t>& startup, const char* symbol,
+	const char* section, uint32_t reg, uint64_t& value, bool& fromSymbol)
+{
+	fromSymbol = false;
+	Ref<Symbol> sym = view->GetSymbolByRawName(symbol);
+	if (sym)
+	{
+		value = sym->GetAddress();
+		fromSymbol = true;
+		return true;
+	}
+
+	for (uint64_t start : startup)
+		if (FindRegisterInit(view, start, reg, value))
+			return true;
+
+	Ref<Section> sec = section ? view->GetSectionByName(section) : nullptr;
+	if (sec)
+	{
+		value = sec->GetStart() + 0x8000;
+		return true;
+	}
+
+	return false;
+}
+
+static PpcSmallDataBases GetSmallDataBases(BinaryView* view, bool sectionFallback)
+{
+	PpcSmallDataBases result = {};
+	vector<uint64_t> startup = GetStartupCode(view);
+	bool sdaSymbol, sda2Symbol;
+
+	result.hasSda = FindSmallDataBase(view, startup, "_SDA_BASE_", sectionFallback ? ".sdata" : nullptr,
+		13, result.sda, sdaSymbol);
+	/* r2 is the thread pointer under the Linux ABI, so a lone .sdata2 is not
+		enough to claim it */
+	result.hasSda2 = FindSmallDataBase(view, startup, "_SDA2_BASE_", nullptr, 2, result.sda2, sda2Symbol);
+	result.fromSymbols = sdaSymbol && sda2Symbol;
+	return result;
+}
+
+/* shared objects are position independent and never set up r13/r2 */
+static bool IsSharedObject(BinaryView* view)
+{
+	if (view->GetTypeName() != "ELF")
+		return false;
+
+	Ref<BinaryView> raw = view->GetParentView();
+	uint8_t type[2];
+	if (!raw || raw->Read(type, 16, sizeof(type)) != sizeof(type))
+		return false;
+
+	uint16_t e_type = (view->GetDefaultEndianness() == LittleEndian) ? (type[0] | (type[1] << 8)) : ((type[0] << 8) | type[1]);
+	return e_type == 3; /* ET_DYN */
+}
+
+/* what the calling convention hands out for r13/r2 */
+struct PpcSmallDataInfo
+{
+	bool sharedObject;
+	PpcSmallDataBases bases;
+};
+
+static PpcViewCache<PpcSmallDataInfo> smallDataInfo;
+
+/* the symbols the bases are found through */
+static bool IsSmallDataSymbol(const string& name)
+{
+	for (const char* symbol : {"_SDA_BASE_", "_SDA2_BASE_", "_start", "__start", "__eabi"})
+		if (name == symbol)
+			return true;
+	return false;
+}
+
+/* drops a view's small data bases when one of those symbols changes */
+class PpcSmallDataWatcher: public BinaryDataNotification, public PpcViewCacheBase
+{
+	std::mutex mutex;
+	set<BNBinaryView*> views;
+
+	void SymbolChanged(BinaryView* view, Symbol* sym)
+	{
+		if (IsSmallDataSymbol(sym->GetRawName()))
+			smallDataInfo.Evict(view);
+	}
+
+	public:
+	void Watch(BinaryView* view)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (views.insert(view->GetObject()).second)
+			view->RegisterNotification(this);
+	}
+
+	virtual void Evict(BinaryView* view) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (views.erase(view->GetObject()))
+			view->UnregisterNotification(this);
+	}
+
+	virtual void OnSymbolAdded(BinaryView* view, Symbol* sym) override { SymbolChanged(view, sym); }
+	virtual void OnSymbolUpdated(BinaryView* view, Symbol* sym) override { SymbolChanged(view, sym); }
+	virtual void OnSymbolRemoved(BinaryView* view, Symbol* sym) override { SymbolChanged(view, sym); }
+};
+
+static PpcSmallDataWatcher smallDataWatcher;
+
+static shared_ptr<PpcSmallDataInfo> GetSmallDataInfo(BinaryView* view)
+{
+	return smallDataInfo.FindOrBuild(view, [&]() {
+		smallDataWatcher.Watch(view);
+
+		auto info = make_shared<PpcSmallDataInfo>();
+		info->sharedObject = IsSharedObject(view);
+		if (!info->sharedObject)
+			info->bases = GetSmallDataBases(view, false);
+		return info;
+	});
+}
+
+/* ppc64 TOC pointer. r2 holds .TOC. (0x8000 into the module's .got) on entry
+	to every function, so it can be handed to the function as a constant. The
+	value is worked out per function, preferring what the function itself
+	says over the module wide default:
+
+	- ELFv1: the toc word of the .opd descriptor for the entry point
+	- ELFv2: the addis r2, r12 / addi r2, r2 pair at the global entry
+	- otherwise: the .TOC. symbol, or .got + 0x8000 */
+struct PpcTocTable
+{
+	bool hasDefault;
+	uint64_t defaultToc;
+	map<uint64_t, uint64_t> descriptors; /* entry -> toc */
+};
+
+static PpcViewCache<PpcTocTable> tocTables;
+
+static shared_ptr<PpcTocTable> GetTocTable(BinaryView* view)
+{
+	auto table = tocTables.Find(view);
+	if (table)
+		return table;
+
+	table = make_shared<PpcTocTable>();
+	Ref<Symbol> sym;
+	Ref<Section> section;
+	if ((sym = view->GetSymbolByRawName(".TOC.")))
+		table->defaultToc = sym->GetAddress(), table->hasDefault = true;
+	else if ((section = view->GetSectionByName(".got")))
+		table->defaultToc = section->GetStart() + 0x8000, table->hasDefault = true;
+
+	for (auto& desc : *GetFunctionDescriptors(view))
+		if (desc.toc)
+			table->descriptors[desc.entry] = desc.toc;
+
+	return tocTables.Insert(view, table);
+}
+
+static bool GetTocBase(Function* func, uint64_t& toc)
+{
+	Ref<BinaryView> view = func->GetView();
+	Ref<Architecture> arch = func->GetArchitecture();
+	uint64_t start = func->GetStart();
+	auto table = GetTocTable(view.GetPtr());
+
+	auto desc = table->descriptors.find(start);
+	if (desc != table->descriptors.end())
+	{
+		toc = desc->second;
+		return true;
+	}
+
+	/* the function may be either the global entry or the local entry after it */
+	for (uint64_t global : {start, start - 8})
+	{
+		uint32_t iw0, iw1;
+		if (global > start)
+			continue;
+		if (!ReadWord(view.GetPtr(), arch.GetPtr(), global, iw0) || !ReadWord(view.GetPtr(), arch.GetPtr(), global + 4, iw1))
+			continue;
+		if (!IsElfV2GlobalEntry(iw0, iw1))
+			continue;
+
+		toc = global + ((int64_t)(int16_t)(iw0 & 0xffff) * 0x10000) + (int16_t)(iw1 & 0xffff);
+		return true;
+	}
+
+	if (!table->hasDefault)
+		return false;
+	toc = table->defaultToc;
+	return true;
+}
+
+/* 32-bit SVR4 ABI, also the base of the other conventions below: r3-r10 and
+	f1-f8 carry arguments, r14-r31, f14-f31 and cr2-cr4 are preserved. r2 is
+	reserved for the system and r13 anchors the small data area. */
+class PpcSvr4CallingConvention: public CallingConvention
+{
+public:
+	PpcSvr4CallingConvention(Architecture* arch, const string& name = "svr4"): CallingConvention(arch, name)
+	{
+	}
+
+
+	virtual vector<uint32_t> GetIntegerArgumentRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
+			PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10
+			/* remaining arguments onto stack */
+		};
+	}
+
+
+	virtual vector<uint32_t> GetFloatArgumentRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_F1, PPC_REG_F2, PPC_REG_F3, PPC_REG_F4,
+			PPC_REG_F5, PPC_REG_F6, PPC_REG_F7, PPC_REG_F8
+		};
+	}
+
+
+	virtual vector<uint32_t> GetCallerSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R0, PPC_REG_R3, PPC_REG_R4, PPC_REG_R5,
+			PPC_REG_R6, PPC_REG_R7, PPC_REG_R8, PPC_REG_R9,
+			PPC_REG_R10, PPC_REG_R11, PPC_REG_R12,
+
+			PPC_REG_F0, PPC_REG_F1, PPC_REG_F2, PPC_REG_F3,
+			PPC_REG_F4, PPC_REG_F5, PPC_REG_F6, PPC_REG_F7,
+			PPC_REG_F8, PPC_REG_F9, PPC_REG_F10, PPC_REG_F11,
+			PPC_REG_F12, PPC_REG_F13,
+
+			PPC_REG_CR0, PPC_REG_CR1, PPC_REG_CR5, PPC_REG_CR6,
+			PPC_REG_CR7,
+
+			PPC_REG_LR, PPC_REG_CTR,
+		};
+	}
+
+
+	virtual vector<uint32_t> GetCalleeSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R14, PPC_REG_R15, PPC_REG_R16, PPC_REG_R17,
+			PPC_REG_R18, PPC_REG_R19, PPC_REG_R20, PPC_REG_R21,
+			PPC_REG_R22, PPC_REG_R23, PPC_REG_R24, PPC_REG_R25,
+			PPC_REG_R26, PPC_REG_R27, PPC_REG_R28, PPC_REG_R29,
+			PPC_REG_R30, PPC_REG_R31,
 
-	virtual vector<uint32_t> GetIntegerArgumentRegisters() override
+			PPC_REG_F14, PPC_REG_F15, PPC_REG_F16, PPC_REG_F17,
+			PPC_REG_F18, PPC_REG_F19, PPC_REG_F20, PPC_REG_F21,
+			PPC_REG_F22, PPC_REG_F23, PPC_REG_F24, PPC_REG_F25,
+			PPC_REG_F26, PPC_REG_F27, PPC_REG_F28, PPC_REG_F29,
+			PPC_REG_F30, PPC_REG_F31,
+
+			PPC_REG_CR2, PPC_REG_CR3, PPC_REG_CR4
+		};
+	}
+
+
+	virtual uint32_t GetGlobalPointerRegister() override
+	{
+		return PPC_REG_R13;
+	}
+
+
+	/* r13 (and r2 under the EABI) are the small data bases */
+	virtual RegisterValue GetIncomingRegisterValue(uint32_t reg, Function* func) override
+	{
+		RegisterValue result;
+		if (!func || (reg != PPC_REG_R13 && reg != PPC_REG_R2))
+			return CallingConvention::GetIncomingRegisterValue(reg, func);
+
+		/* on ppc64 r2 is the TOC pointer and r13 the thread pointer */
+		if (Is64BitArchitecture(GetArchitecture()))
+			return CallingConvention::GetIncomingRegisterValue(reg, func);
+
+		Ref<BinaryView> view = func->GetView();
+		auto info = GetSmallDataInfo(view.GetPtr());
+		if (info->sharedObject)
+			return CallingConvention::GetIncomingRegisterValue(reg, func);
+
+		const PpcSmallDataBases& bases = info->bases;
+		if (reg == PPC_REG_R13 && bases.hasSda)
+		{
+			result.state = ConstantPointerValue;
+			result.value = bases.sda;
+			return result;
+		}
+		if (reg == PPC_REG_R2 && bases.hasSda2)
+		{
+			result.state = ConstantPointerValue;
+			result.value = bases.sda2;
+			return result;
+		}
+		return CallingConvention::GetIncomingRegisterValue(reg, func);
+	}
+
+
+	virtual uint32_t GetIntegerReturnValueRegister() override
+	{
+		return PPC_REG_R3;
+	}
+
+
+	virtual uint32_t GetHighIntegerReturnValueRegister() override
+	{
+		return PPC_REG_R4;
+	}
+
+
+	virtual uint32_t GetFloatReturnValueRegister() override
+	{
+		return PPC_REG_F1;
+	}
+};
+
+/* embedded ABI on cores without a classic FPU (e200, e500): floating point
+	values travel in GPRs, so the FPRs play no part in calls */
+class PpcEabiCallingConvention: public PpcSvr4CallingConvention
+{
+public:
+	PpcEabiCallingConvention(Architecture* arch): PpcSvr4CallingConvention(arch, "eabi")
+	{
+	}
+
+
+	virtual vector<uint32_t> GetFloatArgumentRegisters() override
+	{
+		return vector<uint32_t>();
+	}
+
+
+	virtual vector<uint32_t> GetCallerSavedRegisters() override
 	{
 		return vector<uint32_t>{
-			PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
-			PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10
-			/* remaining arguments onto stack */
+			PPC_REG_R0, PPC_REG_R3, PPC_REG_R4, PPC_REG_R5,
+			PPC_REG_R6, PPC_REG_R7, PPC_REG_R8, PPC_REG_R9,
+			PPC_REG_R10, PPC_REG_R11, PPC_REG_R12,
+
+			PPC_REG_CR0, PPC_REG_CR1, PPC_REG_CR5, PPC_REG_CR6,
+			PPC_REG_CR7,
+
+			PPC_REG_LR, PPC_REG_CTR,
+		};
+	}
+
+
+	virtual vector<uint32_t> GetCalleeSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R14, PPC_REG_R15, PPC_REG_R16, PPC_REG_R17,
+			PPC_REG_R18, PPC_REG_R19, PPC_REG_R20, PPC_REG_R21,
+			PPC_REG_R22, PPC_REG_R23, PPC_REG_R24, PPC_REG_R25,
+			PPC_REG_R26, PPC_REG_R27, PPC_REG_R28, PPC_REG_R29,
+			PPC_REG_R30, PPC_REG_R31,
+
+			PPC_REG_CR2, PPC_REG_CR3, PPC_REG_CR4
 		};
 	}
 
 
+	virtual uint32_t GetFloatReturnValueRegister() override
+	{
+		return BN_INVALID_REGISTER;
+	}
+};
+
+/* 64-bit ELFv1 (big endian Linux): r3-r10 and f1-f13 carry arguments, and
+	every argument also occupies a slot in the caller's parameter save area,
+	so a float consumes a GPR as well. r2 is the TOC pointer, restored by the
+	caller after any call that may leave the module. */
+class PpcElfV1CallingConvention: public PpcSvr4CallingConvention
+{
+public:
+	PpcElfV1CallingConvention(Architecture* arch, const string& name = "elfv1"): PpcSvr4CallingConvention(arch, name)
+	{
+	}
+
+
 	virtual vector<uint32_t> GetFloatArgumentRegisters() override
 	{
 		return vector<uint32_t>{
@@ -2192,18 +4297,39 @@ public:
 	}
 
 
+	virtual bool AreArgumentRegistersSharedIndex() override
+	{
+		return true;
+	}
+
+
+	virtual bool IsStackReservedForArgumentRegisters() override
+	{
+		return true;
+	}
+
+
 	virtual vector<uint32_t> GetCallerSavedRegisters() override
 	{
 		return vector<uint32_t>{
-			PPC_REG_R0, PPC_REG_R2, PPC_REG_R3, PPC_REG_R4,
-			PPC_REG_R5, PPC_REG_R6, PPC_REG_R7, PPC_REG_R8,
-			PPC_REG_R9, PPC_REG_R10, PPC_REG_R12,
+			PPC_REG_R0, PPC_REG_R3, PPC_REG_R4, PPC_REG_R5,
+			PPC_REG_R6, PPC_REG_R7, PPC_REG_R8, PPC_REG_R9,
+			PPC_REG_R10, PPC_REG_R11, PPC_REG_R12,
 
 			PPC_REG_F0, PPC_REG_F1, PPC_REG_F2, PPC_REG_F3,
 			PPC_REG_F4, PPC_REG_F5, PPC_REG_F6, PPC_REG_F7,
 			PPC_REG_F8, PPC_REG_F9, PPC_REG_F10, PPC_REG_F11,
 			PPC_REG_F12, PPC_REG_F13,
 
+			PPC_REG_V0, PPC_REG_V1, PPC_REG_V2, PPC_REG_V3,
+			PPC_REG_V4, PPC_REG_V5, PPC_REG_V6, PPC_REG_V7,
+			PPC_REG_V8, PPC_REG_V9, PPC_REG_V10, PPC_REG_V11,
+			PPC_REG_V12, PPC_REG_V13, PPC_REG_V14, PPC_REG_V15,
+			PPC_REG_V16, PPC_REG_V17, PPC_REG_V18, PPC_REG_V19,
+
+			PPC_REG_CR0, PPC_REG_CR1, PPC_REG_CR5, PPC_REG_CR6,
+			PPC_REG_CR7,
+
 			PPC_REG_LR, PPC_REG_CTR,
 		};
 	}
@@ -2212,18 +4338,171 @@ public:
 	virtual vector<uint32_t> GetCalleeSavedRegisters() override
 	{
 		return vector<uint32_t>{
+			PPC_REG_R2,
 			PPC_REG_R14, PPC_REG_R15, PPC_REG_R16, PPC_REG_R17,
 			PPC_REG_R18, PPC_REG_R19, PPC_REG_R20, PPC_REG_R21,
 			PPC_REG_R22, PPC_REG_R23, PPC_REG_R24, PPC_REG_R25,
 			PPC_REG_R26, PPC_REG_R27, PPC_REG_R28, PPC_REG_R29,
-			PPC_REG_R30, PPC_REG_R31
+			PPC_REG_R30, PPC_REG_R31,
+
+			PPC_REG_F14, PPC_REG_F15, PPC_REG_F16, PPC_REG_F17,
+			PPC_REG_F18, PPC_REG_F19, PPC_REG_F20, PPC_REG_F21,
+			PPC_REG_F22, PPC_REG_F23, PPC_REG_F24, PPC_REG_F25,
+			PPC_REG_F26, PPC_REG_F27, PPC_REG_F28, PPC_REG_F29,
+			PPC_REG_F30, PPC_REG_F31,
+
+			PPC_REG_V20, PPC_REG_V21, PPC_REG_V22, PPC_REG_V23,
+			PPC_REG_V24, PPC_REG_V25, PPC_REG_V26, PPC_REG_V27,
+			PPC_REG_V28, PPC_REG_V29, PPC_REG_V30, PPC_REG_V31,
+
+			PPC_REG_CR2, PPC_REG_CR3, PPC_REG_CR4
 		};
 	}
 
 
+	/* r13 is the thread pointer here */
 	virtual uint32_t GetGlobalPointerRegister() override
 	{
-		return PPC_REG_R13;
+		return PPC_REG_R2;
+	}
+
+
+	virtual RegisterValue GetIncomingRegisterValue(uint32_t reg, Function* func) override
+	{
+		RegisterValue result;
+		uint64_t toc;
+		if (func && reg == PPC_REG_R2 && GetTocBase(func, toc))
+		{
+			result.state = ConstantPointerValue;
+			result.value = toc;
+			return result;
+		}
+		return CallingConvention::GetIncomingRegisterValue(reg, func);
+	}
+};
+
+/* 64-bit ELFv2 (little endian Linux): the ELFv1 register usage, but the
+	parameter save area is only allocated when some argument actually goes
+	to the stack, and callers of a global entry point pass its address in r12 */
+class PpcElfV2CallingConvention: public PpcElfV1CallingConvention
+{
+public:
+	PpcElfV2CallingConvention(Architecture* arch, const string& name = "elfv2"): PpcElfV1CallingConvention(arch, name)
+	{
+	}
+
+
+	virtual RegisterValue GetIncomingRegisterValue(uint32_t reg, Function* func) override
+	{
+		if (func && reg == PPC_REG_R12)
+		{
+			Ref<BinaryView> view = func->GetView();
+			Ref<Architecture> arch = func->GetArchitecture();
+			uint32_t iw0, iw1;
+			if (ReadWord(view.GetPtr(), arch.GetPtr(), func->GetStart(), iw0) &&
+				ReadWord(view.GetPtr(), arch.GetPtr(), func->GetStart() + 4, iw1) &&
+				IsElfV2GlobalEntry(iw0, iw1))
+			{
+				RegisterValue result;
+				result.state = ConstantPointerValue;
+				result.value = func->GetStart();
+				return result;
+			}
+		}
+		return PpcElfV1CallingConvention::GetIncomingRegisterValue(reg, func);
+	}
+};
+
+/* Darwin (Mac OS X), which follows the AIX register usage: r3-r10 and f1-f13
+	carry arguments with floats also consuming GPRs, r13-r31 are preserved and
+	r2 is an ordinary volatile register. No small data area. */
+class PpcDarwinCallingConvention: public CallingConvention
+{
+public:
+	PpcDarwinCallingConvention(Architecture* arch, const string& name = "darwin"): CallingConvention(arch, name)
+	{
+	}
+
+
+	virtual vector<uint32_t> GetIntegerArgumentRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
+			PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10
+		};
+	}
+
+
+	virtual vector<uint32_t> GetFloatArgumentRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_F1, PPC_REG_F2, PPC_REG_F3, PPC_REG_F4,
+			PPC_REG_F5, PPC_REG_F6, PPC_REG_F7, PPC_REG_F8,
+			PPC_REG_F9, PPC_REG_F10, PPC_REG_F11, PPC_REG_F12,
+			PPC_REG_F13
+		};
+	}
+
+
+	virtual bool AreArgumentRegistersSharedIndex() override
+	{
+		return true;
+	}
+
+
+	virtual bool IsStackReservedForArgumentRegisters() override
+	{
+		return true;
+	}
+
+
+	virtual vector<uint32_t> GetCallerSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R0, PPC_REG_R2, PPC_REG_R3, PPC_REG_R4,
+			PPC_REG_R5, PPC_REG_R6, PPC_REG_R7, PPC_REG_R8,
+			PPC_REG_R9, PPC_REG_R10, PPC_REG_R11, PPC_REG_R12,
+
+			PPC_REG_F0, PPC_REG_F1, PPC_REG_F2, PPC_REG_F3,
+			PPC_REG_F4, PPC_REG_F5, PPC_REG_F6, PPC_REG_F7,
+			PPC_REG_F8, PPC_REG_F9, PPC_REG_F10, PPC_REG_F11,
+			PPC_REG_F12, PPC_REG_F13,
+
+			PPC_REG_V0, PPC_REG_V1, PPC_REG_V2, PPC_REG_V3,
+			PPC_REG_V4, PPC_REG_V5, PPC_REG_V6, PPC_REG_V7,
+			PPC_REG_V8, PPC_REG_V9, PPC_REG_V10, PPC_REG_V11,
+			PPC_REG_V12, PPC_REG_V13, PPC_REG_V14, PPC_REG_V15,
+			PPC_REG_V16, PPC_REG_V17, PPC_REG_V18, PPC_REG_V19,
+
+			PPC_REG_CR0, PPC_REG_CR1, PPC_REG_CR5, PPC_REG_CR6,
+			PPC_REG_CR7,
+
+			PPC_REG_LR, PPC_REG_CTR,
+		};
+	}
+
+
+	virtual vector<uint32_t> GetCalleeSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R13, PPC_REG_R14, PPC_REG_R15, PPC_REG_R16,
+			PPC_REG_R17, PPC_REG_R18, PPC_REG_R19, PPC_REG_R20,
+			PPC_REG_R21, PPC_REG_R22, PPC_REG_R23, PPC_REG_R24,
+			PPC_REG_R25, PPC_REG_R26, PPC_REG_R27, PPC_REG_R28,
+			PPC_REG_R29, PPC_REG_R30, PPC_REG_R31,
+
+			PPC_REG_F14, PPC_REG_F15, PPC_REG_F16, PPC_REG_F17,
+			PPC_REG_F18, PPC_REG_F19, PPC_REG_F20, PPC_REG_F21,
+			PPC_REG_F22, PPC_REG_F23, PPC_REG_F24, PPC_REG_F25,
+			PPC_REG_F26, PPC_REG_F27, PPC_REG_F28, PPC_REG_F29,
+			PPC_REG_F30, PPC_REG_F31,
+
+			PPC_REG_V20, PPC_REG_V21, PPC_REG_V22, PPC_REG_V23,
+			PPC_REG_V24, PPC_REG_V25, PPC_REG_V26, PPC_REG_V27,
+			PPC_REG_V28, PPC_REG_V29, PPC_REG_V30, PPC_REG_V31,
+
+			PPC_REG_CR2, PPC_REG_CR3, PPC_REG_CR4
+		};
 	}
 
 
@@ -2233,38 +4512,149 @@ public:
 	}
 
 
+	virtual uint32_t GetHighIntegerReturnValueRegister() override
+	{
+		return PPC_REG_R4;
+	}
+
+
 	virtual uint32_t GetFloatReturnValueRegister() override
 	{
-		return PPC_REG_F1;
+		return PPC_REG_F1;
+	}
+};
+
+/* AIX: the Darwin register usage, except that r2 is the TOC pointer */
+class PpcAixCallingConvention: public PpcDarwinCallingConvention
+{
+public:
+	PpcAixCallingConvention(Architecture* arch): PpcDarwinCallingConvention(arch, "aix")
+	{
+	}
+
+
+	virtual vector<uint32_t> GetCallerSavedRegisters() override
+	{
+		vector<uint32_t> regs = PpcDarwinCallingConvention::GetCallerSavedRegisters();
+		regs.erase(std::remove(regs.begin(), regs.end(), (uint32_t)PPC_REG_R2), regs.end());
+		return regs;
+	}
+
+
+	virtual vector<uint32_t> GetCalleeSavedRegisters() override
+	{
+		vector<uint32_t> regs = PpcDarwinCallingConvention::GetCalleeSavedRegisters();
+		regs.insert(regs.begin(), PPC_REG_R2);
+		return regs;
+	}
+
+
+	virtual uint32_t GetGlobalPointerRegister() override
+	{
+		return PPC_REG_R2;
+	}
+};
+
+class PpcLinuxSyscallCallingConvention: public CallingConvention
+{
+public:
+	PpcLinuxSyscallCallingConvention(Architecture* arch): CallingConvention(arch, "linux-syscall")
+	{
+	}
+
+	virtual vector<uint32_t> GetIntegerArgumentRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R0,
+			PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
+			PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10
+		};
+	}
+
+	virtual vector<uint32_t> GetCallerSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R3
+		};
+	}
+
+	virtual vector<uint32_t> GetCalleeSavedRegisters() override
+	{
+		return vector<uint32_t>{
+			PPC_REG_R14, PPC_REG_R15, PPC_REG_R16, PPC_REG_R17,
+			PPC_REG_R18, PPC_REG_R19, PPC_REG_R20, PPC_REG_R21,
+			PPC_REG_R22, PPC_REG_R23, PPC_REG_R24, PPC_REG_R25,
+			PPC_REG_R26, PPC_REG_R27, PPC_REG_R28, PPC_REG_R29,
+			PPC_REG_R30, PPC_REG_R31
+		};
+	}
+
+	virtual uint32_t GetIntegerReturnValueRegister() override
+	{
+		return PPC_REG_R3;
+	}
+
+	virtual bool IsEligibleForHeuristics() override
+	{
+		return false;
 	}
 };
 
-class PpcLinuxSyscallCallingConvention: public CallingConvention
+/* the out of line register save/restore helpers take the frame address in
+	r11 (r1 or r12 for the ppc64 families). The save helpers only read the
+	registers their caller is preserving, the restore helpers write them. */
+class PpcSaveRestoreCallingConvention: public CallingConvention
 {
+	bool restore;
+
 public:
-	PpcLinuxSyscallCallingConvention(Architecture* arch): CallingConvention(arch, "linux-syscall")
+	PpcSaveRestoreCallingConvention(Architecture* arch, bool restore):
+		CallingConvention(arch, restore ? "regrestore-helper" : "regsave-helper"), restore(restore)
 	{
 	}
 
 	virtual vector<uint32_t> GetIntegerArgumentRegisters() override
 	{
 		return vector<uint32_t>{
-			PPC_REG_R0,
-			PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
-			PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10
+			PPC_REG_R11, PPC_REG_R12
 		};
 	}
 
 	virtual vector<uint32_t> GetCallerSavedRegisters() override
 	{
+		if (!restore)
+			return vector<uint32_t>{
+				PPC_REG_R0
+			};
+
 		return vector<uint32_t>{
-			PPC_REG_R3
+			PPC_REG_R0,
+			PPC_REG_R14, PPC_REG_R15, PPC_REG_R16, PPC_REG_R17,
+			PPC_REG_R18, PPC_REG_R19, PPC_REG_R20, PPC_REG_R21,
+			PPC_REG_R22, PPC_REG_R23, PPC_REG_R24, PPC_REG_R25,
+			PPC_REG_R26, PPC_REG_R27, PPC_REG_R28, PPC_REG_R29,
+			PPC_REG_R30, PPC_REG_R31,
+			PPC_REG_F14, PPC_REG_F15, PPC_REG_F16, PPC_REG_F17,
+			PPC_REG_F18, PPC_REG_F19, PPC_REG_F20, PPC_REG_F21,
+			PPC_REG_F22, PPC_REG_F23, PPC_REG_F24, PPC_REG_F25,
+			PPC_REG_F26, PPC_REG_F27, PPC_REG_F28, PPC_REG_F29,
+			PPC_REG_F30, PPC_REG_F31
 		};
 	}
 
 	virtual vector<uint32_t> GetCalleeSavedRegisters() override
 	{
+		if (restore)
+			return vector<uint32_t>{
+				PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
+				PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10,
+				PPC_REG_R11, PPC_REG_R12
+			};
+
 		return vector<uint32_t>{
+			PPC_REG_R3, PPC_REG_R4, PPC_REG_R5, PPC_REG_R6,
+			PPC_REG_R7, PPC_REG_R8, PPC_REG_R9, PPC_REG_R10,
+			PPC_REG_R11, PPC_REG_R12,
 			PPC_REG_R14, PPC_REG_R15, PPC_REG_R16, PPC_REG_R17,
 			PPC_REG_R18, PPC_REG_R19, PPC_REG_R20, PPC_REG_R21,
 			PPC_REG_R22, PPC_REG_R23, PPC_REG_R24, PPC_REG_R25,
@@ -2289,61 +4679,440 @@ uint16_t bswap16(uint16_t x)
 	return (x >> 8) | (x << 8);
 }
 
+/* how an ELF relocation is written: which bits of the word it patches, what the
+   value is measured against, and which 16-bit slice of the value goes in */
+enum PpcElfRelocField
+{
+	FIELD_UNHANDLED = 0,
+	FIELD_NONE,        /* marker or linker allocated slot, nothing to patch */
+	FIELD_WORD32,
+	FIELD_WORD64,
+	FIELD_WORD30,      /* word with the low 2 bits preserved */
+	FIELD_HALF16,
+	FIELD_HALF16_DS,   /* halfword with the low 2 bits preserved */
+	FIELD_LOW24,       /* I-form branch target */
+	FIELD_LOW14,       /* B-form branch target */
+	FIELD_LOW14_TAKEN,
+	FIELD_LOW14_NTAKEN,
+	FIELD_SDA21        /* D-form with rA chosen from the small data area */
+};
+
+enum PpcElfRelocValue
+{
+	VALUE_ABS = 0,     /* S + A */
+	VALUE_TARGET,      /* S, for the dynamic linker slots */
+	VALUE_BASE,        /* image base + A */
+	VALUE_PCREL,       /* S + A - P */
+	VALUE_NEG,         /* A - S */
+	VALUE_TOC,         /* S + A - .TOC. */
+	VALUE_TOC_BASE,    /* .TOC. */
+	VALUE_SDA,         /* S + A - _SDA_BASE_ */
+	VALUE_SDA2,        /* S + A - _SDA2_BASE_ */
+	VALUE_SDA21,       /* whichever of the above fits, see FIELD_SDA21 */
+	VALUE_SECTOFF,     /* S + A - start of the section holding S */
+	VALUE_TPREL,       /* S + A - thread pointer */
+	VALUE_DTPREL       /* S + A - dynamic thread vector pointer */
+};
+
+enum PpcElfRelocPart
+{
+	PART_FULL = 0,
+	PART_LO,
+	PART_HI,
+	PART_HA,
+	PART_HIGHER,
+	PART_HIGHERA,
+	PART_HIGHEST,
+	PART_HIGHESTA
+};
+
+struct PpcElfRelocShape
+{
+	uint8_t field;
+	uint8_t value;
+	uint8_t part;
+};
+
+/* ELF relocation numbers all fit in a byte, so each ABI gets a flat table
+   indexed by type and applying a relocation is one lookup */
+static const PpcElfRelocShape* GetElfRelocShapes(bool is64Bit)
+{
+	static PpcElfRelocShape shapes32[256];
+	static PpcElfRelocShape shapes64[256];
+	static std::once_flag once;
+	std::call_once(once, []() {
+		auto add = [](uint32_t type, uint8_t field, uint8_t value, uint8_t part = PART_FULL) {
+			shapes32[type] = shapes64[type] = {field, value, part};
+		};
+		auto add32 = [](uint32_t type, uint8_t field, uint8_t value, uint8_t part = PART_FULL) {
+			shapes32[type] = {field, value, part};
+		};
+		auto add64 = [](uint32_t type, uint8_t field, uint8_t value, uint8_t part = PART_FULL) {
+			shapes64[type] = {field, value, part};
+		};
+
+		/* shared by both ABIs */
+		add(R_PPC_NONE, FIELD_NONE, VALUE_ABS);
+		add(R_PPC_ADDR32, FIELD_WORD32, VALUE_ABS);
+		add(R_PPC_ADDR24, FIELD_LOW24, VALUE_ABS);
+		add(R_PPC_ADDR16, FIELD_HALF16, VALUE_ABS);
+		add(R_PPC_ADDR16_LO, FIELD_HALF16, VALUE_ABS, PART_LO);
+		add(R_PPC_ADDR16_HI, FIELD_HALF16, VALUE_ABS, PART_HI);
+		add(R_PPC_ADDR16_HA, FIELD_HALF16, VALUE_ABS, PART_HA);
+		add(R_PPC_ADDR14, FIELD_LOW14, VALUE_ABS);
+		add(R_PPC_ADDR14_BRTAKEN, FIELD_LOW14_TAKEN, VALUE_ABS);
+		add(R_PPC_ADDR14_BRNTAKEN, FIELD_LOW14_NTAKEN, VALUE_ABS);
+		add(R_PPC_REL24, FIELD_LOW24, VALUE_PCREL);
+		add(R_PPC_REL14, FIELD_LOW14, VALUE_PCREL);
+		add(R_PPC_REL14_BRTAKEN, FIELD_LOW14_TAKEN, VALUE_PCREL);
+		add(R_PPC_REL14_BRNTAKEN, FIELD_LOW14_NTAKEN, VALUE_PCREL);
+		/* GOT and PLT slots are allocated by the linker, an object file has nowhere
+		   for them to point yet */
+		for (uint32_t type = R_PPC_GOT16; type <= R_PPC_GOT16_HA; type++)
+			add(type, FIELD_NONE, VALUE_ABS);
+		add(R_PPC_UADDR32, FIELD_WORD32, VALUE_ABS);
+		add(R_PPC_UADDR16, FIELD_HALF16, VALUE_ABS);
+		add(R_PPC_REL32, FIELD_WORD32, VALUE_PCREL);
+		add(R_PPC_PLT32, FIELD_WORD32, VALUE_ABS);
+		add(R_PPC_PLTREL32, FIELD_WORD32, VALUE_PCREL);
+		add(R_PPC_PLT16_LO, FIELD_HALF16, VALUE_ABS, PART_LO);
+		add(R_PPC_PLT16_HI, FIELD_HALF16, VALUE_ABS, PART_HI);
+		add(R_PPC_PLT16_HA, FIELD_HALF16, VALUE_ABS, PART_HA);
+		add(R_PPC_SECTOFF, FIELD_HALF16, VALUE_SECTOFF);
+		add(R_PPC_SECTOFF_LO, FIELD_HALF16, VALUE_SECTOFF, PART_LO);
+		add(R_PPC_SECTOFF_HI, FIELD_HALF16, VALUE_SECTOFF, PART_HI);
+		add(R_PPC_SECTOFF_HA, FIELD_HALF16, VALUE_SECTOFF, PART_HA);
+		add(R_PPC_TLS, FIELD_NONE, VALUE_ABS);
+		add(R_PPC_TPREL16, FIELD_HALF16, VALUE_TPREL);
+		add(R_PPC_TPREL16_LO, FIELD_HALF16, VALUE_TPREL, PART_LO);
+		add(R_PPC_TPREL16_HI, FIELD_HALF16, VALUE_TPREL, PART_HI);
+		add(R_PPC_TPREL16_HA, FIELD_HALF16, VALUE_TPREL, PART_HA);
+		add(R_PPC_DTPREL16, FIELD_HALF16, VALUE_DTPREL);
+		add(R_PPC_DTPREL16_LO, FIELD_HALF16, VALUE_DTPREL, PART_LO);
+		add(R_PPC_DTPREL16_HI, FIELD_HALF16, VALUE_DTPREL, PART_HI);
+		add(R_PPC_DTPREL16_HA, FIELD_HALF16, VALUE_DTPREL, PART_HA);
+		for (uint32_t type = R_PPC_GOT_TLSGD16; type <= R_PPC_GOT_DTPREL16_HA; type++)
+			add(type, FIELD_NONE, VALUE_ABS);
+		add(R_PPC_REL16, FIELD_HALF16, VALUE_PCREL);
+		add(R_PPC_REL16_LO, FIELD_HALF16, VALUE_PCREL, PART_LO);
+		add(R_PPC_REL16_HI, FIELD_HALF16, VALUE_PCREL, PART_HI);
+		add(R_PPC_REL16_HA, FIELD_HALF16, VALUE_PCREL, PART_HA);
+
+		/* 32-bit only */
+		add32(R_PPC_PLTREL24, FIELD_LOW24, VALUE_PCREL);
+		add32(R_PPC_COPY, FIELD_WORD32, VALUE_TARGET);
+		add32(R_PPC_GLOB_DAT, FIELD_WORD32, VALUE_TARGET);
+		add32(R_PPC_JMP_SLOT, FIELD_WORD32, VALUE_TARGET);
+		add32(R_PPC_RELATIVE, FIELD_WORD32, VALUE_BASE);
+		add32(R_PPC_LOCAL24PC, FIELD_LOW24, VALUE_PCREL);
+		add32(R_PPC_SDAREL16, FIELD_HALF16, VALUE_SDA);
+		add32(R_PPC_DTPMOD32, FIELD_NONE, VALUE_ABS);
+		add32(R_PPC_TPREL32, FIELD_WORD32, VALUE_TPREL);
+		add32(R_PPC_DTPREL32, FIELD_WORD32, VALUE_DTPREL);
+		add32(R_PPC_EMB_NADDR32, FIELD_WORD32, VALUE_NEG);
+		add32(R_PPC_EMB_NADDR16, FIELD_HALF16, VALUE_NEG);
+		add32(R_PPC_EMB_NADDR16_LO, FIELD_HALF16, VALUE_NEG, PART_LO);
+		add32(R_PPC_EMB_NADDR16_HI, FIELD_HALF16, VALUE_NEG, PART_HI);
+		add32(R_PPC_EMB_NADDR16_HA, FIELD_HALF16, VALUE_NEG, PART_HA);
+		add32(R_PPC_EMB_SDAI16, FIELD_NONE, VALUE_ABS);
+		add32(R_PPC_EMB_SDA2I16, FIELD_NONE, VALUE_ABS);
+		add32(R_PPC_EMB_SDA2REL, FIELD_HALF16, VALUE_SDA2);
+		add32(R_PPC_EMB_SDA21, FIELD_SDA21, VALUE_SDA21);
+		add32(R_PPC_EMB_MRKREF, FIELD_NONE, VALUE_ABS);
+		add32(R_PPC_EMB_RELSDA, FIELD_HALF16, VALUE_SDA21);
+		add32(R_PPC_DIAB_SDA21_LO, FIELD_SDA21, VALUE_SDA21, PART_LO);
+		add32(R_PPC_DIAB_SDA21_HI, FIELD_SDA21, VALUE_SDA21, PART_HI);
+		add32(R_PPC_DIAB_SDA21_HA, FIELD_SDA21, VALUE_SDA21, PART_HA);
+		add32(R_PPC_DIAB_RELSDA_LO, FIELD_HALF16, VALUE_SDA21, PART_LO);
+		add32(R_PPC_DIAB_RELSDA_HI, FIELD_HALF16, VALUE_SDA21, PART_HI);
+		add32(R_PPC_DIAB_RELSDA_HA, FIELD_HALF16, VALUE_SDA21, PART_HA);
+		add32(R_PPC_IRELATIVE, FIELD_WORD32, VALUE_BASE);
+		add32(R_PPC_TOC16, FIELD_HALF16, VALUE_TOC);
+
+		/* 64-bit only */
+		add64(R_PPC_COPY, FIELD_WORD64, VALUE_TARGET);
+		add64(R_PPC_GLOB_DAT, FIELD_WORD64, VALUE_TARGET);
+		add64(R_PPC_JMP_SLOT, FIELD_WORD64, VALUE_TARGET);
+		add64(R_PPC_RELATIVE, FIELD_WORD64, VALUE_BASE);
+		add64(R_PPC64_ADDR30, FIELD_WORD30, VALUE_PCREL);
+		add64(R_PPC64_ADDR64, FIELD_WORD64, VALUE_ABS);
+		add64(R_PPC64_ADDR16_HIGHER, FIELD_HALF16, VALUE_ABS, PART_HIGHER);
+		add64(R_PPC64_ADDR16_HIGHERA, FIELD_HALF16, VALUE_ABS, PART_HIGHERA);
+		add64(R_PPC64_ADDR16_HIGHEST, FIELD_HALF16, VALUE_ABS, PART_HIGHEST);
+		add64(R_PPC64_ADDR16_HIGHESTA, FIELD_HALF16, VALUE_ABS, PART_HIGHESTA);
+		add64(R_PPC64_UADDR64, FIELD_WORD64, VALUE_ABS);
+		add64(R_PPC64_REL64, FIELD_WORD64, VALUE_PCREL);
+		add64(R_PPC64_PLT64, FIELD_WORD64, VALUE_ABS);
+		add64(R_PPC64_PLTREL64, FIELD_WORD64, VALUE_PCREL);
+		add64(R_PPC64_TOC16, FIELD_HALF16, VALUE_TOC);
+		add64(R_PPC64_TOC16_LO, FIELD_HALF16, VALUE_TOC, PART_LO);
+		add64(R_PPC64_TOC16_HI, FIELD_HALF16, VALUE_TOC, PART_HI);
+		add64(R_PPC64_TOC16_HA, FIELD_HALF16, VALUE_TOC, PART_HA);
+		add64(R_PPC64_TOC, FIELD_WORD64, VALUE_TOC_BASE);
+		for (uint32_t type = R_PPC64_PLTGOT16; type <= R_PPC64_PLTGOT16_HA; type++)
+			add64(type, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_ADDR16_DS, FIELD_HALF16_DS, VALUE_ABS);
+		add64(R_PPC64_ADDR16_LO_DS, FIELD_HALF16_DS, VALUE_ABS, PART_LO);
+		add64(R_PPC64_GOT16_DS, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_GOT16_LO_DS, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_PLT16_LO_DS, FIELD_HALF16_DS, VALUE_ABS, PART_LO);
+		add64(R_PPC64_SECTOFF_DS, FIELD_HALF16_DS, VALUE_SECTOFF);
+		add64(R_PPC64_SECTOFF_LO_DS, FIELD_HALF16_DS, VALUE_SECTOFF, PART_LO);
+		add64(R_PPC64_TOC16_DS, FIELD_HALF16_DS, VALUE_TOC);
+		add64(R_PPC64_TOC16_LO_DS, FIELD_HALF16_DS, VALUE_TOC, PART_LO);
+		add64(R_PPC64_PLTGOT16_DS, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_PLTGOT16_LO_DS, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_DTPMOD64, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_TPREL64, FIELD_WORD64, VALUE_TPREL);
+		add64(R_PPC64_DTPREL64, FIELD_WORD64, VALUE_DTPREL);
+		add64(R_PPC64_TPREL16_DS, FIELD_HALF16_DS, VALUE_TPREL);
+		add64(R_PPC64_TPREL16_LO_DS, FIELD_HALF16_DS, VALUE_TPREL, PART_LO);
+		add64(R_PPC64_TPREL16_HIGHER, FIELD_HALF16, VALUE_TPREL, PART_HIGHER);
+		add64(R_PPC64_TPREL16_HIGHERA, FIELD_HALF16, VALUE_TPREL, PART_HIGHERA);
+		add64(R_PPC64_TPREL16_HIGHEST, FIELD_HALF16, VALUE_TPREL, PART_HIGHEST);
+		add64(R_PPC64_TPREL16_HIGHESTA, FIELD_HALF16, VALUE_TPREL, PART_HIGHESTA);
+		add64(R_PPC64_DTPREL16_DS, FIELD_HALF16_DS, VALUE_DTPREL);
+		add64(R_PPC64_DTPREL16_LO_DS, FIELD_HALF16_DS, VALUE_DTPREL, PART_LO);
+		add64(R_PPC64_DTPREL16_HIGHER, FIELD_HALF16, VALUE_DTPREL, PART_HIGHER);
+		add64(R_PPC64_DTPREL16_HIGHERA, FIELD_HALF16, VALUE_DTPREL, PART_HIGHERA);
+		add64(R_PPC64_DTPREL16_HIGHEST, FIELD_HALF16, VALUE_DTPREL, PART_HIGHEST);
+		add64(R_PPC64_DTPREL16_HIGHESTA, FIELD_HALF16, VALUE_DTPREL, PART_HIGHESTA);
+		add64(R_PPC64_TLSGD, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_TLSLD, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_TOCSAVE, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_ADDR16_HIGH, FIELD_HALF16, VALUE_ABS, PART_HI);
+		add64(R_PPC64_ADDR16_HIGHA, FIELD_HALF16, VALUE_ABS, PART_HA);
+		add64(R_PPC64_TPREL16_HIGH, FIELD_HALF16, VALUE_TPREL, PART_HI);
+		add64(R_PPC64_TPREL16_HIGHA, FIELD_HALF16, VALUE_TPREL, PART_HA);
+		add64(R_PPC64_DTPREL16_HIGH, FIELD_HALF16, VALUE_DTPREL, PART_HI);
+		add64(R_PPC64_DTPREL16_HIGHA, FIELD_HALF16, VALUE_DTPREL, PART_HA);
+		add64(R_PPC64_REL24_NOTOC, FIELD_LOW24, VALUE_PCREL);
+		add64(R_PPC64_ADDR64_LOCAL, FIELD_WORD64, VALUE_ABS);
+		add64(R_PPC64_ENTRY, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC64_JMP_IREL, FIELD_NONE, VALUE_ABS);
+		add64(R_PPC_IRELATIVE, FIELD_WORD64, VALUE_BASE);
+	});
+	return is64Bit ? shapes64 : shapes32;
+}
+
+/* the anchors the relative relocation forms are measured from, looked up when
+   a relocation needs them and kept per view once nothing in them is a guess */
+struct PpcElfRelocBases
+{
+	bool hasToc, hasSda, hasSda2, hasTls;
+	uint64_t toc, sda, sda2, tls;
+};
+
+template <BNEndianness endian, bool is64Bit>
 class PpcElfRelocationHandler: public RelocationHandler
 {
+	PpcViewCache<PpcElfRelocBases> bases;
+
+	/* fields are accessed a byte at a time, the UADDR forms are unaligned */
+	static inline uint16_t Read16(const uint8_t* p)
+	{
+		if (endian == LittleEndian)
+			return (uint16_t)(p[0] | (p[1] << 8));
+		return (uint16_t)((p[0] << 8) | p[1]);
+	}
+
+	static inline uint32_t Read32(const uint8_t* p)
+	{
+		if (endian == LittleEndian)
+			return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+		return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+	}
+
+	static inline void Write(uint8_t* p, uint64_t value, size_t size)
+	{
+		for (size_t i = 0; i < size; i++)
+		{
+			size_t shift = (endian == LittleEndian) ? i : (size - 1 - i);
+			p[i] = (uint8_t)(value >> (8 * shift));
+		}
+	}
+
+	static inline uint64_t Part(uint64_t value, uint8_t part)
+	{
+		switch (part)
+		{
+		case PART_LO: return value & 0xffff;
+		case PART_HI: return (value >> 16) & 0xffff;
+		case PART_HA: return HA(value);
+		case PART_HIGHER: return (value >> 32) & 0xffff;
+		case PART_HIGHERA: return ((value + 0x8000) >> 32) & 0xffff;
+		case PART_HIGHEST: return (value >> 48) & 0xffff;
+		case PART_HIGHESTA: return ((value + 0x8000) >> 48) & 0xffff;
+		default: return value;
+		}
+	}
+
+	static size_t FieldSize(uint8_t field)
+	{
+		switch (field)
+		{
+		case FIELD_HALF16:
+		case FIELD_HALF16_DS:
+			return 2;
+		case FIELD_WORD64:
+			return 8;
+		default:
+			return 4;
+		}
+	}
+
+	static PpcElfRelocBases LookupBases(BinaryView* view, bool& final)
+	{
+		PpcElfRelocBases result = {};
+		Ref<Symbol> sym;
+		Ref<Section> section;
+
+		/* the TOC pointer sits 0x8000 into the GOT so a signed 16-bit offset spans it */
+		if ((sym = view->GetSymbolByRawName(".TOC.")))
+			result.toc = sym->GetAddress(), result.hasToc = true;
+		else if ((section = view->GetSectionByName(".got")))
+			result.toc = section->GetStart() + 0x8000, result.hasToc = true;
+
+		final = true;
+		if (!is64Bit)
+		{
+			PpcSmallDataBases sda = GetSmallDataBases(view, true);
+			result.sda = sda.sda, result.hasSda = sda.hasSda;
+			result.sda2 = sda.sda2, result.hasSda2 = sda.hasSda2;
+			final = sda.fromSymbols;
+		}
+
+		if ((section = view->GetSectionByName(".tdata")) || (section = view->GetSectionByName(".tbss")))
+			result.tls = section->GetStart(), result.hasTls = true;
+		return result;
+	}
+
+	PpcElfRelocBases GetBases(BinaryView* view)
+	{
+		auto anchors = bases.Find(view);
+		if (anchors)
+			return *anchors;
+
+		/* a guess made before the SDA symbols are defined is not kept */
+		bool final;
+		PpcElfRelocBases result = LookupBases(view, final);
+		if (final)
+			bases.Insert(view, make_shared<PpcElfRelocBases>(result));
+		return result;
+	}
+
+	static bool FitsSigned16(int64_t value)
+	{
+		return value >= -0x8000 && value < 0x8000;
+	}
+
 public:
 	virtual bool ApplyRelocation(Ref<BinaryView> view, Ref<Architecture> arch, Ref<Relocation> reloc, uint8_t* dest, size_t len) override
 	{
-		(void)view;
-		(void)len;
+		(void)arch;
 		auto info = reloc->GetInfo();
-		uint32_t* dest32 = (uint32_t*)dest;
-		uint16_t* dest16 = (uint16_t*)dest;
-		auto swap = [&arch](uint32_t x) { return (arch->GetEndianness() == LittleEndian)? x : bswap32(x); };
-		auto swap16 = [&arch](uint16_t x) { return (arch->GetEndianness() == LittleEndian)? x : bswap16(x); };
+		if (info.nativeType > 0xff)
+			return false;
+		const PpcElfRelocShape& shape = GetElfRelocShapes(is64Bit)[info.nativeType];
+		if (shape.field == FIELD_UNHANDLED || shape.field == FIELD_NONE)
+			return true;
+		if (len < FieldSize(shape.field))
+			return false;
+
 		uint64_t target = reloc->GetTarget();
-		switch (info.nativeType)
+		uint64_t value = target + info.addend;
+		uint32_t sdaReg = 0;
+		switch (shape.value)
 		{
-		case R_PPC_ADDR16_LO:
-			dest16[0] = swap16((uint16_t)((target + info.addend) & 0xffff));
+		case VALUE_ABS:
 			break;
-		case R_PPC_ADDR16_HA:
-			dest16[0] = swap16((uint16_t)((target + info.addend) >> 16));
+		case VALUE_TARGET:
+			value = target;
 			break;
-		case R_PPC_REL24:
-			dest32[0] = swap((swap(dest32[0]) & 0xfc000003) |
-				(uint32_t)((((target + info.addend - reloc->GetAddress()) >> 2) & 0xffffff) << 2));
+		case VALUE_BASE:
+			value = info.base;
+			break;
+		case VALUE_PCREL:
+			value -= reloc->GetAddress();
+			break;
+		case VALUE_NEG:
+			value = info.addend - target;
+			break;
+		default:
+		{
+			PpcElfRelocBases anchors = GetBases(view.GetPtr());
+			switch (shape.value)
+			{
+			case VALUE_TOC:
+				value -= anchors.toc;
+				break;
+			case VALUE_TOC_BASE:
+				value = anchors.toc;
+				break;
+			case VALUE_SDA:
+				value -= anchors.sda;
+				break;
+			case VALUE_SDA2:
+				value -= anchors.sda2;
+				break;
+			case VALUE_SDA21:
+				/* r13 addresses .sdata, r2 addresses .sdata2, r0 means absolute */
+				if (anchors.hasSda && FitsSigned16(value - anchors.sda))
+					value -= anchors.sda, sdaReg = 13;
+				else if (anchors.hasSda2 && FitsSigned16(value - anchors.sda2))
+					value -= anchors.sda2, sdaReg = 2;
+				break;
+			case VALUE_SECTOFF:
+			{
+				auto sections = view->GetSectionsAt(target);
+				if (!sections.empty())
+					value -= sections[0]->GetStart();
+				break;
+			}
+			case VALUE_TPREL:
+				/* variant I TLS, the thread pointer is biased 0x7000 past the block */
+				value -= anchors.tls + 0x7000;
+				break;
+			case VALUE_DTPREL:
+				value -= anchors.tls + 0x8000;
+				break;
+			}
 			break;
-		case R_PPC_REL16_HA:
-			dest16[0] = swap16(HA(target - reloc->GetAddress() + info.addend));
+		}
+		}
+		value = Part(value, shape.part);
+
+		switch (shape.field)
+		{
+		case FIELD_WORD32:
+			Write(dest, value, 4);
 			break;
-		case R_PPC_REL16_HI:
-			dest16[0] = swap16((uint16_t)((target - reloc->GetAddress()+ info.addend) >> 16));
+		case FIELD_WORD64:
+			Write(dest, value, 8);
 			break;
-		case R_PPC_REL16_LO:
-			dest16[0] = swap16((uint16_t)((target - reloc->GetAddress()+ info.addend) & 0xffff));
+		case FIELD_WORD30:
+			Write(dest, (Read32(dest) & 3) | (value & 0xfffffffc), 4);
 			break;
-		case R_PPC_JMP_SLOT:
-		case R_PPC_GLOB_DAT:
-		case R_PPC_COPY:
-			dest32[0] = swap((uint32_t)target);
+		case FIELD_HALF16:
+			Write(dest, value, 2);
 			break;
-		case R_PPC_PLTREL24:
-			dest32[0] = swap((swap(dest32[0]) & 0xfc000003) |
-				(uint32_t)((((target + info.addend - reloc->GetAddress()) >> 2) & 0xffffff) << 2));
+		case FIELD_HALF16_DS:
+			Write(dest, (Read16(dest) & 3) | (value & 0xfffc), 2);
 			break;
-		case R_PPC_LOCAL24PC:
-			dest32[0] = swap((swap(dest32[0]) & 0xfc000003) |
-				(uint32_t)((((target + info.addend - reloc->GetAddress()) >> 2) & 0xffffff) << 2));
+		case FIELD_LOW24:
+			Write(dest, (Read32(dest) & 0xfc000003) | (value & 0x03fffffc), 4);
 			break;
-		case R_PPC_ADDR32:
-			dest32[0] = swap((uint32_t)(target + info.addend));
+		case FIELD_LOW14:
+			Write(dest, (Read32(dest) & 0xffff0003) | (value & 0xfffc), 4);
 			break;
-		case R_PPC_RELATIVE:
-			dest32[0] = swap((uint32_t)info.base);
+		case FIELD_LOW14_TAKEN:
+			Write(dest, (Read32(dest) & 0xffff0003) | (value & 0xfffc) | 0x00200000, 4);
 			break;
-		case R_PPC_REL32:
-			dest32[0] = swap((uint32_t)(target - reloc->GetAddress() + info.addend));
+		case FIELD_LOW14_NTAKEN:
+			Write(dest, (Read32(dest) & 0xffdf0003) | (value & 0xfffc), 4);
+			break;
+		case FIELD_SDA21:
+			Write(dest, (Read32(dest) & 0xffe00000) | (sdaReg << 16) | (value & 0xffff), 4);
 			break;
 		}
 		return true;
@@ -2351,19 +5120,33 @@ public:
 
 	virtual bool GetRelocationInfo(Ref<BinaryView> view, Ref<Architecture> arch, vector<BNRelocationInfo>& result) override
 	{
-		(void)view; (void)arch; (void)result;
+		(void)view;
+		(void)arch;
+		const PpcElfRelocShape* shapes = GetElfRelocShapes(is64Bit);
 		set<uint64_t> relocTypes;
 		for (auto& reloc : result)
 		{
 			reloc.type = StandardRelocationType;
-			reloc.size = 4;
 			reloc.pcRelative = false;
 			reloc.dataRelocation = false;
-			switch (reloc.nativeType)
+			PpcElfRelocShape shape = {};
+			if (reloc.nativeType <= 0xff)
+				shape = shapes[reloc.nativeType];
+			reloc.size = FieldSize(shape.field);
+			switch (shape.field)
 			{
-			case R_PPC_NONE:
+			case FIELD_UNHANDLED:
+				reloc.type = UnhandledRelocation;
+				relocTypes.insert(reloc.nativeType);
+				continue;
+			case FIELD_NONE:
 				reloc.type = IgnoredRelocation;
+				continue;
+			default:
 				break;
+			}
+			switch (reloc.nativeType)
+			{
 			case R_PPC_COPY:
 				reloc.type = ELFCopyRelocationType;
 				break;
@@ -2373,42 +5156,32 @@ public:
 			case R_PPC_JMP_SLOT:
 				reloc.type = ELFJumpSlotRelocationType;
 				break;
-			case R_PPC_ADDR16_HA:
-			case R_PPC_ADDR16_LO:
-				reloc.size = 2;
-				break;
-			case R_PPC_REL16_HA:
-			case R_PPC_REL16_HI:
-			case R_PPC_REL16_LO:
-				reloc.size = 2;
-				reloc.pcRelative = true;
-				break;
-			case R_PPC_REL24:
-			case R_PPC_PLTREL24:
-				reloc.pcRelative = true;
-				break;
-			case R_PPC_ADDR32:
-				reloc.dataRelocation = true;
+			}
+			switch (shape.value)
+			{
+			case VALUE_ABS:
+				reloc.dataRelocation = (shape.field == FIELD_WORD32 || shape.field == FIELD_WORD64);
 				break;
-			case R_PPC_RELATIVE:
+			case VALUE_BASE:
 				reloc.dataRelocation = true;
 				reloc.baseRelative = true;
 				reloc.base += reloc.addend;
 				break;
-			case R_PPC_REL32:
-				reloc.pcRelative = true;
-				break;
-			case R_PPC_LOCAL24PC:
+			case VALUE_PCREL:
 				reloc.pcRelative = true;
 				break;
 			default:
-				reloc.type = UnhandledRelocation;
-				relocTypes.insert(reloc.nativeType);
 				break;
 			}
 		}
+
 		for (auto& reloc : relocTypes)
-			LogWarn("Unsupported ELF relocation type: %s", GetRelocationString((ElfPpcRelocationType)reloc));
+		{
+			if (is64Bit)
+				LogWarn("Unsupported ELF relocation type: %s", GetRelocationString((ElfPpc64RelocationType)reloc));
+			else
+				LogWarn("Unsupported ELF relocation type: %s", GetRelocationString((ElfPpcRelocationType)reloc));
+		}
 		return true;
 	}
 
@@ -2420,14 +5193,16 @@ public:
 		(void)length;
 		(void)il;
 		auto info = relocation->GetInfo();
-		switch (info.nativeType)
+		if (info.nativeType > 0xff)
+			return BN_AUTOCOERCE_EXTERN_PTR;
+		/* only the low half of a split address can stand in for the pointer */
+		switch (GetElfRelocShapes(is64Bit)[info.nativeType].part)
 		{
-		case R_PPC_ADDR16_HA:
-		case R_PPC_REL16_HA:
-		case R_PPC_REL16_HI:
-			return BN_NOCOERCE_EXTERN_PTR;
-		default:
+		case PART_FULL:
+		case PART_LO:
 			return BN_AUTOCOERCE_EXTERN_PTR;
+		default:
+			return BN_NOCOERCE_EXTERN_PTR;
 		}
 	}
 };
@@ -2435,21 +5210,204 @@ public:
 class PpcMachoRelocationHandler: public RelocationHandler
 {
 public:
+	virtual bool ApplyRelocation(Ref<BinaryView> view, Ref<Architecture> arch, Ref<Relocation> reloc, uint8_t* dest, size_t len) override
+	{
+		(void)view;
+		(void)len;
+		auto info = reloc->GetInfo();
+		uint32_t* dest32 = (uint32_t*)dest;
+		uint16_t* dest16 = (uint16_t*)dest;
+		auto swap = [&arch](uint32_t x) { return (arch->GetEndianness() == LittleEndian)? x : bswap32(x); };
+		auto swap16 = [&arch](uint16_t x) { return (arch->GetEndianness() == LittleEndian)? x : bswap16(x); };
+		uint64_t target = reloc->GetTarget() + info.addend;
+		/* the half word relocations point at the instruction, not the field */
+		uint16_t* imm16 = (arch->GetEndianness() == LittleEndian) ? &dest16[0] : &dest16[1];
+		if (info.nativeType == PPC_RELOC_HI16 || info.nativeType == PPC_RELOC_HA16 || info.nativeType == PPC_RELOC_LO16)
+		{
+			/* the instruction holds one half of the value and the PAIR the
+				other, see GetRelocationInfo(). An external reference builds
+				symbol + value, a local one is already in place. */
+			uint32_t half = swap16(*imm16);
+			uint32_t other = (uint32_t)info.addend & 0xffff;
+			uint32_t value;
+			if (info.nativeType == PPC_RELOC_LO16)
+				value = (other << 16) | half;
+			else if (info.nativeType == PPC_RELOC_HA16)
+				value = (half << 16) + (int16_t)other;
+			else
+				value = (half << 16) | other;
+			target = info.external ? reloc->GetTarget() + value : value;
+		}
+		switch (info.nativeType)
+		{
+		case PPC_RELOC_VANILLA:
+		case PPC_RELOC_PB_LA_PTR:
+			dest32[0] = swap((uint32_t)target);
+			break;
+		case PPC_RELOC_BR24:
+			dest32[0] = swap((swap(dest32[0]) & 0xfc000003) |
+				(uint32_t)((target - (info.pcRelative ? reloc->GetAddress() : 0)) & 0x03fffffc));
+			break;
+		case PPC_RELOC_BR14:
+			dest32[0] = swap((swap(dest32[0]) & 0xffff0003) |
+				(uint32_t)((target - (info.pcRelative ? reloc->GetAddress() : 0)) & 0xfffc));
+			break;
+		case PPC_RELOC_LO14:
+			dest32[0] = swap((swap(dest32[0]) & 0xffff0003) | (uint32_t)(target & 0xfffc));
+			break;
+		case PPC_RELOC_HI16:
+			*imm16 = swap16((uint16_t)(target >> 16));
+			break;
+		case PPC_RELOC_HA16:
+			*imm16 = swap16(HA(target));
+			break;
+		case PPC_RELOC_LO16:
+			*imm16 = swap16((uint16_t)(target & 0xffff));
+			break;
+		}
+		return true;
+	}
+
+	/* The PAIR following a HI16/HA16/LO16 carries the other 16 bits of the
+		value in its r_address. The Mach-O view stores every entry of a
+		section's relocation table as section address + r_address, PAIR
+		entries included, so the section start always comes off again. */
+	static uint64_t GetPairHalf(BinaryView* view, const BNRelocationInfo& reloc, const BNRelocationInfo& pair)
+	{
+		uint64_t half = pair.address;
+		auto sections = view->GetSectionsAt(reloc.address);
+		if (!sections.empty())
+			half -= sections[0]->GetStart();
+		return half & 0xffff;
+	}
+
 	virtual bool GetRelocationInfo(Ref<BinaryView> view, Ref<Architecture> arch, vector<BNRelocationInfo>& result) override
 	{
-		(void)view; (void)arch;
+		(void)arch;
 		set<uint64_t> relocTypes;
-		for (auto& reloc : result)
+		for (size_t i = 0; i < result.size(); i++)
 		{
-			reloc.type = UnhandledRelocation;
-			relocTypes.insert(reloc.nativeType);
+			BNRelocationInfo& reloc = result[i];
+			switch (reloc.nativeType)
+			{
+			case PPC_RELOC_HI16:
+			case PPC_RELOC_HA16:
+			case PPC_RELOC_LO16:
+				/* passed on to ApplyRelocation() as the addend */
+				reloc.addend = 0;
+				if (i + 1 < result.size() && result[i + 1].nativeType == PPC_RELOC_PAIR)
+					reloc.addend = GetPairHalf(view.GetPtr(), reloc, result[i + 1]);
+				break;
+			}
+
+			reloc.type = StandardRelocationType;
+			reloc.size = 4;
+			reloc.dataRelocation = false;
+			switch (reloc.nativeType)
+			{
+			case PPC_RELOC_VANILLA:
+			case PPC_RELOC_PB_LA_PTR:
+				reloc.dataRelocation = true;
+				break;
+			case PPC_RELOC_BR24:
+			case PPC_RELOC_BR14:
+			case PPC_RELOC_LO14:
+			case PPC_RELOC_HI16:
+			case PPC_RELOC_HA16:
+			case PPC_RELOC_LO16:
+				break;
+			/* the difference of two addresses in the image is already in
+				place and doesn't change when the image moves, the PAIR
+				entries only carry the other half of these */
+			case PPC_RELOC_PAIR:
+			case PPC_RELOC_SECTDIFF:
+			case PPC_RELOC_LOCAL_SECTDIFF:
+			case PPC_RELOC_HI16_SECTDIFF:
+			case PPC_RELOC_LO16_SECTDIFF:
+			case PPC_RELOC_HA16_SECTDIFF:
+			case PPC_RELOC_LO14_SECTDIFF:
+			/* a hint for branch islands, the branch itself has a BR24 */
+			case PPC_RELOC_JBSR:
+				reloc.type = IgnoredRelocation;
+				break;
+			default:
+				reloc.type = UnhandledRelocation;
+				relocTypes.insert(reloc.nativeType);
+				break;
+			}
 		}
 		for (auto& reloc : relocTypes)
 			LogWarn("Unsupported Mach-O relocation type: %s", GetRelocationString((MachoPpcRelocationType)reloc));
-		return false;
+		return true;
+	}
+
+	virtual size_t GetOperandForExternalRelocation(const uint8_t* data, uint64_t addr, size_t length,
+		Ref<LowLevelILFunction> il, Ref<Relocation> relocation) override
+	{
+		(void)data;
+		(void)addr;
+		(void)length;
+		(void)il;
+		auto info = relocation->GetInfo();
+		switch (info.nativeType)
+		{
+		case PPC_RELOC_HI16:
+		case PPC_RELOC_HA16:
+			return BN_NOCOERCE_EXTERN_PTR;
+		default:
+			return BN_AUTOCOERCE_EXTERN_PTR;
+		}
 	}
 };
 
+/* "PowerPC\\Find functions by prologue" - seed function discovery in raw,
+	symbol-less images by scanning executable segments for frame setup */
+static void FindFunctionsByPrologue(BinaryView* view)
+{
+	Ref<Platform> platform = view->GetDefaultPlatform();
+	bool lil_end = view->GetDefaultEndianness() == LittleEndian;
+	size_t added = 0;
+
+	for (auto& segment : view->GetSegments())
+	{
+		if (!(segment->GetFlags() & SegmentExecutable))
+			continue;
+
+		uint64_t start = (segment->GetStart() + 3) & ~3ULL;
+		if (segment->GetEnd() <= start)
+			continue;
+
+		DataBuffer buf = view->ReadBuffer(start, segment->GetEnd() - start);
+
+		vector<prologue_candidate> candidates;
+		ppc_scan_prologues((const uint8_t *)buf.GetData(), buf.GetLength(), start, lil_end, candidates);
+
+		for (auto& cand : candidates)
+		{
+			if (cand.score < PROLOGUE_SCORE_LIKELY)
+				continue;
+			if (!view->GetAnalysisFunctionsForAddress(cand.addr).empty())
+				continue;
+
+			view->AddFunctionForAnalysis(platform, cand.addr);
+			added++;
+		}
+	}
+
+	LogInfo("PowerPC prologue scan added %zu functions", added);
+	view->UpdateAnalysis();
+}
+
+static bool IsValidForPrologueScan(BinaryView* view)
+{
+	Ref<Architecture> arch = view->GetDefaultArchitecture();
+	if (!arch)
+		return false;
+
+	string name = arch->GetName();
+	return name == "ppc" || name == "ppc64" || name == "ppc_le" || name == "ppc64_le";
+}
+
 extern "C"
 {
 	BN_DECLARE_CORE_ABI_VERSION
@@ -2467,46 +5425,112 @@ extern "C"
 	{
 		MYLOG("ARCH POWERPC compiled at %s %s\n", __DATE__, __TIME__);
 
+		/* each view reads the condition register model once, so it applies
+		   to views opened after a change; this value is only the default for
+		   IL lifted outside a function */
+		Ref<Settings> settings = Settings::Instance();
+		settings->RegisterGroup("arch", "Architecture");
+		settings->RegisterSetting("arch.ppc.conditionRegisters",
+			R"~({
+			"title" : "PowerPC Condition Register Fields",
+			"type" : "boolean",
+			"default" : false,
+			"description" : "Lift cr0-cr7 as 4-byte registers, each holding its 4-bit field (lt, gt, eq, so from bit 3 down), instead of individual flags. Condition logic between compares and branches is then visible to dataflow. Applies to views opened after it is changed."
+			})~");
+		bool crRegisters = settings->Get<bool>("arch.ppc.conditionRegisters");
+
 		/* create, register arch in global list of available architectures */
-		Architecture* ppc = new PowerpcArchitecture("ppc", BigEndian);
+		Architecture* ppc = new PowerpcArchitecture("ppc", BigEndian, false, crRegisters);
 		Architecture::Register(ppc);
 
-		Architecture* ppc64 = new PowerpcArchitecture("ppc64", BigEndian);
+		Architecture* ppc64 = new PowerpcArchitecture("ppc64", BigEndian, true, crRegisters);
 		Architecture::Register(ppc64);
 
-		Architecture* ppc_le = new PowerpcArchitecture("ppc_le", LittleEndian);
+		Architecture* ppc_le = new PowerpcArchitecture("ppc_le", LittleEndian, false, crRegisters);
 		Architecture::Register(ppc_le);
 
-		Architecture* ppc64_le = new PowerpcArchitecture("ppc64_le", LittleEndian);
+		Architecture* ppc64_le = new PowerpcArchitecture("ppc64_le", LittleEndian, true, crRegisters);
 		Architecture::Register(ppc64_le);
 
+		Architecture* ppc_vle = new PowerpcVleArchitecture("ppc_vle", BigEndian);
+		Architecture::Register(ppc_vle);
+
 		/* calling conventions */
 		Ref<CallingConvention> conv;
 		conv = new PpcSvr4CallingConvention(ppc);
 		ppc->RegisterCallingConvention(conv);
 		ppc->SetDefaultCallingConvention(conv);
-		ppc64->RegisterCallingConvention(conv);
-		ppc64->SetDefaultCallingConvention(conv);
-		conv = new PpcLinuxSyscallCallingConvention(ppc);
-		ppc->RegisterCallingConvention(conv);
-		ppc64->RegisterCallingConvention(conv);
+		ppc->RegisterCallingConvention(new PpcEabiCallingConvention(ppc));
+		ppc->RegisterCallingConvention(new PpcDarwinCallingConvention(ppc));
+		ppc->RegisterCallingConvention(new PpcAixCallingConvention(ppc));
+
+		conv = new PpcEabiCallingConvention(ppc_vle);
+		ppc_vle->RegisterCallingConvention(conv);
+		ppc_vle->SetDefaultCallingConvention(conv);
+		ppc_vle->RegisterCallingConvention(new PpcSvr4CallingConvention(ppc_vle));
 
 		conv = new PpcSvr4CallingConvention(ppc_le);
 		ppc_le->RegisterCallingConvention(conv);
 		ppc_le->SetDefaultCallingConvention(conv);
+		ppc_le->RegisterCallingConvention(new PpcEabiCallingConvention(ppc_le));
+
+		conv = new PpcElfV1CallingConvention(ppc64);
+		ppc64->RegisterCallingConvention(conv);
+		ppc64->SetDefaultCallingConvention(conv);
+		ppc64->RegisterCallingConvention(new PpcElfV2CallingConvention(ppc64));
+		ppc64->RegisterCallingConvention(new PpcDarwinCallingConvention(ppc64));
+		ppc64->RegisterCallingConvention(new PpcAixCallingConvention(ppc64));
+
+		conv = new PpcElfV2CallingConvention(ppc64_le);
 		ppc64_le->RegisterCallingConvention(conv);
 		ppc64_le->SetDefaultCallingConvention(conv);
-		conv = new PpcLinuxSyscallCallingConvention(ppc_le);
-		ppc_le->RegisterCallingConvention(conv);
-		ppc64_le->RegisterCallingConvention(conv);
+
+		for (Architecture* arch : {ppc, ppc64, ppc_le, ppc64_le})
+		{
+			conv = new PpcLinuxSyscallCallingConvention(arch);
+			arch->RegisterCallingConvention(conv);
+		}
+
+		for (Architecture* arch : {ppc, ppc64, ppc_le, ppc64_le})
+		{
+			conv = new PpcSaveRestoreCallingConvention(arch, false);
+			arch->RegisterCallingConvention(conv);
+			conv = new PpcSaveRestoreCallingConvention(arch, true);
+			arch->RegisterCallingConvention(conv);
+		}
 
 		/* function recognizer */
 		ppc->RegisterFunctionRecognizer(new PpcImportedFunctionRecognizer());
 		ppc_le->RegisterFunctionRecognizer(new PpcImportedFunctionRecognizer());
-
-		ppc->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler());
-		ppc_le->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler());
+		ppc_vle->RegisterFunctionRecognizer(new PpcImportedFunctionRecognizer());
+		ppc64->RegisterFunctionRecognizer(new PpcImportedFunctionRecognizer());
+		ppc64_le->RegisterFunctionRecognizer(new PpcImportedFunctionRecognizer());
+		ppc->RegisterFunctionRecognizer(new PpcSwitchRecognizer());
+		ppc_le->RegisterFunctionRecognizer(new PpcSwitchRecognizer());
+		ppc_vle->RegisterFunctionRecognizer(new PpcSwitchRecognizer());
+		ppc64->RegisterFunctionRecognizer(new PpcSwitchRecognizer());
+		ppc64_le->RegisterFunctionRecognizer(new PpcSwitchRecognizer());
+		ppc64->RegisterFunctionRecognizer(new PpcFunctionDescriptorRecognizer());
+		for (Architecture* arch : {ppc, ppc64, ppc_le, ppc64_le})
+			arch->RegisterFunctionRecognizer(new PpcSaveRestoreRecognizer());
+		for (Architecture* arch : {ppc, ppc64, ppc_le, ppc64_le})
+			arch->RegisterFunctionRecognizer(new PpcSyscallRecognizer());
+
+		ppc->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler<BigEndian, false>());
+		ppc_le->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler<LittleEndian, false>());
+		ppc_vle->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler<BigEndian, false>());
+		ppc64->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler<BigEndian, true>());
+		ppc64_le->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler<LittleEndian, true>());
+		ppc->RegisterRelocationHandler("Mach-O", new PpcMachoRelocationHandler());
 		ppc_le->RegisterRelocationHandler("Mach-O", new PpcMachoRelocationHandler());
+
+		/* per view state goes away with its view */
+		BinaryViewType::RegisterBinaryViewFinalizationEvent(PpcViewCacheBase::EvictAll);
+		BinaryViewType::RegisterBinaryViewInitialAnalysisCompletionEvent(DefineFunctionDescriptorEntries);
+
+		PluginCommand::Register("PowerPC\\Find functions by prologue",
+			"Scan executable segments for PowerPC function prologues and create functions there",
+			FindFunctionsByPrologue, IsValidForPrologueScan);
 		/* call the STATIC RegisterArchitecture with "Mach-O"
 			which invokes the "Mach-O" INSTANCE of RegisterArchitecture,
 			supplied with CPU_TYPE_POWERPC from machoview.h */
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+
+# Compares the flag and cr register models (arch.ppc.conditionRegisters) on
+# the same binaries: analysis time, lifted IL instructions and expressions.
+#
+#   python benchmark_cr_registers.py [--runs N] binary [binary ...]
+#
+# The model is chosen per view through its load options, so the user's
+# settings are never touched. The runs alternate between the two models and
+# the median time is kept; the first run of each warms the lift cache.
+
+import time
+import argparse
+import binaryninja
+from binaryninja import lowlevelil
+
+CR_REGISTERS = 'arch.ppc.conditionRegisters'
+
+def count_exprs(il):
+    if not isinstance(il, lowlevelil.LowLevelILInstruction):
+        if isinstance(il, list):
+            return sum([count_exprs(x) for x in il])
+        return 0
+    return 1 + sum([count_exprs(o) for o in il.operands])
+
+def measure(path, cr_registers):
+    bv = binaryninja.load(path, update_analysis=False, options={CR_REGISTERS: cr_registers})
+    start = time.perf_counter()
+    bv.update_analysis_and_wait()
+    seconds = time.perf_counter() - start
+
+    instrs = exprs = 0
+    for func in bv.functions:
+        for block in func.lifted_il:
+            for il in block:
+                instrs += 1
+                exprs += count_exprs(il)
+
+    result = {'functions': len(bv.functions), 'seconds': seconds, 'instrs': instrs, 'exprs': exprs}
+    bv.file.close()
+    return result
+
+def benchmark(path, runs):
+    samples = {False: [], True: []}
+    for i in range(runs):
+        for cr_registers in [False, True]:
+            samples[cr_registers].append(measure(path, cr_registers))
+
+    results = {}
+    for (cr_registers, runs_) in samples.items():
+        result = runs_[0]
+        result['seconds'] = sorted([s['seconds'] for s in runs_])[len(runs_) // 2]
+        results[cr_registers] = result
+    return results
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--runs', type=int, default=3, help='analysis runs per binary and model')
+    parser.add_argument('paths', nargs='+')
+    args = parser.parse_args()
+
+    print('binary ninja %s, median of %d runs' % (binaryninja.core_version(), args.runs))
+    print('%-32s %-6s %8s %10s %10s %10s' % ('binary', 'model', 'funcs', 'seconds', 'instrs', 'exprs'))
+    for path in args.paths:
+        results = benchmark(path, args.runs)
+        flags, crs = results[False], results[True]
+        for (model, result) in [('flags', flags), ('cr', crs)]:
+            print('%-32s %-6s %8d %10.3f %10d %10d' % (path[-32:], model,
+                result['functions'], result['seconds'], result['instrs'], result['exprs']))
+        print('%-32s %-6s %8s %9.2fx %9.2fx %9.2fx' % ('', 'cr/fl', '',
+            crs['seconds'] / max(flags['seconds'], 1e-9),
+            crs['instrs'] / max(flags['instrs'], 1),
+            crs['exprs'] / max(flags['exprs'], 1)))
+
+if __name__ == '__main__':
+    main()
@@ -1,6 +1,14 @@
+#include <string.h>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include <binaryninjaapi.h>
 
 #include "disassembler.h"
+#include "vle.h"
 
 using namespace BinaryNinja;
 
@@ -31,6 +39,65 @@ static uint32_t genMask(uint32_t mb, uint32_t me)
 	return (mb <= me) ? (maskBegin & maskEnd) : (maskBegin | maskEnd);
 }
 
+static ExprId RotateAndMask(LowLevelILFunction &il, uint32_t reg, uint32_t sh, uint32_t mb, uint32_t me)
+{
+	uint32_t mask = genMask(mb, me);
+	ExprId ei0 = il.Register(4, reg);
+
+	if (sh != 0)
+	{
+		if ((mask & (~0u >> (32 - sh))) == 0)
+		{
+			if (mask != 0xffffffff)
+				ei0 = il.And(4, ei0, il.Const(4, mask >> sh));
+
+			ei0 = il.ShiftLeft(4, ei0, il.Const(4, sh));
+		}
+		else if ((mask & (~0u << sh)) == 0)
+		{
+			if (mask != 0xffffffff)
+				ei0 = il.And(4, ei0, il.Const(4, mask << (32 - sh)));
+
+			ei0 = il.LogicalShiftRight(4, ei0, il.Const(4, 32 - sh));
+		}
+		else
+		{
+			ei0 = il.RotateLeft(4, ei0, il.Const(4, sh));
+
+			if (mask != 0xffffffff)
+				ei0 = il.And(4, ei0, il.Const(4, mask));
+		}
+	}
+	else if (mask != 0xffffffff)
+	{
+		ei0 = il.And(4, ei0, il.Const(4, mask));
+	}
+
+	return ei0;
+}
+
+
+static ExprId RotateAndInsert(LowLevelILFunction &il, uint32_t dst, uint32_t src, uint32_t sh, uint32_t mb, uint32_t me)
+{
+	uint32_t mask = genMask(mb, me);
+	ExprId ei0 = il.Register(4, src);
+
+	if (sh != 0)
+	{
+		if ((mask & (~0u >> (32 - sh))) == 0)
+			ei0 = il.ShiftLeft(4, ei0, il.Const(4, sh));
+		else if ((mask & (~0u << sh)) == 0)
+			ei0 = il.LogicalShiftRight(4, ei0, il.Const(4, 32 - sh));
+		else
+			ei0 = il.RotateLeft(4, ei0, il.Const(4, sh));
+	}
+
+	ei0 = il.And(4, ei0, il.Const(4, mask));
+	uint32_t invertMask = ~mask;
+	return il.Or(4, il.And(4, il.Register(4, dst), il.Const(4, invertMask)), ei0);
+}
+
+
 static ExprId operToIL(LowLevelILFunction &il, struct cs_ppc_op *op,
 	int options=0, uint64_t extra=0)
 {
@@ -156,8 +223,77 @@ int crxToFlagWriteType(int crx, bool signedComparison = true)
 }
 
 
-static ExprId ExtractConditionClause(LowLevelILFunction& il, uint8_t crBit, bool negate = false)
+/* With cr registers the condition register is modelled as the eight field
+ * registers cr0-cr7 instead of 32 flags. Each field holds its bits in the low
+ * nibble the way mfcr would place them: LT = 8, GT = 4, EQ = 2, SO = 1. */
+static uint32_t CrBitShift(uint32_t crBit)
+{
+	return 3 - (crBit % 4);
+}
+
+/* the bit as an integer 0 or 1 */
+static ExprId ReadCrBit(LowLevelILFunction& il, uint32_t crBit)
+{
+	return il.And(4,
+		il.LogicalShiftRight(4, il.Register(4, PPC_REG_CR0 + crBit / 4), il.Const(4, CrBitShift(crBit))),
+		il.Const(4, 1));
+}
+
+/* value must be 0 or 1 */
+static ExprId WriteCrBit(LowLevelILFunction& il, uint32_t crBit, ExprId value)
+{
+	uint32_t field = PPC_REG_CR0 + crBit / 4;
+
+	return il.SetRegister(4, field,
+		il.Or(4,
+			il.And(4, il.Register(4, field), il.Const(4, ~(1 << CrBitShift(crBit)) & 0xf)),
+			il.ShiftLeft(4, value, il.Const(4, CrBitShift(crBit)))));
+}
+
+static ExprId TestCrBit(LowLevelILFunction& il, uint32_t crBit, bool negate = false)
+{
+	ExprId bit = il.And(4, il.Register(4, PPC_REG_CR0 + crBit / 4), il.Const(4, 1 << CrBitShift(crBit)));
+
+	if (negate)
+		return il.CompareEqual(4, bit, il.Const(4, 0));
+
+	return il.CompareNotEqual(4, bit, il.Const(4, 0));
+}
+
+/* crN = LT | GT | EQ | SO from comparing left with right; every comparison
+ * gets its own copy of the operands, hence the callbacks */
+static ExprId SetCrField(LowLevelILFunction& il, uint32_t crx,
+	const std::function<ExprId()>& left, const std::function<ExprId()>& right, bool signedComparison = true)
+{
+	ExprId lt, gt, eq;
+
+	if (signedComparison)
+	{
+		lt = il.CompareSignedLessThan(4, left(), right());
+		gt = il.CompareSignedGreaterThan(4, left(), right());
+	}
+	else
+	{
+		lt = il.CompareUnsignedLessThan(4, left(), right());
+		gt = il.CompareUnsignedGreaterThan(4, left(), right());
+	}
+	eq = il.CompareEqual(4, left(), right());
+
+	return il.SetRegister(4, crx,
+		il.Or(4,
+			il.Or(4,
+				il.ShiftLeft(4, il.BoolToInt(4, lt), il.Const(4, 3)),
+				il.ShiftLeft(4, il.BoolToInt(4, gt), il.Const(4, 2))),
+			il.Or(4,
+				il.ShiftLeft(4, il.BoolToInt(4, eq), il.Const(4, 1)),
+				il.BoolToInt(4, il.Flag(IL_FLAG_XER_SO)))));
+}
+
+static ExprId ExtractConditionClause(LowLevelILFunction& il, uint8_t crBit, bool negate = false, bool crRegisters = false)
 {
+	if (crRegisters)
+		return TestCrBit(il, crBit, negate);
+
 	uint32_t flagBase = (crBit / 4) * 10;
 
 	switch (crBit & 3)
@@ -182,7 +318,8 @@ static ExprId ExtractConditionClause(LowLevelILFunction& il, uint8_t crBit, bool
 }
 
 
-static bool LiftConditionalBranch(LowLevelILFunction& il, uint8_t bo, uint8_t bi, BNLowLevelILLabel& takenLabel, BNLowLevelILLabel& falseLabel)
+static bool LiftConditionalBranch(LowLevelILFunction& il, uint8_t bo, uint8_t bi, BNLowLevelILLabel& takenLabel, BNLowLevelILLabel& falseLabel,
+	bool crRegisters = false)
 {
 	bool testsCtr = !(bo & 4);
 	bool testsCrBit = !(bo & 0x10);
@@ -220,15 +357,58 @@ static bool LiftConditionalBranch(LowLevelILFunction& il, uint8_t bo, uint8_t bi
 
 	if (testsCrBit)
 	{
-		ExprId cond = ExtractConditionClause(il, bi, !(bo & 8));
+		ExprId cond = ExtractConditionClause(il, bi, !(bo & 8), crRegisters);
 		il.AddInstruction(il.If(cond, takenLabel, falseLabel));
 	}
 
 	return isConditional;
 }
 
+/* ELFv2 local calls skip the two instruction TOC setup at the global entry.
+ * They are lifted as calls to the global entry instead, so the callee is only
+ * discovered once. r2 comes out the same: the lifter folds the addis/addi r2
+ * pair at the global entry to the constant TOC the local entry expects. This
+ * is also what makes the callee on ppc64, GetInstructionInfo() reports none. */
+static uint32_t ElfV2CallTarget(Architecture* arch, LowLevelILFunction &il, uint32_t target)
+{
+	if (target < 8 || arch->GetName().compare(0, 5, "ppc64") != 0)
+		return target;
+
+	Ref<Function> func = il.GetFunction();
+	if (!func)
+		return target;
+
+	uint32_t words[2];
+	if (func->GetView()->Read(words, target - 8, sizeof(words)) != sizeof(words))
+		return target;
+	if (arch->GetEndianness() == BigEndian)
+		words[0] = bswap32(words[0]), words[1] = bswap32(words[1]);
+
+	return IsElfV2GlobalEntry(words[0], words[1]) ? target - 8 : target;
+}
+
+/* The register restore helpers that reload LR (_restgpr_N_x, _restfpr_N_x
+ * and _restgpr0_N) return to their caller's caller, the _x ones popping the
+ * frame from r11 on the way. A branch to one is its caller's exit. */
+static bool IsTailExitHelper(LowLevelILFunction &il, uint32_t target)
+{
+	Ref<Function> func = il.GetFunction();
+	if (!func)
+		return false;
+
+	Ref<Symbol> sym = func->GetView()->GetSymbolByAddress(target);
+	if (!sym)
+		return false;
 
-static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8_t* data, uint64_t addr, bool le)
+	std::string name = sym->GetShortName();
+	if (name.compare(0, 10, "_restgpr0_") == 0)
+		return true;
+	if (name.compare(0, 9, "_restgpr_") != 0 && name.compare(0, 9, "_restfpr_") != 0)
+		return false;
+	return name.size() > 2 && name.compare(name.size() - 2, 2, "_x") == 0;
+}
+
+static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8_t* data, uint64_t addr, bool le, bool crRegisters)
 {
 	uint32_t insn = *(const uint32_t *) data;
 
@@ -241,15 +421,18 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 	{
 		case 18: /* b (b, ba, bl, bla) */
 		{
-			uint32_t target = insn & 0x03fffffc;
+			uint32_t target = BranchTarget(insn, (uint32_t) addr);
 
-			/* sign extend target */
-			if ((target >> 25) & 1)
-				target |= 0xfc000000;
+			/* "bl .+4" just loads the address of the next instruction, as
+			 * position independent code does, it is not a call */
+			if (lk && target == addr + 4)
+			{
+				il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.ConstPointer(4, addr + 4)));
+				break;
+			}
 
-			/* account for absolute addressing */
-			if (!(insn & 2))
-				target += (uint32_t) addr;
+			if (lk)
+				target = ElfV2CallTarget(arch, il, target);
 
 			BNLowLevelILLabel *label = il.GetLabelForAddress(arch, target);
 
@@ -269,6 +452,8 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 
 				if (lk)
 					il.AddInstruction(il.Call(dest));
+				else if (IsTailExitHelper(il, target))
+					il.AddInstruction(il.TailCall(dest));
 				else
 					il.AddInstruction(il.Jump(dest));
 			}
@@ -289,6 +474,13 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 			if (!(insn & 2))
 				target += (uint32_t) addr;
 
+			/* PIC thunk, "bcl 20,31,.+4" followed by "mflr" */
+			if (lk && (bo & 0x14) == 0x14 && target == addr + 4)
+			{
+				il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.ConstPointer(4, addr + 4)));
+				break;
+			}
+
 			BNLowLevelILLabel *existingTakenLabel = il.GetLabelForAddress(arch, target);
 			BNLowLevelILLabel *existingFalseLabel = il.GetLabelForAddress(arch, addr + 4);
 
@@ -305,7 +497,7 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 			if (!falseLabel)
 				falseLabel = &falseLabelManual;
 
-			bool wasConditionalBranch = LiftConditionalBranch(il, bo, bi, *takenLabel, *falseLabel);
+			bool wasConditionalBranch = LiftConditionalBranch(il, bo, bi, *takenLabel, *falseLabel, crRegisters);
 
 			if (wasConditionalBranch && !existingTakenLabel)
 				il.MarkLabel(*takenLabel);
@@ -359,7 +551,7 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 			if (!falseLabel)
 				falseLabel = &falseLabelManual;
 
-			bool wasConditionalBranch = LiftConditionalBranch(il, bo, bi, takenLabel, *falseLabel);
+			bool wasConditionalBranch = LiftConditionalBranch(il, bo, bi, takenLabel, *falseLabel, crRegisters);
 
 			if (wasConditionalBranch)
 				il.MarkLabel(takenLabel);
@@ -388,1995 +580,3840 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 }
 
 
-static ExprId ByteReverseRegister(LowLevelILFunction &il, uint32_t reg, size_t size)
+static uint32_t ByteSwapIntrinsic(size_t size)
 {
-	ExprId swap = BN_INVALID_EXPR;
-
-	for (size_t srcIndex = 0; srcIndex < size; srcIndex++)
+	switch (size)
 	{
-		ExprId extracted = il.Register(4, reg);
-		size_t dstIndex = size - srcIndex - 1;
-
-		if (dstIndex > srcIndex)
-		{
-			ExprId mask = il.Const(4, 0xffull << (srcIndex * 8));
-			extracted = il.And(4, extracted, mask);
-			extracted = il.ShiftLeft(4, extracted, il.Const(4, (dstIndex - srcIndex) * 8));
-		}
-		else if (srcIndex > dstIndex)
-		{
-			ExprId mask = il.Const(4, 0xffull << (dstIndex * 8));
-			extracted = il.LogicalShiftRight(4, extracted, il.Const(4, (srcIndex - dstIndex) * 8));
-			extracted = il.And(4, extracted, mask);
-		}
-
-		if (swap == BN_INVALID_EXPR)
-			swap = extracted;
-		else
-			swap = il.Or(4, swap, extracted);
+		case 2: return PPC_INTRIN_BSWAP16;
+		case 8: return PPC_INTRIN_BSWAP64;
+		default: return PPC_INTRIN_BSWAP32;
 	}
-
-	return swap;
 }
 
-
+/* GPRs are lifted as 4 bytes, so the halfword and doubleword forms swap
+ * through temp0 and extend or truncate from there */
 static void ByteReversedLoad(LowLevelILFunction &il, struct cs_ppc* ppc, size_t size)
 {
+	uint32_t rD = ppc->operands[0].reg;
 	ExprId addr = operToIL(il, &ppc->operands[1], OTI_GPR0_ZERO);                  // (rA|0)
 	ExprId  val = il.Load(size, il.Add(4, addr, operToIL(il, &ppc->operands[2]))); // [(rA|0) + (rB)]
 
-	if (size < 4)
-		val = il.ZeroExtend(4, val);
+	if (size == 4)
+	{
+		il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(rD) }, PPC_INTRIN_BSWAP32, { val })); // rD = swap([(rA|0) + (rB)])
+		return;
+	}
 
-	/* set reg immediately; this will cause xrefs to be sized correctly,
-	 * we'll use this as the scratch while we calculate the swapped value */
-	il.AddInstruction(il.SetRegister(4, ppc->operands[0].reg, val));               // rD = [(rA|0) + (rB)]
-	ExprId swap = ByteReverseRegister(il, ppc->operands[0].reg, size);
+	il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(LLIL_TEMP(0)) }, ByteSwapIntrinsic(size), { val }));
 
-	il.AddInstruction(il.SetRegister(4, ppc->operands[0].reg, swap));              // rD = swap([(rA|0) + (rB)])
+	val = il.Register(size, LLIL_TEMP(0));
+	val = (size < 4) ? il.ZeroExtend(4, val) : il.LowPart(4, val);
+	il.AddInstruction(il.SetRegister(4, rD, val));
 }
 
 static void ByteReversedStore(LowLevelILFunction &il, struct cs_ppc* ppc, size_t size)
 {
 	ExprId addr = operToIL(il, &ppc->operands[1], OTI_GPR0_ZERO);     // (rA|0)
 	addr = il.Add(4, addr, operToIL(il, &ppc->operands[2]));          // (rA|0) + (rB)
-	ExprId val = ByteReverseRegister(il, ppc->operands[0].reg, size); // rS = swap(rS)
-	il.AddInstruction(il.Store(size, addr, val));                     // [(rA|0) + (rB)] = swap(rS)
-}
+	ExprId  val = il.Register(4, ppc->operands[0].reg);               // rS
 
-/* returns TRUE - if this IL continues
-          FALSE - if this IL terminates a block */
-bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
-  const uint8_t* data, uint64_t addr, decomp_result *res, bool le)
-{
-	int i;
-	bool rc = true;
+	if (size < 4)
+		val = il.LowPart(size, val);
+	else if (size > 4)
+		val = il.ZeroExtend(size, val);
 
-	/* bypass capstone path for *all* branching instructions; capstone
-	 * is too difficult to work with and is outright broken for some
-	 * branch instructions (bdnz, etc.)
-	 */
-	if (LiftBranches(arch, il, data, addr, le))
-		return true;
+	il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(LLIL_TEMP(0)) }, ByteSwapIntrinsic(size), { val }));
+	il.AddInstruction(il.Store(size, addr, il.Register(size, LLIL_TEMP(0)))); // [(rA|0) + (rB)] = swap(rS)
+}
 
-	struct cs_insn *insn = &(res->insn);
-	struct cs_detail *detail = &(res->detail);
-	struct cs_ppc *ppc = &(detail->ppc);
+/* Lifting of everything that isn't a branch goes through a table of handlers
+ * indexed by capstone instruction id. Each handler receives the operands
+ * already shifted past a leading crX (see GetLowLevelILForPPCInstruction) and
+ * can rely on the first minOps of them being present; returning false means
+ * the instruction couldn't be lifted after all and gets Unimplemented().
+ */
+typedef bool (*LiftHandler)(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper);
 
-	/* There is a simplifying reduction available for:
-	 *   rlwinm <reg>, <reg>, <rol_amt>, <mask_begin>, <mask_end>
-	 * When <rol_amt> == <mask_begin> == 0, this can be translated to:
-	 *   clrwi <reg>, <reg>, 31-<mask_end>
-	 *
-	 * Unfortunately capstone screws this up, replacing just the instruction id with PPC_INSN_CLRWI.
-	 * The mnemonic ("rlwinm"), operands, etc. all stay the same.
-	 */
-	if (insn->id == PPC_INS_CLRLWI && insn->mnemonic[0] == 'r')
-	{
-		insn->id = PPC_INS_RLWINM;
-	}
+struct LiftEntry
+{
+	LiftHandler handler; /* NULL if unimplemented */
+	uint8_t minOps;      /* leading operands that must be present */
+};
 
-	/* create convenient access to instruction operands */
-	cs_ppc_op *oper0=NULL, *oper1=NULL, *oper2=NULL, *oper3=NULL, *oper4=NULL;
-	#define REQUIRE1OP if(!oper0) goto ReturnUnimpl;
-	#define REQUIRE2OPS if(!oper0 || !oper1) goto ReturnUnimpl;
-	#define REQUIRE3OPS if(!oper0 || !oper1 || !oper2) goto ReturnUnimpl;
-	#define REQUIRE4OPS if(!oper0 || !oper1 || !oper2 || !oper3) goto ReturnUnimpl;
-	#define REQUIRE5OPS if(!oper0 || !oper1 || !oper2 || !oper3 || !oper4) goto ReturnUnimpl;
-
-	switch(ppc->op_count) {
-		default:
-		case 5: oper4 = &(ppc->operands[4]); FALL_THROUGH
-		case 4: oper3 = &(ppc->operands[3]); FALL_THROUGH
-		case 3: oper2 = &(ppc->operands[2]); FALL_THROUGH
-		case 2: oper1 = &(ppc->operands[1]); FALL_THROUGH
-		case 1: oper0 = &(ppc->operands[0]); FALL_THROUGH
-		case 0: while(0);
-	}
+/* add
+	"add." also updates the CR0 bits */
+static bool LiftAdd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Add(
+		4,
+		operToIL(il, oper[1]),
+		operToIL(il, oper[2])
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		(insn->id == PPC_INS_ADD && ppc->update_cr0) ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-	/* for conditionals that specify a crx, treat it special */
-	if(ppc->bc != PPC_BC_INVALID) {
-		if(oper0 && oper0->type == PPC_OP_REG && oper0->reg >= PPC_REG_CR0 &&
-		  ppc->operands[0].reg <= PPC_REG_CR7) {
-			oper0 = oper1;
-			oper1 = oper2;
-			oper2 = oper3;
-			oper3 = NULL;
-		}
-	}
+static bool LiftAdde(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.AddCarry(
+		4,
+		operToIL(il, oper[1]),
+		operToIL(il, oper[2]),
+		il.Flag(IL_FLAG_XER_CA),
+		IL_FLAGWRITE_XER_CA
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+	  ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-	if(0 && insn->id == PPC_INS_CMPLWI) {
-		MYLOG("%s() %08llx: %02X %02X %02X %02X %s %s has %d operands\n",
-			__func__, addr, data[0], data[1], data[2], data[3],
-			insn->mnemonic, insn->op_str, ppc->op_count
-		);
+static bool LiftAddme(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	if (insn->id == PPC_INS_ADDME)
+		ei0 = il.Const(4, 0xffffffff);
+	else
+		ei0 = il.Const(4, 0);
+	ei0 = il.AddCarry(
+		4,
+		operToIL(il, oper[1]),
+		ei0,
+		il.Flag(IL_FLAG_XER_CA),
+		IL_FLAGWRITE_XER_CA
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-		//printInstructionVerbose(res);
-		//MYLOG("oper0: %p\n", oper0);
-		//MYLOG("oper1: %p\n", oper1);
-		//MYLOG("oper2: %p\n", oper2);
-		//MYLOG("oper3: %p\n", oper3);
-	}
+static bool LiftAddc(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Add(
+		4,
+		operToIL(il, oper[1]),
+		operToIL(il, oper[2]),
+		IL_FLAGWRITE_XER_CA
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-	ExprId ei0, ei1, ei2;
+static bool LiftAddi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	if (insn->id == PPC_INS_ADDIS)
+		ei0 = il.Const(4, oper[2]->imm << 16);
+	else
+		ei0 = il.Const(4, oper[2]->imm);
+	ei0 = il.Add(
+		4,
+		operToIL(il, oper[1], OTI_GPR0_ZERO),
+		ei0
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-	switch(insn->id) {
-		/* add
-			"add." also updates the CR0 bits */
-		case PPC_INS_ADD: /* add */
-			REQUIRE2OPS
-			ei0 = il.Add(
-				4,
-				operToIL(il, oper1),
-				operToIL(il, oper2)
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				(insn->id == PPC_INS_ADD && ppc->update_cr0) ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
-			break;
+static bool LiftLis(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.SetRegister(
+		4,
+		oper[0]->reg,
+		il.ConstPointer(4, oper[1]->imm << 16)
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-		case PPC_INS_ADDE: /* add, extended (+ carry flag) */
-			REQUIRE3OPS
-			ei0 = il.AddCarry(
-				4,
-				operToIL(il, oper1),
-				operToIL(il, oper2),
-				il.Flag(IL_FLAG_XER_CA),
-				IL_FLAGWRITE_XER_CA
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-			  ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
-			break;
+static bool LiftLi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, operToIL(il, oper[1])));
+	return true;
+}
 
-		case PPC_INS_ADDME: /* add, extended (+ carry flag) minus one */
-		case PPC_INS_ADDZE:
-			REQUIRE2OPS
-			if (insn->id == PPC_INS_ADDME)
-				ei0 = il.Const(4, 0xffffffff);
-			else
-				ei0 = il.Const(4, 0);
-			ei0 = il.AddCarry(
-				4,
-				operToIL(il, oper1),
-				ei0,
-				il.Flag(IL_FLAG_XER_CA),
-				IL_FLAGWRITE_XER_CA
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
-			break;
+static bool LiftAnd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[2]);
+	if (insn->id == PPC_INS_ANDC)
+		ei0 = il.Not(4, ei0);
+	ei0 = il.And(4, operToIL(il, oper[1]), ei0);
+	if (insn->id == PPC_INS_NAND)
+		ei0 = il.Not(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-		case PPC_INS_ADDC: /* add, carrying */
-		case PPC_INS_ADDIC: /* add immediate, carrying */
-			REQUIRE3OPS
-			ei0 = il.Add(
-				4,
-				operToIL(il, oper1),
-				operToIL(il, oper2),
-				IL_FLAGWRITE_XER_CA
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
-			break;
+static bool LiftAndis(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	if (insn->id == PPC_INS_ANDIS)
+		ei0 = il.Const(4, oper[2]->imm << 16);
+	else
+		ei0 = il.Const(4, oper[2]->imm);
+	ei0 = il.And(4, operToIL(il, oper[1]), ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-		case PPC_INS_ADDI: /* add immediate, eg: addi rD, rA, <imm> */
-		case PPC_INS_ADDIS: /* add immediate, shifted */
-			REQUIRE2OPS
-			if (insn->id == PPC_INS_ADDIS)
-				ei0 = il.Const(4, oper2->imm << 16);
-			else
-				ei0 = il.Const(4, oper2->imm);
-			ei0 = il.Add(
-				4,
-				operToIL(il, oper1, OTI_GPR0_ZERO),
-				ei0
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0);
-			il.AddInstruction(ei0);
-			break;
+static bool LiftCmp(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1, ei2;
 
-		case PPC_INS_LIS: /* load immediate, shifted */
-			REQUIRE2OPS
-			ei0 = il.SetRegister(
-				4,
-				oper0->reg,
-				il.ConstPointer(4, oper1->imm << 16)
-			);
-			il.AddInstruction(ei0);
-			break;
+	ei0 = operToIL(il, oper[2] ? oper[1] : oper[0]);
+	ei1 = operToIL(il, oper[2] ? oper[2] : oper[1]);
+	ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper[2] ? oper[0]->reg : PPC_REG_CR0));
+	il.AddInstruction(ei2);
+	return true;
+}
 
-		case PPC_INS_LI: /* load immediate */
-		case PPC_INS_LA: /* load displacement */
-			REQUIRE2OPS
-			il.AddInstruction(il.SetRegister(4, oper0->reg, operToIL(il, oper1)));
-			break;
-
-		case PPC_INS_AND:
-		case PPC_INS_ANDC: // and [with complement]
-		case PPC_INS_NAND:
-			REQUIRE3OPS
-			ei0 = operToIL(il, oper2);
-			if (insn->id == PPC_INS_ANDC)
-				ei0 = il.Not(4, ei0);
-			ei0 = il.And(4, operToIL(il, oper1), ei0);
-			if (insn->id == PPC_INS_NAND)
-				ei0 = il.Not(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
-			break;
+static bool LiftCmpl(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1, ei2;
 
-		case PPC_INS_ANDIS:
-		case PPC_INS_ANDI:
-			REQUIRE3OPS
-			if (insn->id == PPC_INS_ANDIS)
-				ei0 = il.Const(4, oper2->imm << 16);
-			else
-				ei0 = il.Const(4, oper2->imm);
-			ei0 = il.And(4, operToIL(il, oper1), ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0, IL_FLAGWRITE_CR0_S);
-			il.AddInstruction(ei0);
-			break;
+	ei0 = operToIL(il, oper[2] ? oper[1] : oper[0]);
+	ei1 = operToIL(il, oper[2] ? oper[2] : oper[1]);
+	ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper[2] ? oper[0]->reg : PPC_REG_CR0, false));
+	il.AddInstruction(ei2);
+	return true;
+}
 
-		case PPC_INS_CMP:
-		case PPC_INS_CMPW: /* compare (signed) word(32-bit) */
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper2 ? oper1 : oper0);
-			ei1 = operToIL(il, oper2 ? oper2 : oper1);
-			ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper2 ? oper0->reg : PPC_REG_CR0));
-			il.AddInstruction(ei2);
-			break;
+static bool LiftCmpi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1, ei2;
 
-		case PPC_INS_CMPL:
-		case PPC_INS_CMPLW: /* compare logical(unsigned) word(32-bit) */
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper2 ? oper1 : oper0);
-			ei1 = operToIL(il, oper2 ? oper2 : oper1);
-			ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper2 ? oper0->reg : PPC_REG_CR0, false));
-			il.AddInstruction(ei2);
-			break;
+	ei0 = operToIL(il, oper[2] ? oper[1] : oper[0]);
+	ei1 = operToIL(il, oper[2] ? oper[2] : oper[1], OTI_SEXT32_IMMS);
+	ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper[2] ? oper[0]->reg : PPC_REG_CR0));
+	il.AddInstruction(ei2);
+	return true;
+}
 
-		case PPC_INS_CMPI:
-		case PPC_INS_CMPWI: /* compare (signed) word(32-bit) immediate */
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper2 ? oper1 : oper0);
-			ei1 = operToIL(il, oper2 ? oper2 : oper1, OTI_SEXT32_IMMS);
-			ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper2 ? oper0->reg : PPC_REG_CR0));
-			il.AddInstruction(ei2);
-			break;
+static bool LiftCmpli(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1, ei2;
 
-		case PPC_INS_CMPLI:
-		case PPC_INS_CMPLWI: /* compare logical(unsigned) word(32-bit) immediate */
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper2 ? oper1 : oper0);
-			ei1 = operToIL(il, oper2 ? oper2 : oper1, OTI_ZEXT32_IMMS);
-			ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper2 ? oper0->reg : PPC_REG_CR0, false));
-			il.AddInstruction(ei2);
-			break;
-
-	//case PPC_INS_CMPD: /* compare (signed) d-word(64-bit) */
-	//	REQUIRE2OPS
-	//	ei0 = operToIL(il, oper0);
-	//	ei1 = operToIL(il, oper1, OTI_SEXT64_REGS);
-	//	ei2 = il.Sub(4, ei0, ei1, flagWriteType);
-	//	il.AddInstruction(ei2);
-	//	break;
-
-	//case PPC_INS_CMPLD: /* compare logical(unsigned) d-word(64-bit) */
-	//	REQUIRE2OPS
-	//	ei0 = operToIL(il, oper0);
-	//	ei1 = operToIL(il, oper1, OTI_ZEXT64_REGS);
-	//	ei2 = il.Sub(4, ei0, ei1, flagWriteType);
-	//	il.AddInstruction(ei2);
-	//	break;
-
-	//case PPC_INS_CMPDI: /* compare (signed) d-word(64-bit) immediate */
-	//	REQUIRE2OPS
-	//	ei0 = operToIL(il, oper0);
-	//	ei1 = operToIL(il, oper1, OTI_SEXT64_IMMS);
-	//	ei2 = il.Sub(4, ei0, ei1, flagWriteType);
-	//	il.AddInstruction(ei2);
-	//	break;
-
-	//case PPC_INS_CMPLDI: /* compare logical(unsigned) d-word(64-bit) immediate */
-	//	REQUIRE2OPS
-	//	ei0 = operToIL(il, oper0);
-	//	ei1 = operToIL(il, oper1, OTI_ZEXT64_IMMS);
-	//	ei2 = il.Sub(4, ei0, ei1, flagWriteType);
-	//	il.AddInstruction(ei2);
-	//	break;
-
-	//	case PPC_INS_FCMPU:
-	//		REQUIRE3OPS
-	//		ei0 = il.FloatSub(4, il.Unimplemented(), il.Unimplemented(), (oper0->reg - PPC_REG_CR0) + IL_FLAGWRITE_INVL0);
-	//		il.AddInstruction(ei0);
-	//		break;
-
-		case PPC_INS_CRAND:
-		case PPC_INS_CRANDC:
-		case PPC_INS_CRNAND:
-			REQUIRE3OPS
-			ei0 = il.Flag(oper1->reg - PPC_REG_R0);
-			ei1 = il.Flag(oper2->reg - PPC_REG_R0);
-			if (insn->id == PPC_INS_CRANDC)
-				ei1 = il.Not(0, ei1);
-			ei0 = il.And(0, ei0, ei1);
-			if (insn->id == PPC_INS_CRNAND)
-				ei0 = il.Not(0, ei0);
-			il.AddInstruction(il.SetFlag(oper0->reg - PPC_REG_R0, ei0));
-			break;
+	ei0 = operToIL(il, oper[2] ? oper[1] : oper[0]);
+	ei1 = operToIL(il, oper[2] ? oper[2] : oper[1], OTI_ZEXT32_IMMS);
+	ei2 = il.Sub(4, ei0, ei1, crxToFlagWriteType(oper[2] ? oper[0]->reg : PPC_REG_CR0, false));
+	il.AddInstruction(ei2);
+	return true;
+}
 
-		case PPC_INS_CROR:
-		case PPC_INS_CRORC:
-		case PPC_INS_CRNOR:
-			REQUIRE3OPS
-			ei0 = il.Flag(oper1->reg - PPC_REG_R0);
-			ei1 = il.Flag(oper2->reg - PPC_REG_R0);
-			if (insn->id == PPC_INS_CRORC)
-				ei1 = il.Not(0, ei1);
-			ei0 = il.Or(0, ei0, ei1);
-			if (insn->id == PPC_INS_CRNOR)
-				ei0 = il.Not(0, ei0);
-			il.AddInstruction(il.SetFlag(oper0->reg - PPC_REG_R0, ei0));
-			break;
+static bool LiftCrand(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Flag(oper[1]->reg - PPC_REG_R0);
+	ei1 = il.Flag(oper[2]->reg - PPC_REG_R0);
+	if (insn->id == PPC_INS_CRANDC)
+		ei1 = il.Not(0, ei1);
+	ei0 = il.And(0, ei0, ei1);
+	if (insn->id == PPC_INS_CRNAND)
+		ei0 = il.Not(0, ei0);
+	il.AddInstruction(il.SetFlag(oper[0]->reg - PPC_REG_R0, ei0));
+	return true;
+}
 
-		case PPC_INS_CREQV:
-		case PPC_INS_CRXOR:
-			REQUIRE3OPS
-			ei0 = il.Flag(oper1->reg - PPC_REG_R0);
-			ei1 = il.Flag(oper2->reg - PPC_REG_R0);
-			ei0 = il.Xor(0, ei0, ei1);
-			if (insn->id == PPC_INS_CREQV)
-				ei0 = il.Not(0, ei0);
-			il.AddInstruction(il.SetFlag(oper0->reg - PPC_REG_R0, ei0));
-			break;
+static bool LiftCror(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Flag(oper[1]->reg - PPC_REG_R0);
+	ei1 = il.Flag(oper[2]->reg - PPC_REG_R0);
+	if (insn->id == PPC_INS_CRORC)
+		ei1 = il.Not(0, ei1);
+	ei0 = il.Or(0, ei0, ei1);
+	if (insn->id == PPC_INS_CRNOR)
+		ei0 = il.Not(0, ei0);
+	il.AddInstruction(il.SetFlag(oper[0]->reg - PPC_REG_R0, ei0));
+	return true;
+}
 
-		case PPC_INS_CRSET:
-			REQUIRE1OP
-			ei0 = il.SetFlag(oper0->reg - PPC_REG_R0, il.Const(0, 1));
-			il.AddInstruction(ei0);
-			break;
+static bool LiftCreqv(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Flag(oper[1]->reg - PPC_REG_R0);
+	ei1 = il.Flag(oper[2]->reg - PPC_REG_R0);
+	ei0 = il.Xor(0, ei0, ei1);
+	if (insn->id == PPC_INS_CREQV)
+		ei0 = il.Not(0, ei0);
+	il.AddInstruction(il.SetFlag(oper[0]->reg - PPC_REG_R0, ei0));
+	return true;
+}
 
-		case PPC_INS_CRCLR:
-			REQUIRE1OP
-			ei0 = il.SetFlag(oper0->reg - PPC_REG_R0, il.Const(0, 0));
-			il.AddInstruction(ei0);
-			break;
+static bool LiftCrset(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
 
-		case PPC_INS_CRNOT:
-		case PPC_INS_CRMOVE:
-			REQUIRE2OPS
-			ei0 = il.Flag(oper1->reg - PPC_REG_R0);
-			if (insn->id == PPC_INS_CRNOT)
-				ei0 = il.Not(0, ei0);
-			ei0 = il.SetFlag(oper0->reg - PPC_REG_R0, ei0);
-			il.AddInstruction(ei0);
-			break;
+	ei0 = il.SetFlag(oper[0]->reg - PPC_REG_R0, il.Const(0, 1));
+	il.AddInstruction(ei0);
+	return true;
+}
 
-		case PPC_INS_MFCR:
-			REQUIRE1OP
-			il.AddInstruction(il.SetRegister(4, oper0->reg,
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT, 31),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT, 30),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ, 29),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO, 28),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_1, 27),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_1, 26),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_1, 25),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO_1, 24),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_2, 23),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_2, 22),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_2, 21),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO_2, 20),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_3, 19),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_3, 18),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_3, 17),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO_3, 16),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_4, 15),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_4, 14),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_4, 13),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO_4, 12),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_5, 11),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_5, 10),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_5, 9),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO_5, 8),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_6, 7),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_6, 6),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_6, 5),
-				il.Or(4, il.FlagBit(4, IL_FLAG_SO_6, 4),
-				il.Or(4, il.FlagBit(4, IL_FLAG_LT_7, 3),
-				il.Or(4, il.FlagBit(4, IL_FLAG_GT_7, 2),
-				il.Or(4, il.FlagBit(4, IL_FLAG_EQ_7, 1),
-				il.FlagBit(4, IL_FLAG_SO_7, 0))))))))))))))))))))))))))))))))));
-			break;
-
-		case PPC_INS_MTCRF:
-			REQUIRE2OPS
-			for (uint8_t test = 0x80, i = 0; test; test >>= 1, i++)
-			{
-				if (test & oper0->imm)
-				{
-					ei0 = il.Or(4, il.Register(4, oper1->reg), il.Const(4, 0), IL_FLAGWRITE_MTCR0 + i);
-					il.AddInstruction(ei0);
-				}
-			}
-			break;
+static bool LiftCrclr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
 
-		case PPC_INS_EXTSB:
-		case PPC_INS_EXTSH:
-			REQUIRE2OPS
-			ei0 = il.Register(4, oper1->reg);
-			if (insn->id == PPC_INS_EXTSB)
-				ei0 = il.LowPart(1, ei0);
-			else
-				ei0 = il.LowPart(2, ei0);
-			ei0 = il.SignExtend(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
-			break;
+	ei0 = il.SetFlag(oper[0]->reg - PPC_REG_R0, il.Const(0, 0));
+	il.AddInstruction(ei0);
+	return true;
+}
 
-		case PPC_INS_ISEL:
-			REQUIRE4OPS
-			{
-				LowLevelILLabel trueLabel, falseLabel, doneLabel;
-				uint32_t crBit = oper3->reg - PPC_REG_R0;
-				uint32_t cr = crBit / 4;
+static bool LiftCrnot(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
 
-				switch (crBit % 4)
-				{
-				case 3:
-					// summary overflow - no nice conditions right now
-					ei0 = il.Flag(IL_FLAG_LT + crBit);
-					break;
-				default:
-					// turn it into the simplest flag groups/conditionals
-					// the flag groups representing set bits are always even,
-					// and each cr's flag group starts at a multiple of 10
-					ei0 = il.FlagGroup(IL_FLAGGROUP_CR0_LT + (cr * 10) + ((crBit % 4) * 2));
-					break;
-				}
+	ei0 = il.Flag(oper[1]->reg - PPC_REG_R0);
+	if (insn->id == PPC_INS_CRNOT)
+		ei0 = il.Not(0, ei0);
+	ei0 = il.SetFlag(oper[0]->reg - PPC_REG_R0, ei0);
+	il.AddInstruction(ei0);
+	return true;
+}
 
-				ei1 = il.Register(4, oper1->reg);
-				ei2 = il.Register(4, oper2->reg);
-				il.AddInstruction(il.If(ei0, trueLabel, falseLabel));
+static bool LiftMfcr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	/* one flag group per field, so the same shape as LiftCrfMfcr; each
+	 * group still requires its four flags */
+	ExprId ei0 = il.FlagGroup(7 * 10 + IL_FLAGGROUP_CR0_FIELD);
 
-				/* true case */
-				il.MarkLabel(trueLabel);
-				ei0 = il.SetRegister(4, oper0->reg, ei1);
-				il.AddInstruction(ei0);
-				il.AddInstruction(il.Goto(doneLabel));
+	for (uint32_t i = 1; i < 8; i++)
+		ei0 = il.Or(4, il.ShiftLeft(4, il.FlagGroup((7 - i) * 10 + IL_FLAGGROUP_CR0_FIELD), il.Const(4, 4 * i)), ei0);
 
-				/* false case */
-				il.MarkLabel(falseLabel);
-				ei0 = il.SetRegister(4, oper0->reg, ei2);
-				il.AddInstruction(ei0);
-				il.AddInstruction(il.Goto(doneLabel));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0));
+	return true;
+}
+
+static bool LiftMtcrf(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	for (uint8_t test = 0x80, i = 0; test; test >>= 1, i++)
+	{
+		if (test & oper[0]->imm)
+		{
+			ei0 = il.Or(4, il.Register(4, oper[1]->reg), il.Const(4, 0), IL_FLAGWRITE_MTCR0 + i);
+			il.AddInstruction(ei0);
+		}
+	}
+	return true;
+}
+
+static bool LiftExtsb(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	if (insn->id == PPC_INS_EXTSB)
+		ei0 = il.LowPart(1, ei0);
+	else
+		ei0 = il.LowPart(2, ei0);
+	ei0 = il.SignExtend(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+/* rD = cond ? rA : rB */
+static void LiftSelect(LowLevelILFunction &il, cs_ppc_op **oper, ExprId cond)
+{
+	LowLevelILLabel trueLabel, falseLabel, doneLabel;
+
+	il.AddInstruction(il.If(cond, trueLabel, falseLabel));
+
+	/* true case */
+	il.MarkLabel(trueLabel);
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, il.Register(4, oper[1]->reg)));
+	il.AddInstruction(il.Goto(doneLabel));
+
+	/* false case */
+	il.MarkLabel(falseLabel);
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, il.Register(4, oper[2]->reg)));
+	il.AddInstruction(il.Goto(doneLabel));
+
+	/* done */
+	il.MarkLabel(doneLabel);
+}
+
+static bool LiftIsel(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	uint32_t crBit = oper[3]->reg - PPC_REG_R0;
+	uint32_t cr = crBit / 4;
+
+	switch (crBit % 4)
+	{
+	case 3:
+		// summary overflow - no nice conditions right now
+		ei0 = il.Flag(IL_FLAG_LT + crBit);
+		break;
+	default:
+		// turn it into the simplest flag groups/conditionals
+		// the flag groups representing set bits are always even,
+		// and each cr's flag group starts at a multiple of 10
+		ei0 = il.FlagGroup(IL_FLAGGROUP_CR0_LT + (cr * 10) + ((crBit % 4) * 2));
+		break;
+	}
+
+	LiftSelect(il, oper, ei0);
+	return true;
+}
+
+/* lmw/stmw (and the VLE forms): the effective address is computed into a
+ * temporary once and every register gets its own load or store off of it, so
+ * each save remains a separate stack slot for analysis */
+static void LiftMultipleWord(LowLevelILFunction &il, bool load, uint32_t rS, ExprId ea)
+{
+	ExprId ei0;
+
+	il.AddInstruction(il.SetRegister(4, LLIL_TEMP(0), ea));
+
+	for (uint32_t i = rS; i <= PPC_REG_R31; i++)
+	{
+		ei0 = il.Register(4, LLIL_TEMP(0));
+		if (i != rS)
+			ei0 = il.Add(4, ei0, il.Const(4, (i - rS) * 4));
+
+		if (load)
+			il.AddInstruction(il.SetRegister(4, i, il.Load(4, ei0)));
+		else
+			il.AddInstruction(il.Store(4, ei0, il.Register(4, i)));
+	}
+}
+
+static bool LiftLmw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftMultipleWord(il, true, oper[0]->reg, operToIL(il, oper[1], OTI_GPR0_ZERO));
+	return true;
+}
+
+/*
+	load byte and zero extend [and update]
+*/
+static bool LiftLbz(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO); // d(rA) or 0
+	ei0 = il.Load(1, ei0);                    // [d(rA)]
+	ei0 = il.ZeroExtend(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0); // rD = [d(rA)]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address (d(rA))
+	if(insn->id == PPC_INS_LBZU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/*
+	load half word [and zero/sign extend] [and update]
+*/
+static bool LiftLbzx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO);              // d(rA) or 0
+	ei0 = il.Load(1, il.Add(4, ei0, operToIL(il, oper[2]))); // [d(rA) + d(rB)]
+	ei0 = il.ZeroExtend(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0);              // rD = [d(rA)]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address (d(rA))
+	if(insn->id == PPC_INS_LBZUX && oper[1]->reg != oper[0]->reg && oper[1]->reg != PPC_REG_R0) {
+		ei0 = il.SetRegister(4, oper[1]->reg, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/*
+	load half word [and zero/sign extend] [and update]
+*/
+static bool LiftLhz(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO); // d(rA) or 0
+	ei0 = il.Load(2, ei0);                    // [d(rA)]
+	if(insn->id == PPC_INS_LHZ || insn->id == PPC_INS_LHZU)
+		ei0 = il.ZeroExtend(4, ei0);
+	else
+		ei0 = il.SignExtend(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0); // rD = [d(rA)]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address (d(rA))
+	if(insn->id == PPC_INS_LHZU || insn->id == PPC_INS_LHAU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/*
+	load half word [and zero/sign extend] [and update]
+*/
+static bool LiftLhzx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO);              // d(rA) or 0
+	ei0 = il.Load(2, il.Add(4, ei0, operToIL(il, oper[2]))); // [d(rA) + d(rB)]
+	if(insn->id == PPC_INS_LHZX || insn->id == PPC_INS_LHZUX)
+		ei0 = il.ZeroExtend(4, ei0);
+	else
+		ei0 = il.SignExtend(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0);              // rD = [d(rA)]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address (d(rA))
+	if((insn->id == PPC_INS_LHZUX || insn->id == PPC_INS_LHAUX) && oper[1]->reg != oper[0]->reg && oper[1]->reg != PPC_REG_R0) {
+		ei0 = il.SetRegister(4, oper[1]->reg, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/*
+	load word [and zero] [and update]
+*/
+static bool LiftLwz(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO); // d(rA) or 0
+	ei0 = il.Load(4, ei0);                    // [d(rA)]
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0); // rD = [d(rA)]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address (d(rA))
+	if(insn->id == PPC_INS_LWZU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/*
+	load word [and zero] [and update]
+*/
+static bool LiftLwzx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO);              // d(rA) or 0
+	ei0 = il.Load(4, il.Add(4, ei0, operToIL(il, oper[2]))); // [d(rA) + d(rB)]
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0);              // rD = [d(rA)]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address (d(rA))
+	if(insn->id == PPC_INS_LWZUX && oper[1]->reg != oper[0]->reg && oper[1]->reg != PPC_REG_R0) {
+		ei0 = il.SetRegister(4, oper[1]->reg, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+static bool LiftLhbrx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ByteReversedLoad(il, ppc, 2);
+	return true;
+}
+
+static bool LiftLwbrx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ByteReversedLoad(il, ppc, 4);
+	return true;
+}
+
+static bool LiftSthbrx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ByteReversedStore(il, ppc, 2);
+	return true;
+}
+
+static bool LiftStwbrx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ByteReversedStore(il, ppc, 4);
+	return true;
+}
+
+static bool LiftLdbrx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ByteReversedLoad(il, ppc, 8);
+	return true;
+}
+
+static bool LiftStdbrx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ByteReversedStore(il, ppc, 8);
+	return true;
+}
+
+/*
+	load doubleword [and update] [indexed]
+
+	GPRs are lifted as 4 bytes, so like ldbrx the doubleword is truncated to
+	its low word; stores zero extend rS back out to 8 bytes
+*/
+static bool LiftLd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO);                  // d(rA) or 0
+	if(insn->id == PPC_INS_LDX || insn->id == PPC_INS_LDUX)
+		ei0 = il.Add(4, ei0, operToIL(il, oper[2]));             // (rA|0) + (rB)
+	ei0 = il.LowPart(4, il.Load(8, ei0));                        // [EA].q
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0);                  // rD = [EA]
+	il.AddInstruction(ei0);
+
+	// if update, rA is set to effective address
+	if(insn->id == PPC_INS_LDU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	else if(insn->id == PPC_INS_LDUX && oper[1]->reg != oper[0]->reg && oper[1]->reg != PPC_REG_R0) {
+		ei0 = il.SetRegister(4, oper[1]->reg, il.Add(4, operToIL(il, oper[1]), operToIL(il, oper[2])));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+static bool LiftStd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[1], OTI_GPR0_ZERO);                  // d(rA) or 0
+	if(insn->id == PPC_INS_STDX || insn->id == PPC_INS_STDUX)
+		ei0 = il.Add(4, ei0, operToIL(il, oper[2]));             // (rA|0) + (rB)
+	ei0 = il.Store(8, ei0, il.ZeroExtend(8, operToIL(il, oper[0]))); // [EA].q = rS
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STDU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	else if(insn->id == PPC_INS_STDUX) {
+		ei0 = il.SetRegister(4, oper[1]->reg, il.Add(4, operToIL(il, oper[1]), operToIL(il, oper[2])));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+static uint32_t SprRegister(uint32_t spr)
+{
+	switch (spr)
+	{
+		case 8: return PPC_REG_LR;
+		case 9: return PPC_REG_CTR;
+		case 256: return PPC_REG_VRSAVE;
+		case 284: return PPC_REG_SPR0 + 268; /* tbl, tbu as written */
+		case 285: return PPC_REG_SPR0 + 269;
+		default: return PPC_REG_SPR0 + (spr & 0x3ff);
+	}
+}
+
+/* the dispatcher hands every spr move over as "mfspr rD, spr"; xer's so, ov
+ * and ca bits live in flags and are merged in */
+static bool LiftMfspr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t spr = oper[1]->imm;
+	ExprId ei0 = il.Register(4, SprRegister(spr));
+
+	if (spr == 1)
+		ei0 = il.Or(4,
+			il.And(4, ei0, il.Const(4, 0x1fffffff)),
+			il.Or(4,
+				il.Or(4,
+					il.ShiftLeft(4, il.BoolToInt(4, il.Flag(IL_FLAG_XER_SO)), il.Const(4, 31)),
+					il.ShiftLeft(4, il.BoolToInt(4, il.Flag(IL_FLAG_XER_OV)), il.Const(4, 30))),
+				il.ShiftLeft(4, il.BoolToInt(4, il.Flag(IL_FLAG_XER_CA)), il.Const(4, 29))));
+
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0));
+	return true;
+}
+
+/* "mtspr spr, rS" */
+static bool LiftMtspr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t spr = oper[0]->imm;
+
+	il.AddInstruction(il.SetRegister(4, SprRegister(spr), operToIL(il, oper[1])));
+
+	if (spr == 1)
+	{
+		const uint32_t flags[] = { IL_FLAG_XER_SO, IL_FLAG_XER_OV, IL_FLAG_XER_CA };
+		for (int i = 0; i < 3; i++)
+			il.AddInstruction(il.SetFlag(flags[i],
+				il.CompareNotEqual(4,
+					il.And(4, operToIL(il, oper[1]), il.Const(4, 0x80000000 >> i)),
+					il.Const(4, 0))));
+	}
+
+	return true;
+}
+
+static bool LiftMfmsr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, il.Register(4, PPC_REG_MSR)));
+	return true;
+}
+
+static bool LiftMtmsr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.SetRegister(4, PPC_REG_MSR, operToIL(il, oper[0])));
+	return true;
+}
+
+static bool LiftNeg(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Neg(4, operToIL(il, oper[1]));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftNop(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.Nop());
+	return true;
+}
+
+static bool LiftNot(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Not(4, operToIL(il, oper[1]));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftOr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = operToIL(il, oper[2]);
+	if (insn->id == PPC_INS_ORC)
+		ei0 = il.Not(4, ei0);
+	ei0 = il.Or(4, operToIL(il, oper[1]), ei0);
+	if (insn->id == PPC_INS_NOR)
+		ei0 = il.Not(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftOri(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	if (insn->id == PPC_INS_ORIS)
+		ei0 = il.Const(4, oper[2]->imm << 16);
+	else
+		ei0 = il.Const(4, oper[2]->imm);
+	ei0 = il.Or(4, operToIL(il, oper[1]), ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftXor(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Xor(4,
+		operToIL(il, oper[1]),
+		operToIL(il, oper[2])
+	);
+	if (insn->id == PPC_INS_EQV)
+		ei0 = il.Not(4, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftXori(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	if (insn->id == PPC_INS_XORIS)
+		ei0 = il.Const(4, oper[2]->imm << 16);
+	else
+		ei0 = il.Const(4, oper[2]->imm);
+	ei0 = il.SetRegister(
+		4,
+		oper[0]->reg,
+		il.Xor(4,
+			operToIL(il, oper[1]),
+			ei0
+		)
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftSubf(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Sub(
+		4,
+		operToIL(il, oper[2]),
+		operToIL(il, oper[1]),
+		(insn->id != PPC_INS_SUBF) ? IL_FLAGWRITE_XER_CA : 0
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftSubfe(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.SubBorrow(
+		4,
+		operToIL(il, oper[2]),
+		operToIL(il, oper[1]),
+		il.Flag(IL_FLAG_XER_CA),
+		IL_FLAGWRITE_XER_CA
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftSubfme(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	if (insn->id == PPC_INS_SUBFME)
+		ei0 = il.Const(4, 0xffffffff);
+	else
+		ei0 = il.Const(4, 0);
+	ei0 = il.AddCarry(
+		4,
+		ei0,
+		operToIL(il, oper[1]),
+		il.Flag(IL_FLAG_XER_CA),
+		IL_FLAGWRITE_XER_CA
+	);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+		ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftStmw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftMultipleWord(il, false, oper[0]->reg, operToIL(il, oper[1], OTI_GPR0_ZERO));
+	return true;
+}
+
+/* store half word [with update] */
+static bool LiftStb(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Store(1,
+		operToIL(il, oper[1], OTI_GPR0_ZERO),
+		il.LowPart(1, operToIL(il, oper[0]))
+	);
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STBU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/* store half word indexed [with update] */
+static bool LiftStbx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Store(1,
+		il.Add(4, operToIL(il, oper[1], OTI_GPR0_ZERO), operToIL(il, oper[2])),
+		il.LowPart(1, operToIL(il, oper[0]))
+	);
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STBUX) {
+		ei0 = il.SetRegister(4, oper[1]->reg,
+			il.Add(4, operToIL(il, oper[1]), operToIL(il, oper[2]))
+		);
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/* store half word [with update] */
+static bool LiftSth(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Store(2,
+		operToIL(il, oper[1], OTI_GPR0_ZERO),
+		il.LowPart(2, operToIL(il, oper[0]))
+	);
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STHU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/* store half word indexed [with update] */
+static bool LiftSthx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Store(2,
+		il.Add(4, operToIL(il, oper[1], OTI_GPR0_ZERO), operToIL(il, oper[2])),
+		il.LowPart(2, operToIL(il, oper[0]))
+	);
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STHUX) {
+		ei0 = il.SetRegister(4, oper[1]->reg,
+			il.Add(4, operToIL(il, oper[1]), operToIL(il, oper[2]))
+		);
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/* store word [with update] */
+static bool LiftStw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Store(4,
+		operToIL(il, oper[1], OTI_GPR0_ZERO),
+		operToIL(il, oper[0])
+	);
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STWU) {
+		ei0 = il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1]));
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+/* store word indexed [with update] */
+static bool LiftStwx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Store(4,
+		il.Add(4, operToIL(il, oper[1], OTI_GPR0_ZERO), operToIL(il, oper[2])),
+		operToIL(il, oper[0])
+	);
+	il.AddInstruction(ei0);
+
+	// if update, then rA gets updated address
+	if(insn->id == PPC_INS_STWUX) {
+		ei0 = il.SetRegister(4, oper[1]->reg,
+			il.Add(4, operToIL(il, oper[1]), operToIL(il, oper[2]))
+		);
+		il.AddInstruction(ei0);
+	}
+	return true;
+}
+
+static bool LiftRlwimi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = RotateAndInsert(il, oper[0]->reg, oper[1]->reg, oper[2]->imm, oper[3]->imm, oper[4]->imm);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftRlwinm(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = RotateAndMask(il, oper[1]->reg, oper[2]->imm, oper[3]->imm, oper[4]->imm);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftSlwi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Const(4, oper[2]->imm);           // amt: shift amount
+	ei1 = il.Register(4, oper[1]->reg);        //  rS: reg to be shifted
+	ei0 = il.ShiftLeft(4, ei1, ei0);         // (rS << amt)
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0, // rD = (rs << amt)
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftSrwi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Const(4, oper[2]->imm);           // amt: shift amount
+	ei1 = il.Register(4, oper[1]->reg);        //  rS: reg to be shifted
+	ei0 = il.LogicalShiftRight(4, ei1, ei0);        // (rS << amt)
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0, // rD = (rs << amt)
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftClrlwi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Const(4, (uint32_t) (0xffffffff >> oper[2]->imm));
+	ei1 = il.Register(4, oper[1]->reg);
+	ei0 = il.And(4, ei1, ei0);
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftRotlwi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.RotateLeft(4, ei0, il.Const(4, oper[2]->imm));
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftRotlw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	uint32_t mask = 0xffffffff;
+	if (insn->id == PPC_INS_RLWNM)
+	{
+		if (!oper[3] || !oper[4])
+			return false;
+		mask = genMask(oper[3]->imm, oper[4]->imm);
+	}
+	ei0 = il.Register(4, oper[1]->reg);
+	ei1 = il.Register(4, oper[2]->reg);
+	ei1 = il.And(4, ei1, il.Const(4, 0x1f));
+	ei0 = il.RotateLeft(4, ei0, ei1);
+	if (mask != 0xffffffff)
+		ei0 = il.And(4, ei0, il.Const(4, mask));
+	ei0 = il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	);
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftSlw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	// permit bit 26 to survive to enable clearing the whole register
+	ei1 = il.And(4, il.Register(4, oper[2]->reg), il.Const(4, 0x3f));
+	if (insn->id == PPC_INS_SLW)
+		ei0 = il.ShiftLeft(4, ei0, ei1);
+	else
+		ei0 = il.LogicalShiftRight(4, ei0, ei1);
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftSraw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei1 = il.And(4, il.Register(4, oper[2]->reg), il.Const(4, 0x1f));
+	ei0 = il.ArithShiftRight(4, ei0, ei1, IL_FLAGWRITE_XER_CA);
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftSrawi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.ArithShiftRight(4, ei0, il.Const(4, oper[2]->imm), IL_FLAGWRITE_XER_CA);
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftMullw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.Mult(4, ei0, il.Register(4, oper[2]->reg));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftMulli(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.Mult(4, ei0, il.Const(4, oper[2]->imm));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0));
+	return true;
+}
+
+static bool LiftMulhw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.MultDoublePrecSigned(4, ei0, il.Register(4, oper[2]->reg));
+	ei0 = il.LowPart(4, il.LogicalShiftRight(8, ei0, il.Const(1, 32)));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftMulhwu(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.MultDoublePrecUnsigned(4, ei0, il.Register(4, oper[2]->reg));
+	ei0 = il.LowPart(4, il.LogicalShiftRight(8, ei0, il.Const(1, 32)));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftDivw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.DivSigned(4, ei0, il.Register(4, oper[2]->reg));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftDivwu(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	ei0 = il.Register(4, oper[1]->reg);
+	ei0 = il.DivUnsigned(4, ei0, il.Register(4, oper[2]->reg));
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0,
+			ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
+	));
+	return true;
+}
+
+static bool LiftMr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, operToIL(il, oper[1])));
+	return true;
+}
+
+static bool LiftSc(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.SystemCall());
+	return true;
+}
+
+/* rfi and friends restore the msr from the second save/restore register of
+ * their pair and return through the first */
+static void LiftReturnFromInterrupt(LowLevelILFunction &il, uint32_t srr0)
+{
+	il.AddInstruction(il.SetRegister(4, PPC_REG_MSR, il.Register(4, PPC_REG_SPR0 + srr0 + 1)));
+	il.AddInstruction(il.Return(il.Register(4, PPC_REG_SPR0 + srr0)));
+}
+
+static bool LiftRfi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	switch (insn->id)
+	{
+		case PPC_INS_RFCI:  LiftReturnFromInterrupt(il, 58); break;  /* csrr0 */
+		case PPC_INS_RFDI:  LiftReturnFromInterrupt(il, 574); break; /* dsrr0 */
+		case PPC_INS_RFMCI: LiftReturnFromInterrupt(il, 570); break; /* mcsrr0 */
+		default:            LiftReturnFromInterrupt(il, 26); break;  /* srr0 */
+	}
+	return true;
+}
+
+static bool LiftTrap(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.Trap(0));
+	return true;
+}
+
+/* Floating point. FPRs are 8 bytes and always hold a double; single
+ * precision results are rounded through a 4 byte conversion. The FPSCR is
+ * only modelled as far as the instructions that move it around. */
+static ExprId RoundToSingle(LowLevelILFunction &il, ExprId value)
+{
+	return il.FloatConvert(8, il.FloatConvert(4, value));
+}
+
+/* d(rA) for the D forms, (rA|0) + rB for the X forms */
+static ExprId FloatEffectiveAddress(LowLevelILFunction &il, cs_ppc_op **oper)
+{
+	if (oper[1]->type == PPC_OP_MEM)
+		return operToIL(il, oper[1], OTI_GPR0_ZERO);
+
+	return il.Add(4, operToIL(il, oper[1], OTI_GPR0_ZERO), operToIL(il, oper[2]));
+}
+
+static void FloatUpdateBase(LowLevelILFunction &il, cs_ppc_op **oper)
+{
+	if (oper[1]->type == PPC_OP_MEM)
+		il.AddInstruction(il.SetRegister(4, oper[1]->mem.base, operToIL(il, oper[1])));
+	else
+		il.AddInstruction(il.SetRegister(4, oper[1]->reg, il.Add(4, operToIL(il, oper[1]), operToIL(il, oper[2]))));
+}
+
+static ExprId FloatRegister(LowLevelILFunction &il, cs_ppc_op *op)
+{
+	return il.Register(8, op->reg);
+}
+
+/* VSX registers overlap the others: vs0-vs31 hold f0-f31 in their first
+ * doubleword, vs32-vs63 are v0-v31. Vector accesses use vsN for the FPR half
+ * and vN for the rest, scalar ones fN where it exists. */
+static uint32_t VsxVectorRegister(uint32_t reg)
+{
+	if (reg >= PPC_REG_F0 && reg <= PPC_REG_F31)
+		return PPC_REG_VS0 + (reg - PPC_REG_F0);
+	if (reg >= PPC_REG_VS32 && reg <= PPC_REG_VS63)
+		return PPC_REG_V0 + (reg - PPC_REG_VS32);
+	return reg;
+}
+
+static ExprId VsxScalar(LowLevelILFunction &il, uint32_t reg)
+{
+	if (reg >= PPC_REG_VS0 && reg <= PPC_REG_VS31)
+		reg = PPC_REG_F0 + (reg - PPC_REG_VS0);
+	if (reg >= PPC_REG_F0 && reg <= PPC_REG_F31)
+		return il.Register(8, reg);
+
+	return il.LowPart(8, il.LogicalShiftRight(16, il.Register(16, VsxVectorRegister(reg)), il.Const(4, 64)));
+}
+
+/* crF = LT | GT | EQ | UN from an unordered compare of fA and fB, shared by
+ * fcmpu, xscmp[ou]dp and the locally decoded fcmpo */
+static void LiftFloatCompare(LowLevelILFunction &il, uint32_t crf, uint32_t fA, uint32_t fB, bool crRegisters)
+{
+	ExprId lt = il.FloatCompareLessThan(8, VsxScalar(il, fA), VsxScalar(il, fB));
+	ExprId gt = il.FloatCompareGreaterThan(8, VsxScalar(il, fA), VsxScalar(il, fB));
+	ExprId eq = il.FloatCompareEqual(8, VsxScalar(il, fA), VsxScalar(il, fB));
+	ExprId un = il.FloatCompareUnordered(8, VsxScalar(il, fA), VsxScalar(il, fB));
+
+	if (crRegisters)
+	{
+		il.AddInstruction(il.SetRegister(4, crf,
+			il.Or(4,
+				il.Or(4,
+					il.ShiftLeft(4, il.BoolToInt(4, lt), il.Const(4, 3)),
+					il.ShiftLeft(4, il.BoolToInt(4, gt), il.Const(4, 2))),
+				il.Or(4,
+					il.ShiftLeft(4, il.BoolToInt(4, eq), il.Const(4, 1)),
+					il.BoolToInt(4, un)))));
+		return;
+	}
+
+	uint32_t flagBase = (crf - PPC_REG_CR0) * 4;
+
+	il.AddInstruction(il.SetFlag(flagBase + IL_FLAG_LT, lt));
+	il.AddInstruction(il.SetFlag(flagBase + IL_FLAG_GT, gt));
+	il.AddInstruction(il.SetFlag(flagBase + IL_FLAG_EQ, eq));
+	il.AddInstruction(il.SetFlag(flagBase + IL_FLAG_SO, un));
+}
+
+/* record forms ("fadd.") copy FPSCR[FX,FEX,VX,OX] into cr1 */
+static void LiftFloatRecord(LowLevelILFunction &il, bool crRegisters)
+{
+	if (crRegisters)
+	{
+		il.AddInstruction(il.SetRegister(4, PPC_REG_CR1,
+			il.LogicalShiftRight(4, il.Register(4, PPC_REG_FPSCR), il.Const(4, 28))));
+		return;
+	}
+
+	for (uint32_t i = 0; i < 4; i++)
+		il.AddInstruction(il.SetFlag(IL_FLAG_LT_1 + i,
+			il.CompareNotEqual(4,
+				il.And(4, il.Register(4, PPC_REG_FPSCR), il.Const(4, 0x80000000 >> i)),
+				il.Const(4, 0))));
+}
+
+static bool LiftLfs(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	switch (insn->id)
+	{
+		case PPC_INS_LFD:
+		case PPC_INS_LFDU:
+		case PPC_INS_LFDX:
+		case PPC_INS_LFDUX:
+			ei0 = il.Load(8, FloatEffectiveAddress(il, oper)); // [ea].d
+			break;
+		case PPC_INS_LFIWAX:
+			ei0 = il.SignExtend(8, il.Load(4, FloatEffectiveAddress(il, oper)));
+			break;
+		case PPC_INS_LFIWZX:
+			ei0 = il.ZeroExtend(8, il.Load(4, FloatEffectiveAddress(il, oper)));
+			break;
+		default:
+			ei0 = il.FloatConvert(8, il.Load(4, FloatEffectiveAddress(il, oper))); // (double)[ea].s
+			break;
+	}
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei0));
+
+	// if update, rA is set to the effective address
+	switch (insn->id)
+	{
+		case PPC_INS_LFSU:
+		case PPC_INS_LFSUX:
+		case PPC_INS_LFDU:
+		case PPC_INS_LFDUX:
+			FloatUpdateBase(il, oper);
+			break;
+	}
+	return true;
+}
+
+static bool LiftStfs(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = FloatRegister(il, oper[0]);
+	size_t size = 4;
+
+	switch (insn->id)
+	{
+		case PPC_INS_STFD:
+		case PPC_INS_STFDU:
+		case PPC_INS_STFDX:
+		case PPC_INS_STFDUX:
+			size = 8;
+			break;
+		case PPC_INS_STFIWX:
+			ei0 = il.LowPart(4, ei0);
+			break;
+		default:
+			ei0 = il.FloatConvert(4, ei0);
+			break;
+	}
+	il.AddInstruction(il.Store(size, FloatEffectiveAddress(il, oper), ei0));
+
+	// if update, then rA gets updated address
+	switch (insn->id)
+	{
+		case PPC_INS_STFSU:
+		case PPC_INS_STFSUX:
+		case PPC_INS_STFDU:
+		case PPC_INS_STFDUX:
+			FloatUpdateBase(il, oper);
+			break;
+	}
+	return true;
+}
+
+static bool LiftFmr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = FloatRegister(il, oper[1]);
+
+	switch (insn->id)
+	{
+		case PPC_INS_FNEG:  ei0 = il.FloatNeg(8, ei0); break;
+		case PPC_INS_FABS:  ei0 = il.FloatAbs(8, ei0); break;
+		case PPC_INS_FNABS: ei0 = il.FloatNeg(8, il.FloatAbs(8, ei0)); break;
+		case PPC_INS_FRSP:  ei0 = RoundToSingle(il, ei0); break;
+		case PPC_INS_FRIN:  ei0 = il.RoundToInt(8, ei0); break;
+		case PPC_INS_FRIZ:  ei0 = il.FloatTrunc(8, ei0); break;
+		case PPC_INS_FRIP:  ei0 = il.Ceil(8, ei0); break;
+		case PPC_INS_FRIM:  ei0 = il.Floor(8, ei0); break;
+	}
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei0));
+	return true;
+}
+
+static bool LiftFadd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1, ei2;
+
+	ei0 = FloatRegister(il, oper[1]);
+	ei1 = FloatRegister(il, oper[2]);
+
+	switch (insn->id)
+	{
+		case PPC_INS_FADD:
+		case PPC_INS_FADDS:
+			ei2 = il.FloatAdd(8, ei0, ei1);
+			break;
+		case PPC_INS_FSUB:
+		case PPC_INS_FSUBS:
+			ei2 = il.FloatSub(8, ei0, ei1);
+			break;
+		case PPC_INS_FMUL:
+		case PPC_INS_FMULS:
+			ei2 = il.FloatMult(8, ei0, ei1);
+			break;
+		default:
+			ei2 = il.FloatDiv(8, ei0, ei1);
+			break;
+	}
+
+	if (insn->id == PPC_INS_FADDS || insn->id == PPC_INS_FSUBS || insn->id == PPC_INS_FMULS || insn->id == PPC_INS_FDIVS)
+		ei2 = RoundToSingle(il, ei2);
+
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei2));
+	return true;
+}
+
+/* fmadd fD, fA, fC, fB: fD = (fA * fC) + fB */
+static bool LiftFmadd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+	bool single = false;
+
+	ei0 = il.FloatMult(8, FloatRegister(il, oper[1]), FloatRegister(il, oper[2]));
+
+	switch (insn->id)
+	{
+		case PPC_INS_FMADDS:
+		case PPC_INS_FNMADDS:
+			single = true;
+			/* fall through */
+		case PPC_INS_FMADD:
+		case PPC_INS_FNMADD:
+			ei0 = il.FloatAdd(8, ei0, FloatRegister(il, oper[3]));
+			break;
+		case PPC_INS_FMSUBS:
+		case PPC_INS_FNMSUBS:
+			single = true;
+			/* fall through */
+		default:
+			ei0 = il.FloatSub(8, ei0, FloatRegister(il, oper[3]));
+			break;
+	}
+
+	switch (insn->id)
+	{
+		case PPC_INS_FNMADD:
+		case PPC_INS_FNMADDS:
+		case PPC_INS_FNMSUB:
+		case PPC_INS_FNMSUBS:
+			ei0 = il.FloatNeg(8, ei0);
+			break;
+	}
+
+	if (single)
+		ei0 = RoundToSingle(il, ei0);
+
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei0));
+	return true;
+}
+
+/* the estimates are lifted as the exact operation they approximate */
+static bool LiftFsqrt(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = FloatRegister(il, oper[1]);
+
+	switch (insn->id)
+	{
+		case PPC_INS_FSQRT:
+		case PPC_INS_FSQRTS:
+			ei0 = il.FloatSqrt(8, ei0);
+			break;
+		case PPC_INS_FRE:
+		case PPC_INS_FRES:
+			ei0 = il.FloatDiv(8, il.FloatConstDouble(1.0), ei0);
+			break;
+		default:
+			ei0 = il.FloatDiv(8, il.FloatConstDouble(1.0), il.FloatSqrt(8, ei0));
+			break;
+	}
+
+	switch (insn->id)
+	{
+		case PPC_INS_FSQRTS:
+		case PPC_INS_FRES:
+		case PPC_INS_FRSQRTES:
+			ei0 = RoundToSingle(il, ei0);
+			break;
+	}
+
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei0));
+	return true;
+}
+
+/* integer results land in the low bits of fD */
+static bool LiftFctiw(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = FloatRegister(il, oper[1]);
+
+	/* the forms without z round according to FPSCR[RN] */
+	if (insn->id == PPC_INS_FCTIW || insn->id == PPC_INS_FCTID)
+		ei0 = il.RoundToInt(8, ei0);
+
+	if (insn->id == PPC_INS_FCTID || insn->id == PPC_INS_FCTIDZ || insn->id == PPC_INS_FCTIDUZ)
+		ei0 = il.FloatToInt(8, ei0);
+	else
+		ei0 = il.ZeroExtend(8, il.FloatToInt(4, ei0));
+
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei0));
+	return true;
+}
+
+static bool LiftFcfid(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = il.IntToFloat(8, FloatRegister(il, oper[1]));
+
+	if (insn->id == PPC_INS_FCFIDS || insn->id == PPC_INS_FCFIDUS)
+		ei0 = RoundToSingle(il, ei0);
+
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, ei0));
+	return true;
+}
+
+/* fsel fD, fA, fC, fB: fD = (fA >= 0.0) ? fC : fB */
+static bool LiftFsel(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LowLevelILLabel trueLabel, falseLabel, doneLabel;
+
+	il.AddInstruction(il.If(il.FloatCompareGreaterEqual(8, FloatRegister(il, oper[1]), il.FloatConstDouble(0.0)),
+		trueLabel, falseLabel));
+
+	il.MarkLabel(trueLabel);
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, FloatRegister(il, oper[2])));
+	il.AddInstruction(il.Goto(doneLabel));
+
+	il.MarkLabel(falseLabel);
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, FloatRegister(il, oper[3])));
+	il.AddInstruction(il.Goto(doneLabel));
+
+	il.MarkLabel(doneLabel);
+	return true;
+}
+
+/* fD = sign of fA, magnitude of fB */
+static bool LiftFcpsgn(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = il.And(8, FloatRegister(il, oper[1]), il.Const(8, 0x8000000000000000ull));
+	ExprId ei1 = il.And(8, FloatRegister(il, oper[2]), il.Const(8, 0x7fffffffffffffffull));
+
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, il.Or(8, ei0, ei1)));
+	return true;
+}
+
+static bool LiftFcmpu(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftFloatCompare(il, oper[0]->reg, oper[1]->reg, oper[2]->reg, false);
+	return true;
+}
+
+static bool LiftMffs(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.SetRegister(8, oper[0]->reg, il.ZeroExtend(8, il.Register(4, PPC_REG_FPSCR))));
+	return true;
+}
+
+/* mtfsf FM, fB: every FM bit selects a 4 bit FPSCR field, msb first */
+static bool LiftMtfsf(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t mask = 0;
+
+	for (uint32_t i = 0; i < 8; i++)
+		if (oper[0]->imm & (0x80 >> i))
+			mask |= 0xf0000000 >> (4 * i);
+
+	il.AddInstruction(il.SetRegister(4, PPC_REG_FPSCR,
+		il.Or(4,
+			il.And(4, il.Register(4, PPC_REG_FPSCR), il.Const(4, ~mask)),
+			il.And(4, il.LowPart(4, FloatRegister(il, oper[1])), il.Const(4, mask)))));
+	return true;
+}
+
+static bool LiftMtfsb0(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t bit = 0x80000000 >> (oper[0]->imm & 31);
+	ExprId ei0 = il.Register(4, PPC_REG_FPSCR);
+
+	if (insn->id == PPC_INS_MTFSB1)
+		ei0 = il.Or(4, ei0, il.Const(4, bit));
+	else
+		ei0 = il.And(4, ei0, il.Const(4, ~bit));
+
+	il.AddInstruction(il.SetRegister(4, PPC_REG_FPSCR, ei0));
+	return true;
+}
+
+/* AltiVec. Vector registers are 16 bytes; loads and stores are real memory
+ * operations, logic ops are plain LLIL and everything else is an intrinsic
+ * named after the instruction (see VMX_INTRINSICS). */
+static uint32_t GetVectorIntrinsic(uint32_t id, const char** inputs, char* output)
+{
+	switch (id)
+	{
+		#define VECTOR_CASE(id, name, inputs_, output_) \
+		case PPC_INS_##id: *inputs = inputs_; *output = output_; return PPC_INTRIN_##id;
+		VECTOR_INTRINSICS(VECTOR_CASE)
+		#undef VECTOR_CASE
+		default: return 0;
+	}
+}
+
+/* (rA|0) + rB */
+static ExprId VectorEffectiveAddress(LowLevelILFunction &il, cs_ppc_op **oper)
+{
+	return il.Add(4, operToIL(il, oper[1], OTI_GPR0_ZERO), operToIL(il, oper[2]));
+}
+
+static bool IsVectorRegister(uint32_t reg)
+{
+	return (reg >= PPC_REG_V0 && reg <= PPC_REG_V31) || (reg >= PPC_REG_VS0 && reg <= PPC_REG_VS63);
+}
+
+/* vcmp*. sets cr6 to all true (LT) / all false (EQ); for vcmpbfp. only EQ,
+ * meaning all elements were within bounds */
+static void LiftVectorRecord(LowLevelILFunction &il, uint32_t id, uint32_t vD, bool crRegisters)
+{
+	ExprId allTrue, allFalse;
+
+	if (id == PPC_INS_VCMPBFP)
+		allTrue = crRegisters ? il.Const(4, 0) : il.Const(0, 0);
+	else
+		allTrue = il.CompareEqual(16, il.Not(16, il.Register(16, vD)), il.Const(16, 0));
+	allFalse = il.CompareEqual(16, il.Register(16, vD), il.Const(16, 0));
+
+	if (crRegisters)
+	{
+		if (id != PPC_INS_VCMPBFP)
+			allTrue = il.BoolToInt(4, allTrue);
+		il.AddInstruction(il.SetRegister(4, PPC_REG_CR6,
+			il.Or(4,
+				il.ShiftLeft(4, allTrue, il.Const(4, 3)),
+				il.ShiftLeft(4, il.BoolToInt(4, allFalse), il.Const(4, 1)))));
+		return;
+	}
+
+	il.AddInstruction(il.SetFlag(IL_FLAG_LT_6, allTrue));
+	il.AddInstruction(il.SetFlag(IL_FLAG_GT_6, il.Const(0, 0)));
+	il.AddInstruction(il.SetFlag(IL_FLAG_EQ_6, allFalse));
+	il.AddInstruction(il.SetFlag(IL_FLAG_SO_6, il.Const(0, 0)));
+}
+
+/* lvx/stvx ignore the low four bits of the effective address */
+static bool LiftLvx(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ea = il.And(4, VectorEffectiveAddress(il, oper), il.Const(4, ~0xf));
+
+	if (insn->id == PPC_INS_STVX || insn->id == PPC_INS_STVXL)
+		il.AddInstruction(il.Store(16, ea, il.Register(16, oper[0]->reg)));
+	else
+		il.AddInstruction(il.SetRegister(16, oper[0]->reg, il.Load(16, ea)));
+	return true;
+}
+
+static bool LiftVand(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0, ei1;
+
+	ei0 = il.Register(16, VsxVectorRegister(oper[1]->reg));
+	ei1 = il.Register(16, VsxVectorRegister(oper[2]->reg));
+
+	switch (insn->id)
+	{
+		case PPC_INS_VAND:
+		case PPC_INS_XXLAND:
+			ei0 = il.And(16, ei0, ei1);
+			break;
+		case PPC_INS_VANDC:
+		case PPC_INS_XXLANDC:
+			ei0 = il.And(16, ei0, il.Not(16, ei1));
+			break;
+		case PPC_INS_VOR:
+		case PPC_INS_XXLOR:
+			if (oper[1]->reg != oper[2]->reg) /* vmr, xxlmr */
+				ei0 = il.Or(16, ei0, ei1);
+			break;
+		case PPC_INS_VXOR:
+		case PPC_INS_XXLXOR:
+			ei0 = il.Xor(16, ei0, ei1);
+			break;
+		default:
+			ei0 = il.Not(16, il.Or(16, ei0, ei1));
+			break;
+	}
+
+	il.AddInstruction(il.SetRegister(16, VsxVectorRegister(oper[0]->reg), ei0));
+	return true;
+}
+
+/* one intrinsic input of the given VECTOR_INTRINSICS kind */
+static ExprId VectorIntrinsicInput(LowLevelILFunction &il, cs_ppc_op *op, char kind)
+{
+	if (op->type == PPC_OP_IMM)
+		return il.Const(4, op->imm);
+
+	switch (kind)
+	{
+		case 'v':
+		case 'V':
+			return il.Register(16, VsxVectorRegister(op->reg));
+		case 'd':
+		case 'D':
+			return VsxScalar(il, op->reg);
+		default:
+			return il.Register(4, op->reg);
+	}
+}
+
+static bool LiftVectorIntrinsic(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	const char* kinds = "";
+	char output = 0;
+	uint32_t intrinsic = GetVectorIntrinsic(insn->id, &kinds, &output);
+	std::vector<ExprId> inputs;
+	ExprId ea;
+	size_t size = 4;
+
+	switch (insn->id)
+	{
+		case PPC_INS_LVEBX:
+		case PPC_INS_LVEHX:
+		case PPC_INS_LVEWX:
+			if (!oper[2])
+				return false;
+			size = (insn->id == PPC_INS_LVEBX) ? 1 : (insn->id == PPC_INS_LVEHX) ? 2 : 4;
+			ea = VectorEffectiveAddress(il, oper);
+			inputs.push_back(il.Load(size, il.And(4, ea, il.Const(4, ~(size - 1)))));
+			inputs.push_back(VectorEffectiveAddress(il, oper));
+			il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(oper[0]->reg) }, intrinsic, inputs));
+			return true;
+
+		case PPC_INS_STVEBX:
+		case PPC_INS_STVEHX:
+		case PPC_INS_STVEWX:
+			if (!oper[2])
+				return false;
+			size = (insn->id == PPC_INS_STVEBX) ? 1 : (insn->id == PPC_INS_STVEHX) ? 2 : 4;
+			inputs.push_back(il.Register(16, oper[0]->reg));
+			inputs.push_back(VectorEffectiveAddress(il, oper));
+			il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(LLIL_TEMP(0)) }, intrinsic, inputs));
+			ea = il.And(4, VectorEffectiveAddress(il, oper), il.Const(4, ~(size - 1)));
+			il.AddInstruction(il.Store(size, ea, il.Register(size, LLIL_TEMP(0))));
+			return true;
+
+		case PPC_INS_LVSL:
+		case PPC_INS_LVSR:
+			if (!oper[2])
+				return false;
+			inputs.push_back(VectorEffectiveAddress(il, oper));
+			il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(oper[0]->reg) }, intrinsic, inputs));
+			return true;
+
+		case PPC_INS_MTVSCR:
+			inputs.push_back(il.Register(16, oper[0]->reg));
+			il.AddInstruction(il.Intrinsic({}, intrinsic, inputs));
+			return true;
+	}
+
+	/* upper case kinds read the target, the rest the following operands */
+	for (int i = (kinds[0] >= 'A' && kinds[0] <= 'Z') ? 0 : 1; *kinds; kinds++, i++)
+	{
+		if (i >= 5 || !oper[i] || (oper[i]->type != PPC_OP_REG && oper[i]->type != PPC_OP_IMM))
+			return false;
+		inputs.push_back(VectorIntrinsicInput(il, oper[i], *kinds));
+	}
+
+	uint32_t vD = oper[0]->reg;
+
+	/* scalar results go to fN, or the first doubleword of vN */
+	if (output == 'd')
+	{
+		if (vD >= PPC_REG_VS0 && vD <= PPC_REG_VS31)
+			vD = PPC_REG_F0 + (vD - PPC_REG_VS0);
+
+		if (vD < PPC_REG_F0 || vD > PPC_REG_F31)
+		{
+			il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(LLIL_TEMP(0)) }, intrinsic, inputs));
+			il.AddInstruction(il.SetRegister(16, VsxVectorRegister(vD),
+				il.ShiftLeft(16, il.ZeroExtend(16, il.Register(8, LLIL_TEMP(0))), il.Const(4, 64))));
+			return true;
+		}
+	}
+	else
+	{
+		vD = VsxVectorRegister(vD);
+	}
+
+	il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(vD) }, intrinsic, inputs));
+	return true;
+}
+
+/* doubleword 0 is the most significant half of the register */
+static ExprId VsxDoubleword(LowLevelILFunction &il, uint32_t reg, int dw)
+{
+	ExprId ei0 = il.Register(16, VsxVectorRegister(reg));
+
+	if (dw == 0)
+		ei0 = il.LogicalShiftRight(16, ei0, il.Const(4, 64));
+
+	return il.LowPart(8, ei0);
+}
+
+static ExprId VsxCombine(LowLevelILFunction &il, ExprId dw0, ExprId dw1)
+{
+	return il.Or(16,
+		il.ShiftLeft(16, il.ZeroExtend(16, dw0), il.Const(4, 64)),
+		il.ZeroExtend(16, dw1));
+}
+
+/* lxvd2x/lxvw4x load their elements in element order whatever the byte
+ * order, so they are lifted element by element */
+static bool LiftLxvd2x(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t xT = VsxVectorRegister(oper[0]->reg);
+	ExprId ei0;
+
+	switch (insn->id)
+	{
+		case PPC_INS_LXSDX:
+			if (oper[0]->reg >= PPC_REG_VS32 && oper[0]->reg <= PPC_REG_VS63)
+				ei0 = il.SetRegister(16, xT, VsxCombine(il, il.Load(8, VectorEffectiveAddress(il, oper)), il.Const(8, 0)));
+			else
+				ei0 = il.SetRegister(8, PPC_REG_F0 + (xT - PPC_REG_VS0), il.Load(8, VectorEffectiveAddress(il, oper)));
+			break;
+		case PPC_INS_LXVDSX:
+			il.AddInstruction(il.SetRegister(8, LLIL_TEMP(0), il.Load(8, VectorEffectiveAddress(il, oper))));
+			ei0 = il.SetRegister(16, xT, VsxCombine(il, il.Register(8, LLIL_TEMP(0)), il.Register(8, LLIL_TEMP(0))));
+			break;
+		case PPC_INS_LXVW4X:
+			ei0 = il.Load(4, VectorEffectiveAddress(il, oper));
+			for (int i = 1; i < 4; i++)
+				ei0 = il.Or(16,
+					il.ShiftLeft(16, il.ZeroExtend(16, ei0), il.Const(4, 32)),
+					il.ZeroExtend(16, il.Load(4, il.Add(4, VectorEffectiveAddress(il, oper), il.Const(4, 4 * i)))));
+			ei0 = il.SetRegister(16, xT, ei0);
+			break;
+		default:
+			ei0 = il.SetRegister(16, xT, VsxCombine(il,
+				il.Load(8, VectorEffectiveAddress(il, oper)),
+				il.Load(8, il.Add(4, VectorEffectiveAddress(il, oper), il.Const(4, 8)))));
+			break;
+	}
+
+	il.AddInstruction(ei0);
+	return true;
+}
+
+static bool LiftStxvd2x(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t xS = VsxVectorRegister(oper[0]->reg);
+
+	switch (insn->id)
+	{
+		case PPC_INS_STXSDX:
+			il.AddInstruction(il.Store(8, VectorEffectiveAddress(il, oper), VsxScalar(il, oper[0]->reg)));
+			break;
+		case PPC_INS_STXVW4X:
+			for (int i = 0; i < 4; i++)
+			{
+				ExprId ei0 = il.Register(16, xS);
+				if (i != 3)
+					ei0 = il.LogicalShiftRight(16, ei0, il.Const(4, 96 - 32 * i));
+				il.AddInstruction(il.Store(4,
+					i ? il.Add(4, VectorEffectiveAddress(il, oper), il.Const(4, 4 * i)) : VectorEffectiveAddress(il, oper),
+					il.LowPart(4, ei0)));
+			}
+			break;
+		default:
+			il.AddInstruction(il.Store(8, VectorEffectiveAddress(il, oper), VsxDoubleword(il, xS, 0)));
+			il.AddInstruction(il.Store(8, il.Add(4, VectorEffectiveAddress(il, oper), il.Const(4, 8)), VsxDoubleword(il, xS, 1)));
+			break;
+	}
+	return true;
+}
+
+/* doubleword permutes: xxpermdi and its xxmrghd/xxmrgld/xxspltd/xxswapd
+ * spellings, plus the xvmov* copies */
+static bool LiftXxpermdi(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t xT = VsxVectorRegister(oper[0]->reg);
+	uint32_t xA = oper[1]->reg;
+	uint32_t xB = oper[2] && oper[2]->type == PPC_OP_REG ? oper[2]->reg : xA;
+	int dm;
+
+	switch (insn->id)
+	{
+		case PPC_INS_XVMOVDP:
+		case PPC_INS_XVMOVSP:
+			il.AddInstruction(il.SetRegister(16, xT, il.Register(16, VsxVectorRegister(xA))));
+			return true;
+		case PPC_INS_XXMRGHD: dm = 0; break;
+		case PPC_INS_XXMRGLD: dm = 3; break;
+		case PPC_INS_XXSWAPD: dm = 2; break;
+		case PPC_INS_XXSPLTD:
+			if (!oper[2] || oper[2]->type != PPC_OP_IMM)
+				return false;
+			dm = oper[2]->imm ? 3 : 0;
+			break;
+		default:
+			if (!oper[3] || oper[3]->type != PPC_OP_IMM)
+				return false;
+			dm = oper[3]->imm & 3;
+			break;
+	}
+
+	if (insn->id == PPC_INS_XXSWAPD)
+	{
+		il.AddInstruction(il.SetRegister(16, xT, il.RotateLeft(16, il.Register(16, VsxVectorRegister(xA)), il.Const(4, 64))));
+		return true;
+	}
+
+	il.AddInstruction(il.SetRegister(16, xT,
+		VsxCombine(il, VsxDoubleword(il, xA, (dm >> 1) & 1), VsxDoubleword(il, xB, dm & 1))));
+	return true;
+}
+
+static bool LiftXscmpudp(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftFloatCompare(il, oper[0]->reg, oper[1]->reg, oper[2]->reg, false);
+	return true;
+}
+
+/* data stream touch hints */
+static bool LiftDss(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	il.AddInstruction(il.Nop());
+	return true;
+}
+
+/* SPE: the upper halves of the 64 bit GPRs are separate registers, rNh, so
+ * the 32 bit instructions keep operating on rN alone */
+static uint32_t SpeUpper(uint32_t reg)
+{
+	return PPC_REG_R0_UPPER + (reg - PPC_REG_R0);
+}
+
+static ExprId SpeWord(LowLevelILFunction &il, cs_ppc_op *op, bool upper)
+{
+	if (op->type == PPC_OP_IMM)
+		return il.Const(4, op->imm);
+
+	return il.Register(4, upper ? SpeUpper(op->reg) : op->reg);
+}
+
+/* the upper half goes through a temporary so both halves see the sources as
+ * they were before the instruction */
+static void SetSpePair(LowLevelILFunction &il, uint32_t rD, ExprId upper, ExprId lower)
+{
+	il.AddInstruction(il.SetRegister(4, LLIL_TEMP(0), upper));
+	il.AddInstruction(il.SetRegister(4, rD, lower));
+	il.AddInstruction(il.SetRegister(4, SpeUpper(rD), il.Register(4, LLIL_TEMP(0))));
+}
+
+static ExprId SpeDoubleword(LowLevelILFunction &il, uint32_t reg)
+{
+	return il.Or(8,
+		il.ShiftLeft(8, il.ZeroExtend(8, il.Register(4, SpeUpper(reg))), il.Const(4, 32)),
+		il.ZeroExtend(8, il.Register(4, reg)));
+}
+
+static ExprId SpeAddress(LowLevelILFunction &il, cs_ppc_op **oper, int offset)
+{
+	if (!offset)
+		return FloatEffectiveAddress(il, oper);
+
+	return il.Add(4, FloatEffectiveAddress(il, oper), il.Const(4, offset));
+}
+
+static ExprId SpeHalfword(LowLevelILFunction &il, cs_ppc_op **oper, int offset, bool sign)
+{
+	ExprId ei0 = il.Load(2, SpeAddress(il, oper, offset));
+
+	return sign ? il.SignExtend(4, ei0) : il.ZeroExtend(4, ei0);
+}
+
+static bool LiftEvldd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t rD = oper[0]->reg;
+	ExprId upper, lower;
+
+	switch (insn->id)
+	{
+		case PPC_INS_EVLDD:
+		case PPC_INS_EVLDDX:
+			il.AddInstruction(il.SetRegister(8, LLIL_TEMP(1), il.Load(8, SpeAddress(il, oper, 0))));
+			upper = il.LowPart(4, il.LogicalShiftRight(8, il.Register(8, LLIL_TEMP(1)), il.Const(4, 32)));
+			lower = il.LowPart(4, il.Register(8, LLIL_TEMP(1)));
+			break;
+		case PPC_INS_EVLDW:
+		case PPC_INS_EVLDWX:
+			upper = il.Load(4, SpeAddress(il, oper, 0));
+			lower = il.Load(4, SpeAddress(il, oper, 4));
+			break;
+		case PPC_INS_EVLDH:
+		case PPC_INS_EVLDHX:
+			upper = il.Or(4, il.ShiftLeft(4, SpeHalfword(il, oper, 0, false), il.Const(4, 16)), SpeHalfword(il, oper, 2, false));
+			lower = il.Or(4, il.ShiftLeft(4, SpeHalfword(il, oper, 4, false), il.Const(4, 16)), SpeHalfword(il, oper, 6, false));
+			break;
+		case PPC_INS_EVLHHESPLAT:
+		case PPC_INS_EVLHHESPLATX:
+			il.AddInstruction(il.SetRegister(4, LLIL_TEMP(1), il.ShiftLeft(4, SpeHalfword(il, oper, 0, false), il.Const(4, 16))));
+			upper = il.Register(4, LLIL_TEMP(1));
+			lower = il.Register(4, LLIL_TEMP(1));
+			break;
+		case PPC_INS_EVLHHOSSPLAT:
+		case PPC_INS_EVLHHOSSPLATX:
+		case PPC_INS_EVLHHOUSPLAT:
+		case PPC_INS_EVLHHOUSPLATX:
+			il.AddInstruction(il.SetRegister(4, LLIL_TEMP(1), SpeHalfword(il, oper, 0,
+				insn->id == PPC_INS_EVLHHOSSPLAT || insn->id == PPC_INS_EVLHHOSSPLATX)));
+			upper = il.Register(4, LLIL_TEMP(1));
+			lower = il.Register(4, LLIL_TEMP(1));
+			break;
+		case PPC_INS_EVLWHE:
+		case PPC_INS_EVLWHEX:
+			upper = il.ShiftLeft(4, SpeHalfword(il, oper, 0, false), il.Const(4, 16));
+			lower = il.ShiftLeft(4, SpeHalfword(il, oper, 2, false), il.Const(4, 16));
+			break;
+		case PPC_INS_EVLWHOS:
+		case PPC_INS_EVLWHOSX:
+			upper = SpeHalfword(il, oper, 0, true);
+			lower = SpeHalfword(il, oper, 2, true);
+			break;
+		case PPC_INS_EVLWHOU:
+		case PPC_INS_EVLWHOUX:
+			upper = SpeHalfword(il, oper, 0, false);
+			lower = SpeHalfword(il, oper, 2, false);
+			break;
+		case PPC_INS_EVLWHSPLAT:
+		case PPC_INS_EVLWHSPLATX:
+			upper = il.Or(4, il.ShiftLeft(4, SpeHalfword(il, oper, 0, false), il.Const(4, 16)), SpeHalfword(il, oper, 0, false));
+			lower = il.Or(4, il.ShiftLeft(4, SpeHalfword(il, oper, 2, false), il.Const(4, 16)), SpeHalfword(il, oper, 2, false));
+			break;
+		default: /* evlwwsplat */
+			il.AddInstruction(il.SetRegister(4, LLIL_TEMP(1), il.Load(4, SpeAddress(il, oper, 0))));
+			upper = il.Register(4, LLIL_TEMP(1));
+			lower = il.Register(4, LLIL_TEMP(1));
+			break;
+	}
+
+	SetSpePair(il, rD, upper, lower);
+	return true;
+}
+
+static bool LiftEvstdd(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	uint32_t rS = oper[0]->reg;
+
+	switch (insn->id)
+	{
+		case PPC_INS_EVSTDD:
+		case PPC_INS_EVSTDDX:
+			il.AddInstruction(il.Store(8, SpeAddress(il, oper, 0), SpeDoubleword(il, rS)));
+			break;
+		case PPC_INS_EVSTDW:
+		case PPC_INS_EVSTDWX:
+			il.AddInstruction(il.Store(4, SpeAddress(il, oper, 0), il.Register(4, SpeUpper(rS))));
+			il.AddInstruction(il.Store(4, SpeAddress(il, oper, 4), il.Register(4, rS)));
+			break;
+		case PPC_INS_EVSTDH:
+		case PPC_INS_EVSTDHX:
+			for (int i = 0; i < 4; i++)
+			{
+				ExprId ei0 = il.Register(4, i < 2 ? SpeUpper(rS) : rS);
+				if (!(i & 1))
+					ei0 = il.LogicalShiftRight(4, ei0, il.Const(4, 16));
+				il.AddInstruction(il.Store(2, SpeAddress(il, oper, 2 * i), il.LowPart(2, ei0)));
+			}
+			break;
+		case PPC_INS_EVSTWHE:
+		case PPC_INS_EVSTWHEX:
+			il.AddInstruction(il.Store(2, SpeAddress(il, oper, 0),
+				il.LowPart(2, il.LogicalShiftRight(4, il.Register(4, SpeUpper(rS)), il.Const(4, 16)))));
+			il.AddInstruction(il.Store(2, SpeAddress(il, oper, 2),
+				il.LowPart(2, il.LogicalShiftRight(4, il.Register(4, rS), il.Const(4, 16)))));
+			break;
+		case PPC_INS_EVSTWHO:
+		case PPC_INS_EVSTWHOX:
+			il.AddInstruction(il.Store(2, SpeAddress(il, oper, 0), il.LowPart(2, il.Register(4, SpeUpper(rS)))));
+			il.AddInstruction(il.Store(2, SpeAddress(il, oper, 2), il.LowPart(2, il.Register(4, rS))));
+			break;
+		case PPC_INS_EVSTWWE:
+		case PPC_INS_EVSTWWEX:
+			il.AddInstruction(il.Store(4, SpeAddress(il, oper, 0), il.Register(4, SpeUpper(rS))));
+			break;
+		default: /* evstwwo */
+			il.AddInstruction(il.Store(4, SpeAddress(il, oper, 0), il.Register(4, rS)));
+			break;
+	}
+
+	return true;
+}
+
+/* one half of the element-wise SPE operations that have plain LLIL */
+static ExprId SpeElement(LowLevelILFunction &il, uint32_t id, cs_ppc_op **oper, bool upper)
+{
+	ExprId a = SpeWord(il, oper[1], upper);
+	ExprId b = oper[2] ? SpeWord(il, oper[2], upper) : 0;
+
+	switch (id)
+	{
+		case PPC_INS_EVAND:    return il.And(4, a, b);
+		case PPC_INS_EVANDC:   return il.And(4, a, il.Not(4, b));
+		case PPC_INS_EVEQV:    return il.Not(4, il.Xor(4, a, b));
+		case PPC_INS_EVNAND:   return il.Not(4, il.And(4, a, b));
+		case PPC_INS_EVNOR:    return il.Not(4, il.Or(4, a, b));
+		case PPC_INS_EVOR:     return (oper[1]->reg == oper[2]->reg) ? a : il.Or(4, a, b); /* evmr */
+		case PPC_INS_EVORC:    return il.Or(4, a, il.Not(4, b));
+		case PPC_INS_EVXOR:    return il.Xor(4, a, b);
+		case PPC_INS_EVADDW:
+		case PPC_INS_EVADDIW:  return il.Add(4, a, b);
+		case PPC_INS_EVSUBFW:
+		case PPC_INS_EVSUBIFW: return il.Sub(4, b, a);
+		case PPC_INS_EVNEG:    return il.Neg(4, a);
+		case PPC_INS_EVEXTSB:  return il.SignExtend(4, il.LowPart(1, a));
+		case PPC_INS_EVEXTSH:  return il.SignExtend(4, il.LowPart(2, a));
+		case PPC_INS_EVSLWI:   return il.ShiftLeft(4, a, b);
+		case PPC_INS_EVSRWIU:  return il.LogicalShiftRight(4, a, b);
+		case PPC_INS_EVSRWIS:  return il.ArithShiftRight(4, a, b);
+		case PPC_INS_EVRLWI:   return il.RotateLeft(4, a, b);
+		case PPC_INS_EVSPLATI:
+		case PPC_INS_EVMRA:    return a;
+		case PPC_INS_EVSPLATFI: return il.Const(4, (uint32_t)oper[1]->imm << 27);
+		case PPC_INS_EVMERGEHI: return upper ? a : SpeWord(il, oper[2], true);
+		case PPC_INS_EVMERGELO: return upper ? SpeWord(il, oper[1], false) : b;
+		case PPC_INS_EVMERGEHILO: return upper ? a : SpeWord(il, oper[2], false);
+		default: /* evmergelohi */
+			return upper ? SpeWord(il, oper[1], false) : SpeWord(il, oper[2], true);
+	}
+}
+
+static bool LiftEvand(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	if (insn->id == PPC_INS_EVMRA)
+		il.AddInstruction(il.SetRegister(8, PPC_REG_ACC, SpeDoubleword(il, oper[1]->reg)));
+
+	SetSpePair(il, oper[0]->reg,
+		SpeElement(il, insn->id, oper, true),
+		SpeElement(il, insn->id, oper, false));
+	return true;
+}
+
+/* evcmp* crD, rA, rB: crD = upper result, lower result, either, both */
+static void LiftSpeCompare(LowLevelILFunction &il, uint32_t id, uint32_t crf, uint32_t rA, uint32_t rB, bool crRegisters)
+{
+	ExprId cmp[2];
+
+	for (int i = 0; i < 2; i++)
+	{
+		ExprId a = il.Register(4, i ? rA : SpeUpper(rA));
+		ExprId b = il.Register(4, i ? rB : SpeUpper(rB));
+
+		switch (id)
+		{
+			case PPC_INS_EVCMPEQ:  cmp[i] = il.CompareEqual(4, a, b); break;
+			case PPC_INS_EVCMPGTS: cmp[i] = il.CompareSignedGreaterThan(4, a, b); break;
+			case PPC_INS_EVCMPGTU: cmp[i] = il.CompareUnsignedGreaterThan(4, a, b); break;
+			case PPC_INS_EVCMPLTS: cmp[i] = il.CompareSignedLessThan(4, a, b); break;
+			default:               cmp[i] = il.CompareUnsignedLessThan(4, a, b); break;
+		}
+
+		il.AddInstruction(il.SetRegister(1, LLIL_TEMP(i), il.BoolToInt(1, cmp[i])));
+	}
+
+	ExprId bits[4];
+	bits[0] = il.Register(1, LLIL_TEMP(0));
+	bits[1] = il.Register(1, LLIL_TEMP(1));
+	bits[2] = il.Or(1, il.Register(1, LLIL_TEMP(0)), il.Register(1, LLIL_TEMP(1)));
+	bits[3] = il.And(1, il.Register(1, LLIL_TEMP(0)), il.Register(1, LLIL_TEMP(1)));
+
+	if (crRegisters)
+	{
+		ExprId ei0 = il.ZeroExtend(4, bits[0]);
+		for (int i = 1; i < 4; i++)
+			ei0 = il.Or(4, il.ShiftLeft(4, ei0, il.Const(4, 1)), il.ZeroExtend(4, bits[i]));
+		il.AddInstruction(il.SetRegister(4, crf, ei0));
+		return;
+	}
+
+	uint32_t flagBase = (crf - PPC_REG_CR0) * 4;
+
+	for (int i = 0; i < 4; i++)
+		il.AddInstruction(il.SetFlag(flagBase + IL_FLAG_LT + i, il.CompareNotEqual(1, bits[i], il.Const(1, 0))));
+}
+
+static bool LiftEvcmp(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftSpeCompare(il, insn->id, oper[0]->reg, oper[1]->reg, oper[2]->reg, false);
+	return true;
+}
+
+static uint32_t GetSpeIntrinsic(uint32_t id, const char** inputs, char* output)
+{
+	switch (id)
+	{
+		#define SPE_CASE(id, name, inputs_, output_) \
+		case PPC_INS_##id: *inputs = inputs_; *output = output_; return PPC_INTRIN_##id;
+		SPE_INTRINSICS(SPE_CASE)
+		#undef SPE_CASE
+		default: return 0;
+	}
+}
+
+static bool LiftSpeIntrinsic(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	const char* kinds = "";
+	char output = 0;
+	uint32_t intrinsic = GetSpeIntrinsic(insn->id, &kinds, &output);
+	std::vector<ExprId> inputs;
+	std::vector<RegisterOrFlag> outputs;
+
+	for (int i = 1; *kinds; kinds++)
+	{
+		if (*kinds == 'a')
+		{
+			inputs.push_back(il.Register(8, PPC_REG_ACC));
+			continue;
+		}
+
+		if (i >= 5 || !oper[i] || oper[i]->type != PPC_OP_REG)
+			return false;
+		inputs.push_back(il.Register(4, SpeUpper(oper[i]->reg)));
+		inputs.push_back(il.Register(4, oper[i]->reg));
+		i++;
+	}
+
+	outputs.push_back(RegisterOrFlag::Register(SpeUpper(oper[0]->reg)));
+	outputs.push_back(RegisterOrFlag::Register(oper[0]->reg));
+	if (output == 'E')
+		outputs.push_back(RegisterOrFlag::Register(PPC_REG_ACC));
+
+	il.AddInstruction(il.Intrinsic(outputs, intrinsic, inputs));
+	return true;
+}
+
+/* cr register model replacements for everything that reads or writes cr bits
+ * as flags; the record forms ("add.") are handled by the dispatcher */
+static bool LiftCrfCompare(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	bool signedComparison = true;
+	int options = 0;
+
+	switch (insn->id)
+	{
+		case PPC_INS_CMPL:
+		case PPC_INS_CMPLW:
+			signedComparison = false;
+			break;
+		case PPC_INS_CMPI:
+		case PPC_INS_CMPWI:
+			options = OTI_SEXT32_IMMS;
+			break;
+		case PPC_INS_CMPLI:
+		case PPC_INS_CMPLWI:
+			signedComparison = false;
+			options = OTI_ZEXT32_IMMS;
+			break;
+	}
+
+	cs_ppc_op *left = oper[2] ? oper[1] : oper[0];
+	cs_ppc_op *right = oper[2] ? oper[2] : oper[1];
+	uint32_t crx = oper[2] ? oper[0]->reg : PPC_REG_CR0;
+
+	il.AddInstruction(SetCrField(il, crx,
+		[&]() { return operToIL(il, left); },
+		[&]() { return operToIL(il, right, options); },
+		signedComparison));
+	return true;
+}
+
+static bool LiftCrfLogical(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+	uint32_t crbD = oper[0]->reg - PPC_REG_R0;
+
+	switch (insn->id)
+	{
+		case PPC_INS_CRSET:
+			ei0 = il.Const(4, 1);
+			break;
+		case PPC_INS_CRCLR:
+			ei0 = il.Const(4, 0);
+			break;
+		case PPC_INS_CRMOVE:
+			ei0 = ReadCrBit(il, oper[1]->reg - PPC_REG_R0);
+			break;
+		case PPC_INS_CRNOT:
+			ei0 = il.Xor(4, ReadCrBit(il, oper[1]->reg - PPC_REG_R0), il.Const(4, 1));
+			break;
+		default:
+		{
+			ExprId crbA = ReadCrBit(il, oper[1]->reg - PPC_REG_R0);
+			ExprId crbB = ReadCrBit(il, oper[2]->reg - PPC_REG_R0);
+
+			if (insn->id == PPC_INS_CRANDC || insn->id == PPC_INS_CRORC)
+				crbB = il.Xor(4, crbB, il.Const(4, 1));
+
+			switch (insn->id)
+			{
+				case PPC_INS_CRAND:
+				case PPC_INS_CRANDC:
+				case PPC_INS_CRNAND:
+					ei0 = il.And(4, crbA, crbB);
+					break;
+				case PPC_INS_CROR:
+				case PPC_INS_CRORC:
+				case PPC_INS_CRNOR:
+					ei0 = il.Or(4, crbA, crbB);
+					break;
+				default:
+					ei0 = il.Xor(4, crbA, crbB);
+					break;
+			}
+
+			if (insn->id == PPC_INS_CRNAND || insn->id == PPC_INS_CRNOR || insn->id == PPC_INS_CREQV)
+				ei0 = il.Xor(4, ei0, il.Const(4, 1));
+		}
+	}
+
+	il.AddInstruction(WriteCrBit(il, crbD, ei0));
+	return true;
+}
+
+static bool LiftCrfMfcr(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0 = il.Register(4, PPC_REG_CR7);
+
+	for (uint32_t i = 1; i < 8; i++)
+		ei0 = il.Or(4, il.ShiftLeft(4, il.Register(4, PPC_REG_CR7 - i), il.Const(4, 4 * i)), ei0);
+
+	il.AddInstruction(il.SetRegister(4, oper[0]->reg, ei0));
+	return true;
+}
+
+static bool LiftCrfMtcrf(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	ExprId ei0;
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		if (oper[0]->imm & (0x80 >> i))
+		{
+			ei0 = il.Register(4, oper[1]->reg);
+			if (i != 7)
+				ei0 = il.LogicalShiftRight(4, ei0, il.Const(4, 28 - 4 * i));
+			ei0 = il.And(4, ei0, il.Const(4, 0xf));
+			il.AddInstruction(il.SetRegister(4, PPC_REG_CR0 + i, ei0));
+		}
+	}
+	return true;
+}
+
+static bool LiftCrfIsel(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftSelect(il, oper, TestCrBit(il, oper[3]->reg - PPC_REG_R0));
+	return true;
+}
+
+static bool LiftCrfFcmpu(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftFloatCompare(il, oper[0]->reg, oper[1]->reg, oper[2]->reg, true);
+	return true;
+}
+
+static bool LiftCrfEvcmp(LowLevelILFunction &il, struct cs_insn *insn, struct cs_ppc *ppc, cs_ppc_op **oper)
+{
+	LiftSpeCompare(il, insn->id, oper[0]->reg, oper[1]->reg, oper[2]->reg, true);
+	return true;
+}
+
+/* every instruction id listed here shares its handler with the others of its
+ * group; anything not listed lifts as Unimplemented() without a handler call */
+static const struct
+{
+	uint32_t id;
+	LiftHandler handler;
+	uint8_t minOps;
+} liftHandlers[] = {
+	{ PPC_INS_ADD,    LiftAdd,    2 }, /* add */
+	{ PPC_INS_ADDE,   LiftAdde,   3 }, /* add, extended (+ carry flag) */
+	{ PPC_INS_ADDME,  LiftAddme,  2 }, /* add, extended (+ carry flag) minus one */
+	{ PPC_INS_ADDZE,  LiftAddme,  2 },
+	{ PPC_INS_ADDC,   LiftAddc,   3 }, /* add, carrying */
+	{ PPC_INS_ADDIC,  LiftAddc,   3 }, /* add immediate, carrying */
+	{ PPC_INS_ADDI,   LiftAddi,   2 }, /* add immediate, eg: addi rD, rA, <imm> */
+	{ PPC_INS_ADDIS,  LiftAddi,   2 }, /* add immediate, shifted */
+	{ PPC_INS_LIS,    LiftLis,    2 }, /* load immediate, shifted */
+	{ PPC_INS_LI,     LiftLi,     2 }, /* load immediate */
+	{ PPC_INS_LA,     LiftLi,     2 }, /* load displacement */
+	{ PPC_INS_AND,    LiftAnd,    3 },
+	{ PPC_INS_ANDC,   LiftAnd,    3 }, // and [with complement]
+	{ PPC_INS_NAND,   LiftAnd,    3 },
+	{ PPC_INS_ANDIS,  LiftAndis,  3 },
+	{ PPC_INS_ANDI,   LiftAndis,  3 },
+	{ PPC_INS_CMP,    LiftCmp,    2 },
+	{ PPC_INS_CMPW,   LiftCmp,    2 }, /* compare (signed) word(32-bit) */
+	{ PPC_INS_CMPL,   LiftCmpl,   2 },
+	{ PPC_INS_CMPLW,  LiftCmpl,   2 }, /* compare logical(unsigned) word(32-bit) */
+	{ PPC_INS_CMPI,   LiftCmpi,   2 },
+	{ PPC_INS_CMPWI,  LiftCmpi,   2 }, /* compare (signed) word(32-bit) immediate */
+	{ PPC_INS_CMPLI,  LiftCmpli,  2 },
+	{ PPC_INS_CMPLWI, LiftCmpli,  2 }, /* compare logical(unsigned) word(32-bit) immediate */
+	{ PPC_INS_CRAND,  LiftCrand,  3 },
+	{ PPC_INS_CRANDC, LiftCrand,  3 },
+	{ PPC_INS_CRNAND, LiftCrand,  3 },
+	{ PPC_INS_CROR,   LiftCror,   3 },
+	{ PPC_INS_CRORC,  LiftCror,   3 },
+	{ PPC_INS_CRNOR,  LiftCror,   3 },
+	{ PPC_INS_CREQV,  LiftCreqv,  3 },
+	{ PPC_INS_CRXOR,  LiftCreqv,  3 },
+	{ PPC_INS_CRSET,  LiftCrset,  1 },
+	{ PPC_INS_CRCLR,  LiftCrclr,  1 },
+	{ PPC_INS_CRNOT,  LiftCrnot,  2 },
+	{ PPC_INS_CRMOVE, LiftCrnot,  2 },
+	{ PPC_INS_MFCR,   LiftMfcr,   1 },
+	{ PPC_INS_MTCRF,  LiftMtcrf,  2 },
+	{ PPC_INS_EXTSB,  LiftExtsb,  2 },
+	{ PPC_INS_EXTSH,  LiftExtsb,  2 },
+	{ PPC_INS_ISEL,   LiftIsel,   4 },
+	{ PPC_INS_LMW,    LiftLmw,    2 },
+	{ PPC_INS_LBZ,    LiftLbz,    2 },
+	{ PPC_INS_LBZU,   LiftLbz,    2 },
+	{ PPC_INS_LBZX,   LiftLbzx,   3 },
+	{ PPC_INS_LBZUX,  LiftLbzx,   3 },
+	{ PPC_INS_LHZ,    LiftLhz,    2 },
+	{ PPC_INS_LHZU,   LiftLhz,    2 },
+	{ PPC_INS_LHA,    LiftLhz,    2 },
+	{ PPC_INS_LHAU,   LiftLhz,    2 },
+	{ PPC_INS_LHZX,   LiftLhzx,   3 },
+	{ PPC_INS_LHZUX,  LiftLhzx,   3 },
+	{ PPC_INS_LHAX,   LiftLhzx,   3 },
+	{ PPC_INS_LHAUX,  LiftLhzx,   3 },
+	{ PPC_INS_LWZ,    LiftLwz,    2 },
+	{ PPC_INS_LWZU,   LiftLwz,    2 },
+	{ PPC_INS_LWZX,   LiftLwzx,   3 },
+	{ PPC_INS_LWZUX,  LiftLwzx,   3 },
+	{ PPC_INS_LHBRX,  LiftLhbrx,  3 },
+	{ PPC_INS_LWBRX,  LiftLwbrx,  3 },
+	{ PPC_INS_STHBRX, LiftSthbrx, 3 },
+	{ PPC_INS_STWBRX, LiftStwbrx, 3 },
+	{ PPC_INS_LDBRX,  LiftLdbrx,  3 },
+	{ PPC_INS_STDBRX, LiftStdbrx, 3 },
+	{ PPC_INS_LD,     LiftLd,     2 },
+	{ PPC_INS_LDU,    LiftLd,     2 },
+	{ PPC_INS_LDX,    LiftLd,     3 },
+	{ PPC_INS_LDUX,   LiftLd,     3 },
+	{ PPC_INS_STD,    LiftStd,    2 },
+	{ PPC_INS_STDU,   LiftStd,    2 },
+	{ PPC_INS_STDX,   LiftStd,    3 },
+	{ PPC_INS_STDUX,  LiftStd,    3 },
+	{ PPC_INS_MFSPR,  LiftMfspr,  2 }, // move from spr, including lr and ctr
+	{ PPC_INS_MTSPR,  LiftMtspr,  2 }, // move to spr
+	{ PPC_INS_MFMSR,  LiftMfmsr,  1 },
+	{ PPC_INS_MTMSR,  LiftMtmsr,  1 },
+	{ PPC_INS_MTMSRD, LiftMtmsr,  1 },
+	{ PPC_INS_NEG,    LiftNeg,    2 },
+	{ PPC_INS_NOP,    LiftNop,    0 },
+	{ PPC_INS_NOT,    LiftNot,    2 },
+	{ PPC_INS_OR,     LiftOr,     3 },
+	{ PPC_INS_ORC,    LiftOr,     3 },
+	{ PPC_INS_NOR,    LiftOr,     3 },
+	{ PPC_INS_ORI,    LiftOri,    3 },
+	{ PPC_INS_ORIS,   LiftOri,    3 },
+	{ PPC_INS_XOR,    LiftXor,    3 },
+	{ PPC_INS_EQV,    LiftXor,    3 },
+	{ PPC_INS_XORI,   LiftXori,   3 },
+	{ PPC_INS_XORIS,  LiftXori,   3 },
+	{ PPC_INS_SUBF,   LiftSubf,   3 },
+	{ PPC_INS_SUBFC,  LiftSubf,   3 },
+	{ PPC_INS_SUBFIC, LiftSubf,   3 },
+	{ PPC_INS_SUBFE,  LiftSubfe,  3 },
+	{ PPC_INS_SUBFME, LiftSubfme, 2 },
+	{ PPC_INS_SUBFZE, LiftSubfme, 2 },
+	{ PPC_INS_STMW,   LiftStmw,   2 },
+	{ PPC_INS_STB,    LiftStb,    2 },
+	{ PPC_INS_STBU,   LiftStb,    2 }, /* store(size, addr, val) */
+	{ PPC_INS_STBX,   LiftStbx,   3 },
+	{ PPC_INS_STBUX,  LiftStbx,   3 }, /* store(size, addr, val) */
+	{ PPC_INS_STH,    LiftSth,    2 },
+	{ PPC_INS_STHU,   LiftSth,    2 }, /* store(size, addr, val) */
+	{ PPC_INS_STHX,   LiftSthx,   3 },
+	{ PPC_INS_STHUX,  LiftSthx,   3 }, /* store(size, addr, val) */
+	{ PPC_INS_STW,    LiftStw,    2 },
+	{ PPC_INS_STWU,   LiftStw,    2 }, /* store(size, addr, val) */
+	{ PPC_INS_STWX,   LiftStwx,   3 },
+	{ PPC_INS_STWUX,  LiftStwx,   3 }, /* store(size, addr, val) */
+	{ PPC_INS_RLWIMI, LiftRlwimi, 5 },
+	{ PPC_INS_RLWINM, LiftRlwinm, 5 },
+	{ PPC_INS_SLWI,   LiftSlwi,   3 },
+	{ PPC_INS_SRWI,   LiftSrwi,   3 },
+	{ PPC_INS_CLRLWI, LiftClrlwi, 3 },
+	{ PPC_INS_ROTLWI, LiftRotlwi, 3 },
+	{ PPC_INS_ROTLW,  LiftRotlw,  3 },
+	{ PPC_INS_RLWNM,  LiftRotlw,  3 },
+	{ PPC_INS_SLW,    LiftSlw,    3 },
+	{ PPC_INS_SRW,    LiftSlw,    3 },
+	{ PPC_INS_SRAW,   LiftSraw,   3 },
+	{ PPC_INS_SRAWI,  LiftSrawi,  3 },
+	{ PPC_INS_MULLW,  LiftMullw,  3 },
+	{ PPC_INS_MULLI,  LiftMulli,  3 },
+	{ PPC_INS_MULHW,  LiftMulhw,  3 },
+	{ PPC_INS_MULHWU, LiftMulhwu, 3 },
+	{ PPC_INS_DIVW,   LiftDivw,   3 },
+	{ PPC_INS_DIVWU,  LiftDivwu,  3 },
+	{ PPC_INS_MR,     LiftMr,     2 }, /* move register */
+	{ PPC_INS_SC,     LiftSc,     0 },
+	{ PPC_INS_RFI,    LiftRfi,    0 },
+	{ PPC_INS_RFID,   LiftRfi,    0 },
+	{ PPC_INS_RFCI,   LiftRfi,    0 },
+	{ PPC_INS_RFDI,   LiftRfi,    0 },
+	{ PPC_INS_RFMCI,  LiftRfi,    0 },
+	{ PPC_INS_TRAP,   LiftTrap,   0 },
+
+	{ PPC_INS_LFS,     LiftLfs,    2 }, /* load floating point [and update] */
+	{ PPC_INS_LFSU,    LiftLfs,    2 },
+	{ PPC_INS_LFSX,    LiftLfs,    3 },
+	{ PPC_INS_LFSUX,   LiftLfs,    3 },
+	{ PPC_INS_LFD,     LiftLfs,    2 },
+	{ PPC_INS_LFDU,    LiftLfs,    2 },
+	{ PPC_INS_LFDX,    LiftLfs,    3 },
+	{ PPC_INS_LFDUX,   LiftLfs,    3 },
+	{ PPC_INS_LFIWAX,  LiftLfs,    3 },
+	{ PPC_INS_LFIWZX,  LiftLfs,    3 },
+	{ PPC_INS_STFS,    LiftStfs,   2 }, /* store floating point [with update] */
+	{ PPC_INS_STFSU,   LiftStfs,   2 },
+	{ PPC_INS_STFSX,   LiftStfs,   3 },
+	{ PPC_INS_STFSUX,  LiftStfs,   3 },
+	{ PPC_INS_STFD,    LiftStfs,   2 },
+	{ PPC_INS_STFDU,   LiftStfs,   2 },
+	{ PPC_INS_STFDX,   LiftStfs,   3 },
+	{ PPC_INS_STFDUX,  LiftStfs,   3 },
+	{ PPC_INS_STFIWX,  LiftStfs,   3 },
+	{ PPC_INS_FMR,     LiftFmr,    2 },
+	{ PPC_INS_FNEG,    LiftFmr,    2 },
+	{ PPC_INS_FABS,    LiftFmr,    2 },
+	{ PPC_INS_FNABS,   LiftFmr,    2 },
+	{ PPC_INS_FRSP,    LiftFmr,    2 },
+	{ PPC_INS_FRIN,    LiftFmr,    2 },
+	{ PPC_INS_FRIZ,    LiftFmr,    2 },
+	{ PPC_INS_FRIP,    LiftFmr,    2 },
+	{ PPC_INS_FRIM,    LiftFmr,    2 },
+	{ PPC_INS_FADD,    LiftFadd,   3 },
+	{ PPC_INS_FADDS,   LiftFadd,   3 },
+	{ PPC_INS_FSUB,    LiftFadd,   3 },
+	{ PPC_INS_FSUBS,   LiftFadd,   3 },
+	{ PPC_INS_FMUL,    LiftFadd,   3 },
+	{ PPC_INS_FMULS,   LiftFadd,   3 },
+	{ PPC_INS_FDIV,    LiftFadd,   3 },
+	{ PPC_INS_FDIVS,   LiftFadd,   3 },
+	{ PPC_INS_FMADD,   LiftFmadd,  4 },
+	{ PPC_INS_FMADDS,  LiftFmadd,  4 },
+	{ PPC_INS_FMSUB,   LiftFmadd,  4 },
+	{ PPC_INS_FMSUBS,  LiftFmadd,  4 },
+	{ PPC_INS_FNMADD,  LiftFmadd,  4 },
+	{ PPC_INS_FNMADDS, LiftFmadd,  4 },
+	{ PPC_INS_FNMSUB,  LiftFmadd,  4 },
+	{ PPC_INS_FNMSUBS, LiftFmadd,  4 },
+	{ PPC_INS_FSQRT,   LiftFsqrt,  2 },
+	{ PPC_INS_FSQRTS,  LiftFsqrt,  2 },
+	{ PPC_INS_FRE,     LiftFsqrt,  2 },
+	{ PPC_INS_FRES,    LiftFsqrt,  2 },
+	{ PPC_INS_FRSQRTE, LiftFsqrt,  2 },
+	{ PPC_INS_FRSQRTES,LiftFsqrt,  2 },
+	{ PPC_INS_FCTIW,   LiftFctiw,  2 },
+	{ PPC_INS_FCTIWZ,  LiftFctiw,  2 },
+	{ PPC_INS_FCTIWUZ, LiftFctiw,  2 },
+	{ PPC_INS_FCTID,   LiftFctiw,  2 },
+	{ PPC_INS_FCTIDZ,  LiftFctiw,  2 },
+	{ PPC_INS_FCTIDUZ, LiftFctiw,  2 },
+	{ PPC_INS_FCFID,   LiftFcfid,  2 },
+	{ PPC_INS_FCFIDS,  LiftFcfid,  2 },
+	{ PPC_INS_FCFIDU,  LiftFcfid,  2 },
+	{ PPC_INS_FCFIDUS, LiftFcfid,  2 },
+	{ PPC_INS_FSEL,    LiftFsel,   4 },
+	{ PPC_INS_FCPSGN,  LiftFcpsgn, 3 },
+	{ PPC_INS_FCMPU,   LiftFcmpu,  3 },
+	{ PPC_INS_MFFS,    LiftMffs,   1 },
+	{ PPC_INS_MTFSF,   LiftMtfsf,  2 },
+	{ PPC_INS_MTFSB0,  LiftMtfsb0, 1 },
+	{ PPC_INS_MTFSB1,  LiftMtfsb0, 1 },
+
+	{ PPC_INS_LVX,     LiftLvx,    3 }, /* altivec */
+	{ PPC_INS_LVXL,    LiftLvx,    3 },
+	{ PPC_INS_STVX,    LiftLvx,    3 },
+	{ PPC_INS_STVXL,   LiftLvx,    3 },
+	{ PPC_INS_VAND,    LiftVand,   3 },
+	{ PPC_INS_VANDC,   LiftVand,   3 },
+	{ PPC_INS_VOR,     LiftVand,   3 },
+	{ PPC_INS_VXOR,    LiftVand,   3 },
+	{ PPC_INS_VNOR,    LiftVand,   3 },
+	{ PPC_INS_DSS,     LiftDss,    0 },
+	{ PPC_INS_DSSALL,  LiftDss,    0 },
+	{ PPC_INS_DST,     LiftDss,    0 },
+	{ PPC_INS_DSTT,    LiftDss,    0 },
+	{ PPC_INS_DSTST,   LiftDss,    0 },
+	{ PPC_INS_DSTSTT,  LiftDss,    0 },
+	{ PPC_INS_LXSDX,   LiftLxvd2x,   3 }, /* vsx */
+	{ PPC_INS_LXVD2X,  LiftLxvd2x,   3 },
+	{ PPC_INS_LXVDSX,  LiftLxvd2x,   3 },
+	{ PPC_INS_LXVW4X,  LiftLxvd2x,   3 },
+	{ PPC_INS_STXSDX,  LiftStxvd2x,  3 },
+	{ PPC_INS_STXVD2X, LiftStxvd2x,  3 },
+	{ PPC_INS_STXVW4X, LiftStxvd2x,  3 },
+	{ PPC_INS_XXLAND,  LiftVand,     3 },
+	{ PPC_INS_XXLANDC, LiftVand,     3 },
+	{ PPC_INS_XXLNOR,  LiftVand,     3 },
+	{ PPC_INS_XXLOR,   LiftVand,     3 },
+	{ PPC_INS_XXLXOR,  LiftVand,     3 },
+	{ PPC_INS_XXPERMDI,LiftXxpermdi, 2 },
+	{ PPC_INS_XXMRGHD, LiftXxpermdi, 3 },
+	{ PPC_INS_XXMRGLD, LiftXxpermdi, 3 },
+	{ PPC_INS_XXSPLTD, LiftXxpermdi, 2 },
+	{ PPC_INS_XXSWAPD, LiftXxpermdi, 2 },
+	{ PPC_INS_XVMOVDP, LiftXxpermdi, 2 },
+	{ PPC_INS_XVMOVSP, LiftXxpermdi, 2 },
+	{ PPC_INS_XSCMPUDP,LiftXscmpudp, 3 },
+	{ PPC_INS_XSCMPODP,LiftXscmpudp, 3 },
+	#define VECTOR_HANDLER(id, name, inputs, output) { PPC_INS_##id, LiftVectorIntrinsic, 1 },
+	VECTOR_INTRINSICS(VECTOR_HANDLER)
+	#undef VECTOR_HANDLER
+	{ PPC_INS_EVLDD,         LiftEvldd,  2 }, /* spe */
+	{ PPC_INS_EVLDDX,        LiftEvldd,  2 },
+	{ PPC_INS_EVLDW,         LiftEvldd,  2 },
+	{ PPC_INS_EVLDWX,        LiftEvldd,  2 },
+	{ PPC_INS_EVLDH,         LiftEvldd,  2 },
+	{ PPC_INS_EVLDHX,        LiftEvldd,  2 },
+	{ PPC_INS_EVLHHESPLAT,   LiftEvldd,  2 },
+	{ PPC_INS_EVLHHESPLATX,  LiftEvldd,  2 },
+	{ PPC_INS_EVLHHOSSPLAT,  LiftEvldd,  2 },
+	{ PPC_INS_EVLHHOSSPLATX, LiftEvldd,  2 },
+	{ PPC_INS_EVLHHOUSPLAT,  LiftEvldd,  2 },
+	{ PPC_INS_EVLHHOUSPLATX, LiftEvldd,  2 },
+	{ PPC_INS_EVLWHE,        LiftEvldd,  2 },
+	{ PPC_INS_EVLWHEX,       LiftEvldd,  2 },
+	{ PPC_INS_EVLWHOS,       LiftEvldd,  2 },
+	{ PPC_INS_EVLWHOSX,      LiftEvldd,  2 },
+	{ PPC_INS_EVLWHOU,       LiftEvldd,  2 },
+	{ PPC_INS_EVLWHOUX,      LiftEvldd,  2 },
+	{ PPC_INS_EVLWHSPLAT,    LiftEvldd,  2 },
+	{ PPC_INS_EVLWHSPLATX,   LiftEvldd,  2 },
+	{ PPC_INS_EVLWWSPLAT,    LiftEvldd,  2 },
+	{ PPC_INS_EVLWWSPLATX,   LiftEvldd,  2 },
+	{ PPC_INS_EVSTDD,        LiftEvstdd, 2 },
+	{ PPC_INS_EVSTDDX,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTDH,        LiftEvstdd, 2 },
+	{ PPC_INS_EVSTDHX,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTDW,        LiftEvstdd, 2 },
+	{ PPC_INS_EVSTDWX,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWHE,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWHEX,      LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWHO,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWHOX,      LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWWE,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWWEX,      LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWWO,       LiftEvstdd, 2 },
+	{ PPC_INS_EVSTWWOX,      LiftEvstdd, 2 },
+	{ PPC_INS_EVAND,         LiftEvand,  3 },
+	{ PPC_INS_EVANDC,        LiftEvand,  3 },
+	{ PPC_INS_EVEQV,         LiftEvand,  3 },
+	{ PPC_INS_EVNAND,        LiftEvand,  3 },
+	{ PPC_INS_EVNOR,         LiftEvand,  3 },
+	{ PPC_INS_EVOR,          LiftEvand,  3 },
+	{ PPC_INS_EVORC,         LiftEvand,  3 },
+	{ PPC_INS_EVXOR,         LiftEvand,  3 },
+	{ PPC_INS_EVADDW,        LiftEvand,  3 },
+	{ PPC_INS_EVADDIW,       LiftEvand,  3 },
+	{ PPC_INS_EVSUBFW,       LiftEvand,  3 },
+	{ PPC_INS_EVSUBIFW,      LiftEvand,  3 },
+	{ PPC_INS_EVNEG,         LiftEvand,  2 },
+	{ PPC_INS_EVEXTSB,       LiftEvand,  2 },
+	{ PPC_INS_EVEXTSH,       LiftEvand,  2 },
+	{ PPC_INS_EVSLWI,        LiftEvand,  3 },
+	{ PPC_INS_EVSRWIU,       LiftEvand,  3 },
+	{ PPC_INS_EVSRWIS,       LiftEvand,  3 },
+	{ PPC_INS_EVRLWI,        LiftEvand,  3 },
+	{ PPC_INS_EVSPLATI,      LiftEvand,  2 },
+	{ PPC_INS_EVSPLATFI,     LiftEvand,  2 },
+	{ PPC_INS_EVMERGEHI,     LiftEvand,  3 },
+	{ PPC_INS_EVMERGEHILO,   LiftEvand,  3 },
+	{ PPC_INS_EVMERGELO,     LiftEvand,  3 },
+	{ PPC_INS_EVMERGELOHI,   LiftEvand,  3 },
+	{ PPC_INS_EVMRA,         LiftEvand,  2 },
+	{ PPC_INS_EVCMPEQ,       LiftEvcmp,  3 },
+	{ PPC_INS_EVCMPGTS,      LiftEvcmp,  3 },
+	{ PPC_INS_EVCMPGTU,      LiftEvcmp,  3 },
+	{ PPC_INS_EVCMPLTS,      LiftEvcmp,  3 },
+	{ PPC_INS_EVCMPLTU,      LiftEvcmp,  3 },
+	#define SPE_HANDLER(id, name, inputs, output) { PPC_INS_##id, LiftSpeIntrinsic, 1 },
+	SPE_INTRINSICS(SPE_HANDLER)
+	#undef SPE_HANDLER
+};
+
+/* overrides of the above when cr0-cr7 are modelled as registers */
+static const struct
+{
+	uint32_t id;
+	LiftHandler handler;
+	uint8_t minOps;
+} crRegisterHandlers[] = {
+	{ PPC_INS_CMP,    LiftCrfCompare, 2 },
+	{ PPC_INS_CMPW,   LiftCrfCompare, 2 },
+	{ PPC_INS_CMPL,   LiftCrfCompare, 2 },
+	{ PPC_INS_CMPLW,  LiftCrfCompare, 2 },
+	{ PPC_INS_CMPI,   LiftCrfCompare, 2 },
+	{ PPC_INS_CMPWI,  LiftCrfCompare, 2 },
+	{ PPC_INS_CMPLI,  LiftCrfCompare, 2 },
+	{ PPC_INS_CMPLWI, LiftCrfCompare, 2 },
+	{ PPC_INS_CRAND,  LiftCrfLogical, 3 },
+	{ PPC_INS_CRANDC, LiftCrfLogical, 3 },
+	{ PPC_INS_CRNAND, LiftCrfLogical, 3 },
+	{ PPC_INS_CROR,   LiftCrfLogical, 3 },
+	{ PPC_INS_CRORC,  LiftCrfLogical, 3 },
+	{ PPC_INS_CRNOR,  LiftCrfLogical, 3 },
+	{ PPC_INS_CREQV,  LiftCrfLogical, 3 },
+	{ PPC_INS_CRXOR,  LiftCrfLogical, 3 },
+	{ PPC_INS_CRSET,  LiftCrfLogical, 1 },
+	{ PPC_INS_CRCLR,  LiftCrfLogical, 1 },
+	{ PPC_INS_CRNOT,  LiftCrfLogical, 2 },
+	{ PPC_INS_CRMOVE, LiftCrfLogical, 2 },
+	{ PPC_INS_MFCR,   LiftCrfMfcr,    1 },
+	{ PPC_INS_MTCRF,  LiftCrfMtcrf,   2 },
+	{ PPC_INS_ISEL,   LiftCrfIsel,    4 },
+	{ PPC_INS_FCMPU,  LiftCrfFcmpu,   3 },
+	{ PPC_INS_XSCMPUDP,LiftCrfFcmpu,  3 },
+	{ PPC_INS_XSCMPODP,LiftCrfFcmpu,  3 },
+	{ PPC_INS_EVCMPEQ, LiftCrfEvcmp,  3 },
+	{ PPC_INS_EVCMPGTS,LiftCrfEvcmp,  3 },
+	{ PPC_INS_EVCMPGTU,LiftCrfEvcmp,  3 },
+	{ PPC_INS_EVCMPLTS,LiftCrfEvcmp,  3 },
+	{ PPC_INS_EVCMPLTU,LiftCrfEvcmp,  3 },
+};
+
+static const LiftEntry* GetLiftTable(bool crRegisters)
+{
+	static LiftEntry tables[2][PPC_INS_ENDING];
+	static bool initialized = []() {
+		for (auto& entry : liftHandlers)
+		{
+			tables[0][entry.id] = { entry.handler, entry.minOps };
+			tables[1][entry.id] = { entry.handler, entry.minOps };
+		}
+		for (auto& entry : crRegisterHandlers)
+			tables[1][entry.id] = { entry.handler, entry.minOps };
+		return true;
+	}();
+
+	(void)initialized;
+	return tables[crRegisters ? 1 : 0];
+}
 
-				/* done */
-				il.MarkLabel(doneLabel);
+
+/* Lifted IL memoization
+
+Non-branch instructions lift the same way wherever they appear; the handlers
+above never look at the address. So the IL for each instruction word is
+recorded once as a template of raw expressions, with operands that point at
+other expressions or at instructions (If/Goto targets) stored relative to the
+start of the template. Later occurrences of the word replay the template
+with AddExpr() instead of going through capstone and the handler again.
+
+Only operations whose operand layout is known below are recorded, anything
+else (intrinsics, operand lists) just isn't cached. */
+#define LIFT_TEMPLATE_MAX 0x10000
+
+struct LiftTemplateExpr
+{
+	BNLowLevelILOperation operation;
+	size_t size;
+	uint32_t flags;
+	uint64_t operands[4];
+};
+
+struct LiftTemplate
+{
+	std::vector<LiftTemplateExpr> exprs;
+	std::vector<size_t> instructions; /* root expression of each instruction */
+};
+
+static std::shared_mutex liftTemplateMutex;
+static std::unordered_map<uint64_t, LiftTemplate> liftTemplates;
+
+/* per operand: 'e' expression, 'i' instruction index, anything else is a
+ * plain value that's copied through as is */
+static const char* GetLiftTemplateOperands(BNLowLevelILOperation operation)
+{
+	switch (operation)
+	{
+		case LLIL_NOP:
+		case LLIL_REG:
+		case LLIL_CONST:
+		case LLIL_CONST_PTR:
+		case LLIL_FLAG:
+		case LLIL_FLAG_BIT:
+		case LLIL_FLAG_GROUP:
+		case LLIL_SYSCALL:
+		case LLIL_TRAP:
+		case LLIL_UNDEF:
+		case LLIL_UNIMPL:
+		case LLIL_FLOAT_CONST:
+			return "vvvv";
+		case LLIL_SET_REG:
+		case LLIL_SET_FLAG:
+			return "vevv";
+		case LLIL_LOAD:
+		case LLIL_NEG:
+		case LLIL_NOT:
+		case LLIL_SX:
+		case LLIL_ZX:
+		case LLIL_LOW_PART:
+		case LLIL_BOOL_TO_INT:
+		case LLIL_JUMP:
+		case LLIL_RET:
+		case LLIL_FNEG:
+		case LLIL_FABS:
+		case LLIL_FSQRT:
+		case LLIL_FLOAT_CONV:
+		case LLIL_FLOAT_TO_INT:
+		case LLIL_INT_TO_FLOAT:
+		case LLIL_ROUND_TO_INT:
+		case LLIL_FLOOR:
+		case LLIL_CEIL:
+		case LLIL_FTRUNC:
+			return "evvv";
+		case LLIL_STORE:
+		case LLIL_ADD:
+		case LLIL_SUB:
+		case LLIL_AND:
+		case LLIL_OR:
+		case LLIL_XOR:
+		case LLIL_LSL:
+		case LLIL_LSR:
+		case LLIL_ASR:
+		case LLIL_ROL:
+		case LLIL_ROR:
+		case LLIL_MUL:
+		case LLIL_MULU_DP:
+		case LLIL_MULS_DP:
+		case LLIL_DIVU:
+		case LLIL_DIVS:
+		case LLIL_CMP_E:
+		case LLIL_CMP_NE:
+		case LLIL_CMP_SLT:
+		case LLIL_CMP_ULT:
+		case LLIL_CMP_SLE:
+		case LLIL_CMP_ULE:
+		case LLIL_CMP_SGE:
+		case LLIL_CMP_UGE:
+		case LLIL_CMP_SGT:
+		case LLIL_CMP_UGT:
+		case LLIL_TEST_BIT:
+		case LLIL_FADD:
+		case LLIL_FSUB:
+		case LLIL_FMUL:
+		case LLIL_FDIV:
+		case LLIL_FCMP_E:
+		case LLIL_FCMP_NE:
+		case LLIL_FCMP_LT:
+		case LLIL_FCMP_LE:
+		case LLIL_FCMP_GE:
+		case LLIL_FCMP_GT:
+		case LLIL_FCMP_O:
+		case LLIL_FCMP_UO:
+			return "eevv";
+		case LLIL_ADC:
+		case LLIL_SBB:
+		case LLIL_RLC:
+		case LLIL_RRC:
+			return "eeev";
+		case LLIL_IF:
+			return "eiiv";
+		case LLIL_GOTO:
+			return "ivvv";
+		default:
+			return NULL;
+	}
+}
+
+static uint64_t GetLiftTemplateKey(const uint8_t* data, bool le, bool crRegisters)
+{
+	uint32_t word;
+	memcpy(&word, data, sizeof(word));
+	return ((uint64_t)crRegisters << 33) | ((uint64_t)le << 32) | word;
+}
+
+static void RecordLiftTemplate(LowLevelILFunction& il, const uint8_t* data, bool le, bool crRegisters,
+	size_t exprStart, size_t instrStart)
+{
+	size_t exprEnd = il.GetExprCount();
+	size_t instrEnd = il.GetInstructionCount();
+	LiftTemplate entry;
+
+	for (size_t i = exprStart; i < exprEnd; i++)
+	{
+		BNLowLevelILInstruction expr = il.GetRawExpr(i);
+		const char* kinds = GetLiftTemplateOperands(expr.operation);
+		if (!kinds)
+			return;
+
+		LiftTemplateExpr templ = { expr.operation, expr.size, expr.flags, {} };
+		for (size_t j = 0; j < 4; j++)
+		{
+			uint64_t operand = expr.operands[j];
+			switch (kinds[j])
+			{
+				case 'e':
+					if (operand < exprStart || operand >= i)
+						return;
+					operand -= exprStart;
+					break;
+				case 'i':
+					if (operand < instrStart || operand > instrEnd)
+						return;
+					operand -= instrStart;
+					break;
 			}
-			break;
+			templ.operands[j] = operand;
+		}
+		entry.exprs.push_back(templ);
+	}
+
+	for (size_t i = instrStart; i < instrEnd; i++)
+	{
+		size_t root = il.GetIndexForInstruction(i);
+		if (root < exprStart || root >= exprEnd)
+			return;
+		entry.instructions.push_back(root - exprStart);
+	}
 
-		case PPC_INS_LMW:
-			REQUIRE2OPS
-			for(i=oper0->reg; i<=PPC_REG_R31; ++i) {
-				ei0 = il.SetRegister(4,
-					i,             // dest
-					il.Load(4,     // source
-						operToIL(il, oper1, OTI_IMM_BIAS, (i-(oper0->reg))*4)
-					)
-				);
+	std::unique_lock<std::shared_mutex> lock(liftTemplateMutex);
+	if (liftTemplates.size() < LIFT_TEMPLATE_MAX)
+		liftTemplates.emplace(GetLiftTemplateKey(data, le, crRegisters), std::move(entry));
+}
+
+/* returns TRUE - if the instruction was lifted from a recorded template */
+bool GetCachedLowLevelILForPPCInstruction(LowLevelILFunction& il, const uint8_t* data, bool le, bool crRegisters)
+{
+	const LiftTemplate* entry;
+	{
+		/* entries are never modified or erased once inserted */
+		std::shared_lock<std::shared_mutex> lock(liftTemplateMutex);
+		auto it = liftTemplates.find(GetLiftTemplateKey(data, le, crRegisters));
+		if (it == liftTemplates.end())
+			return false;
+		entry = &it->second;
+	}
+
+	size_t instrStart = il.GetInstructionCount();
+	std::vector<ExprId> exprs;
+	exprs.reserve(entry->exprs.size());
+
+	for (const LiftTemplateExpr& templ : entry->exprs)
+	{
+		const char* kinds = GetLiftTemplateOperands(templ.operation);
+		uint64_t operands[4];
 
-				il.AddInstruction(ei0);
+		for (size_t j = 0; j < 4; j++)
+		{
+			switch (kinds[j])
+			{
+				case 'e':
+					operands[j] = exprs[templ.operands[j]];
+					break;
+				case 'i':
+					operands[j] = instrStart + templ.operands[j];
+					break;
+				default:
+					operands[j] = templ.operands[j];
 			}
+		}
+
+		exprs.push_back(il.AddExpr(templ.operation, templ.size, templ.flags,
+			operands[0], operands[1], operands[2], operands[3]));
+	}
+
+	for (size_t root : entry->instructions)
+		il.AddInstruction(exprs[root]);
+
+	return true;
+}
+
+/* returns TRUE - if this IL continues
+          FALSE - if this IL terminates a block */
+/* record forms that don't write cr0: floating point ops ("fadd.") write
+ * cr1, vector compares ("vcmpequb.") cr6 */
+static uint32_t GetRecordField(struct cs_insn *insn, struct cs_ppc *ppc)
+{
+	size_t len = strlen(insn->mnemonic);
+
+	if (!len || insn->mnemonic[len - 1] != '.')
+		return 0;
+	if (!ppc->op_count || ppc->operands[0].type != PPC_OP_REG)
+		return 0;
+
+	if (ppc->operands[0].reg >= PPC_REG_F0 && ppc->operands[0].reg <= PPC_REG_F31)
+		return PPC_REG_CR1;
+	if (IsVectorRegister(ppc->operands[0].reg))
+		return PPC_REG_CR6;
+
+	return 0;
+}
+
+/* instructions capstone can't decode, which the architecture decodes by
+ * hand for disassembly (see PerformLocalDisassembly) */
+bool GetLowLevelILForLocalInstruction(LowLevelILFunction &il, uint32_t insword, bool crRegisters)
+{
+	// 111111AAA00BBBBBCCCCC00001000000 "fcmpo crA,fB,fC"
+	if ((insword & 0xFC6007FF) == 0xFC000040)
+	{
+		LiftFloatCompare(il,
+			PPC_REG_CR0 + ((insword >> 23) & 7),
+			PPC_REG_F0 + ((insword >> 16) & 31),
+			PPC_REG_F0 + ((insword >> 11) & 31),
+			crRegisters);
+		return true;
+	}
+
+	// 111100AAAAABBBBBCCCCC00011010BCA "xxpermr vsA,vsB,vsC", vsA is read too
+	if ((insword & 0xFC0007F8) == 0xF00001D0)
+	{
+		uint32_t xT = VsxVectorRegister(PPC_REG_VS0 + (((insword >> 21) & 0x1f) | ((insword & 0x1) << 5)));
+		uint32_t xA = VsxVectorRegister(PPC_REG_VS0 + (((insword >> 16) & 0x1f) | ((insword & 0x4) << 3)));
+		uint32_t xB = VsxVectorRegister(PPC_REG_VS0 + (((insword >> 11) & 0x1f) | ((insword & 0x2) << 4)));
+
+		il.AddInstruction(il.Intrinsic({ RegisterOrFlag::Register(xT) }, PPC_INTRIN_XXPERMR,
+			{ il.Register(16, xA), il.Register(16, xT), il.Register(16, xB) }));
+		return true;
+	}
+
+	return false;
+}
+
+bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
+  const uint8_t* data, uint64_t addr, decomp_result *res, bool le, bool crRegisters)
+{
+	int i;
+	bool rc = true;
+
+	/* bypass capstone path for *all* branching instructions; capstone
+	 * is too difficult to work with and is outright broken for some
+	 * branch instructions (bdnz, etc.)
+	 */
+	if (LiftBranches(arch, il, data, addr, le, crRegisters))
+		return true;
+
+	struct cs_insn *insn = &(res->insn);
+	struct cs_detail *detail = &(res->detail);
+	struct cs_ppc *ppc = &(detail->ppc);
+
+	/* There is a simplifying reduction available for:
+	 *   rlwinm <reg>, <reg>, <rol_amt>, <mask_begin>, <mask_end>
+	 * When <rol_amt> == <mask_begin> == 0, this can be translated to:
+	 *   clrwi <reg>, <reg>, 31-<mask_end>
+	 *
+	 * Unfortunately capstone screws this up, replacing just the instruction id with PPC_INSN_CLRWI.
+	 * The mnemonic ("rlwinm"), operands, etc. all stay the same.
+	 */
+	if (insn->id == PPC_INS_CLRLWI && insn->mnemonic[0] == 'r')
+	{
+		insn->id = PPC_INS_RLWINM;
+	}
+
+	/* mfspr, mtspr and mftb come under many capstone aliases (mflr, mtsrr2,
+	 * mfibatu, mftbu...), all lifted as the generic forms with the spr number
+	 * taken from the encoding */
+	uint32_t insword = *(const uint32_t *) data;
+	if (!le)
+		insword = bswap32(insword);
+
+	uint32_t xo = (insword >> 1) & 0x3ff;
+	if ((insword >> 26) == 31 && (xo == 339 || xo == 371 || xo == 467))
+	{
+		cs_ppc_op *gpr = &ppc->operands[xo == 467 ? 1 : 0];
+		cs_ppc_op *spr = &ppc->operands[xo == 467 ? 0 : 1];
+
+		insn->id = (xo == 467) ? PPC_INS_MTSPR : PPC_INS_MFSPR;
+		gpr->type = PPC_OP_REG;
+		gpr->reg = (ppc_reg)(PPC_REG_R0 + ((insword >> 21) & 0x1f));
+		spr->type = PPC_OP_IMM;
+		spr->imm = ((insword >> 16) & 0x1f) | ((insword >> 6) & 0x3e0);
+		ppc->op_count = 2;
+	}
+
+	/* andi. and andis. only exist as record forms */
+	if (insn->id == PPC_INS_ANDI || insn->id == PPC_INS_ANDIS)
+		ppc->update_cr0 = true;
+
+	/* some record forms update another field than cr0 */
+	uint32_t recordField = GetRecordField(insn, ppc);
+	if (recordField)
+		ppc->update_cr0 = false;
+
+	/* with cr registers, record forms write cr0 after the fact instead of
+	 * through a flag write */
+	bool updateCr0 = crRegisters && ppc->update_cr0;
+	if (updateCr0)
+		ppc->update_cr0 = false;
+
+	/* create convenient access to instruction operands */
+	cs_ppc_op *oper[5] = { NULL, NULL, NULL, NULL, NULL };
+
+	for (i = 0; i < ppc->op_count && i < 5; i++)
+		oper[i] = &(ppc->operands[i]);
+
+	/* for conditionals that specify a crx, treat it special */
+	if(ppc->bc != PPC_BC_INVALID) {
+		if(oper[0] && oper[0]->type == PPC_OP_REG && oper[0]->reg >= PPC_REG_CR0 &&
+		  ppc->operands[0].reg <= PPC_REG_CR7) {
+			oper[0] = oper[1];
+			oper[1] = oper[2];
+			oper[2] = oper[3];
+			oper[3] = NULL;
+		}
+	}
+
+	/* operands are only ever checked as a leading run */
+	uint8_t nOps = 0;
+	while (nOps < 5 && oper[nOps])
+		nOps++;
+
+	size_t exprStart = il.GetExprCount();
+	size_t instrStart = il.GetInstructionCount();
+
+	const LiftEntry* entry = (insn->id < PPC_INS_ENDING) ? &GetLiftTable(crRegisters)[insn->id] : NULL;
+	if (entry && entry->handler && nOps >= entry->minOps && entry->handler(il, insn, ppc, oper))
+	{
+		if (updateCr0 && oper[0] && oper[0]->type == PPC_OP_REG)
+		{
+			uint32_t rD = oper[0]->reg;
+			il.AddInstruction(SetCrField(il, PPC_REG_CR0,
+				[&]() { return il.Register(4, rD); },
+				[&]() { return il.Const(4, 0); }));
+		}
+
+		if (recordField == PPC_REG_CR1)
+			LiftFloatRecord(il, crRegisters);
+		else if (recordField == PPC_REG_CR6)
+			LiftVectorRecord(il, insn->id, oper[0]->reg, crRegisters);
+	}
+	else
+	{
+		MYLOG("%s:%s() returning Unimplemented(...) on:\n",
+		  __FILE__, __func__);
+
+		MYLOG("    %08llx: %02X %02X %02X %02X %s %s\n",
+		  addr, data[0], data[1], data[2], data[3],
+		  res->insn.mnemonic, res->insn.op_str);
+
+		il.AddInstruction(il.Unimplemented());
+	}
+
+	RecordLiftTemplate(il, data, le, crRegisters, exprStart, instrStart);
+
+	return rc;
+}
+
+
+
+static void LiftVleBranch(Architecture* arch, LowLevelILFunction &il, uint64_t addr, const struct vle_insn *insn)
+{
+	uint32_t target = insn->operands[insn->op_count - 1].label;
+	uint64_t next = addr + insn->size;
+
+	if (insn->id == VLE_INS_SE_B || insn->id == VLE_INS_E_B)
+	{
+		/* "e_bl .+4" loads the address of the next instruction, not a call */
+		if (insn->lk && target == next)
+		{
+			il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.ConstPointer(4, next)));
+			return;
+		}
+
+		BNLowLevelILLabel *label = il.GetLabelForAddress(arch, target);
+
+		if (label && !(insn->lk && (target != next)))
+		{
+			if (insn->lk)
+				il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.ConstPointer(4, next)));
+
+			il.AddInstruction(il.Goto(*label));
+		}
+		else
+		{
+			ExprId dest = il.ConstPointer(4, target);
+
+			if (insn->lk)
+				il.AddInstruction(il.Call(dest));
+			else
+				il.AddInstruction(il.Jump(dest));
+		}
+
+		return;
+	}
+
+	BNLowLevelILLabel *existingTakenLabel = il.GetLabelForAddress(arch, target);
+	BNLowLevelILLabel *existingFalseLabel = il.GetLabelForAddress(arch, next);
+
+	if (insn->lk)
+		il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.ConstPointer(4, next)));
+
+	LowLevelILLabel takenLabelManual, falseLabelManual;
+	BNLowLevelILLabel* takenLabel = existingTakenLabel;
+	BNLowLevelILLabel* falseLabel = existingFalseLabel;
+
+	if (!takenLabel)
+		takenLabel = &takenLabelManual;
+
+	if (!falseLabel)
+		falseLabel = &falseLabelManual;
+
+	LiftConditionalBranch(il, insn->bo, insn->bi, *takenLabel, *falseLabel);
 
+	if (!existingTakenLabel)
+		il.MarkLabel(*takenLabel);
+
+	if (target != next)
+	{
+		if (insn->lk)
+		{
+			il.AddInstruction(il.Call(il.ConstPointer(4, target)));
+			il.AddInstruction(il.Goto(*falseLabel));
+		}
+		else if (!existingTakenLabel)
+			il.AddInstruction(il.Jump(il.ConstPointer(4, target)));
+	}
+
+	if (!existingFalseLabel)
+		il.MarkLabel(*falseLabel);
+}
+
+
+/* VLE instructions reuse the flag and register model of the classic lifter;
+ * the Book E encodings shared with it never get here (see VLE_INS_BOOKE)
+ *
+ * returns TRUE - if this IL continues
+ *        FALSE - if this IL terminates a block */
+bool GetLowLevelILForVLEInstruction(Architecture *arch, LowLevelILFunction &il,
+  uint64_t addr, const struct vle_insn *insn)
+{
+	int i;
+	bool rc = true;
+	const struct vle_op *oper0 = &(insn->operands[0]);
+	const struct vle_op *oper1 = &(insn->operands[1]);
+	const struct vle_op *oper2 = &(insn->operands[2]);
+	const struct vle_op *oper3 = &(insn->operands[3]);
+	const struct vle_op *oper4 = &(insn->operands[4]);
+	uint32_t flags = insn->rc ? IL_FLAGWRITE_CR0_S : 0;
+	uint32_t bit;
+	size_t size;
+
+	ExprId ei0, ei1;
+
+	switch(insn->id) {
+		case VLE_INS_SE_ILLEGAL:
+			il.AddInstruction(il.Undefined());
 			break;
 
-		/*
-			load byte and zero extend [and update]
-		*/
-		case PPC_INS_LBZ:
-		case PPC_INS_LBZU:
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper1, OTI_GPR0_ZERO); // d(rA) or 0
-			ei0 = il.Load(1, ei0);                    // [d(rA)]
-			ei0 = il.ZeroExtend(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0); // rD = [d(rA)]
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_ISYNC:
+			il.AddInstruction(il.Nop());
+			break;
 
-			// if update, rA is set to effective address (d(rA))
-			if(insn->id == PPC_INS_LBZU) {
-				ei0 = il.SetRegister(4, oper1->mem.base, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_SC:
+		case VLE_INS_E_SC:
+			il.AddInstruction(il.SystemCall());
+			break;
 
+		case VLE_INS_SE_BLR:
+			il.AddInstruction(il.Return(il.Register(4, PPC_REG_LR)));
 			break;
 
-		/*
-			load half word [and zero/sign extend] [and update]
-		*/
-		case PPC_INS_LBZX:
-		case PPC_INS_LBZUX:
-			REQUIRE3OPS
-			ei0 = operToIL(il, oper1, OTI_GPR0_ZERO);              // d(rA) or 0
-			ei0 = il.Load(1, il.Add(4, ei0, operToIL(il, oper2))); // [d(rA) + d(rB)]
-			ei0 = il.ZeroExtend(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0);              // rD = [d(rA)]
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_BLRL:
+			il.AddInstruction(il.Call(il.Register(4, PPC_REG_LR)));
+			break;
 
-			// if update, rA is set to effective address (d(rA))
-			if(insn->id == PPC_INS_LBZUX && oper1->reg != oper0->reg && oper1->reg != PPC_REG_R0) {
-				ei0 = il.SetRegister(4, oper1->reg, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_BCTR:
+			il.AddInstruction(il.Jump(il.Register(4, PPC_REG_CTR)));
+			break;
 
+		case VLE_INS_SE_BCTRL:
+			il.AddInstruction(il.Call(il.Register(4, PPC_REG_CTR)));
 			break;
 
-		/*
-			load half word [and zero/sign extend] [and update]
-		*/
-		case PPC_INS_LHZ:
-		case PPC_INS_LHZU:
-		case PPC_INS_LHA:
-		case PPC_INS_LHAU:
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper1, OTI_GPR0_ZERO); // d(rA) or 0
-			ei0 = il.Load(2, ei0);                    // [d(rA)]
-			if(insn->id == PPC_INS_LHZ || insn->id == PPC_INS_LHZU)
-				ei0 = il.ZeroExtend(4, ei0);
-			else
-				ei0 = il.SignExtend(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0); // rD = [d(rA)]
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_RFI:
+			LiftReturnFromInterrupt(il, 26);
+			break;
 
-			// if update, rA is set to effective address (d(rA))
-			if(insn->id == PPC_INS_LHZU || insn->id == PPC_INS_LHAU) {
-				ei0 = il.SetRegister(4, oper1->mem.base, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_RFCI:
+			LiftReturnFromInterrupt(il, 58);
+			break;
 
+		case VLE_INS_SE_RFDI:
+			LiftReturnFromInterrupt(il, 574);
 			break;
 
-		/*
-			load half word [and zero/sign extend] [and update]
-		*/
-		case PPC_INS_LHZX:
-		case PPC_INS_LHZUX:
-		case PPC_INS_LHAX:
-		case PPC_INS_LHAUX:
-			REQUIRE3OPS
-			ei0 = operToIL(il, oper1, OTI_GPR0_ZERO);              // d(rA) or 0
-			ei0 = il.Load(2, il.Add(4, ei0, operToIL(il, oper2))); // [d(rA) + d(rB)]
-			if(insn->id == PPC_INS_LHZX || insn->id == PPC_INS_LHZUX)
-				ei0 = il.ZeroExtend(4, ei0);
-			else
-				ei0 = il.SignExtend(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0);              // rD = [d(rA)]
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_RFMCI:
+			LiftReturnFromInterrupt(il, 570);
+			break;
 
-			// if update, rA is set to effective address (d(rA))
-			if((insn->id == PPC_INS_LHZUX || insn->id == PPC_INS_LHAUX) && oper1->reg != oper0->reg && oper1->reg != PPC_REG_R0) {
-				ei0 = il.SetRegister(4, oper1->reg, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_B:
+		case VLE_INS_E_B:
+		case VLE_INS_SE_BC:
+		case VLE_INS_E_BC:
+			LiftVleBranch(arch, il, addr, insn);
+			break;
 
+		case VLE_INS_SE_NOT:
+			ei0 = il.Not(4, il.Register(4, oper0->reg));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		/*
-			load word [and zero] [and update]
-		*/
-		case PPC_INS_LWZ:
-		case PPC_INS_LWZU:
-			REQUIRE2OPS
-			ei0 = operToIL(il, oper1, OTI_GPR0_ZERO); // d(rA) or 0
-			ei0 = il.Load(4, ei0);                    // [d(rA)]
-			ei0 = il.SetRegister(4, oper0->reg, ei0); // rD = [d(rA)]
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_NEG:
+			ei0 = il.Neg(4, il.Register(4, oper0->reg));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
+			break;
 
-			// if update, rA is set to effective address (d(rA))
-			if(insn->id == PPC_INS_LWZU) {
-				ei0 = il.SetRegister(4, oper1->mem.base, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_MFLR:
+			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Register(4, PPC_REG_LR)));
+			break;
 
+		case VLE_INS_SE_MTLR:
+			il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.Register(4, oper0->reg)));
 			break;
 
-		/*
-			load word [and zero] [and update]
-		*/
-		case PPC_INS_LWZX:
-		case PPC_INS_LWZUX:
-			REQUIRE3OPS
-			ei0 = operToIL(il, oper1, OTI_GPR0_ZERO);              // d(rA) or 0
-			ei0 = il.Load(4, il.Add(4, ei0, operToIL(il, oper2))); // [d(rA) + d(rB)]
-			ei0 = il.SetRegister(4, oper0->reg, ei0);              // rD = [d(rA)]
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_MFCTR:
+			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Register(4, PPC_REG_CTR)));
+			break;
 
-			// if update, rA is set to effective address (d(rA))
-			if(insn->id == PPC_INS_LWZUX && oper1->reg != oper0->reg && oper1->reg != PPC_REG_R0) {
-				ei0 = il.SetRegister(4, oper1->reg, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_MTCTR:
+			il.AddInstruction(il.SetRegister(4, PPC_REG_CTR, il.Register(4, oper0->reg)));
+			break;
+
+		case VLE_INS_SE_EXTZB:
+		case VLE_INS_SE_EXTSB:
+		case VLE_INS_SE_EXTZH:
+		case VLE_INS_SE_EXTSH:
+			size = (insn->id == VLE_INS_SE_EXTZB || insn->id == VLE_INS_SE_EXTSB) ? 1 : 2;
+			ei0 = il.LowPart(size, il.Register(4, oper0->reg));
+			if (insn->id == VLE_INS_SE_EXTSB || insn->id == VLE_INS_SE_EXTSH)
+				ei0 = il.SignExtend(4, ei0);
+			else
+				ei0 = il.ZeroExtend(4, ei0);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
+			break;
+
+		case VLE_INS_SE_MR:
+		case VLE_INS_SE_MTAR:
+		case VLE_INS_SE_MFAR:
+			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Register(4, oper1->reg)));
+			break;
 
+		case VLE_INS_SE_ADD:
+			ei0 = il.Add(4, il.Register(4, oper0->reg), il.Register(4, oper1->reg));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_LHBRX:
-			REQUIRE3OPS
-			ByteReversedLoad(il, ppc, 2);
+		case VLE_INS_SE_MULLW:
+			ei0 = il.Mult(4, il.Register(4, oper0->reg), il.Register(4, oper1->reg));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_LWBRX:
-			REQUIRE3OPS
-			ByteReversedLoad(il, ppc, 4);
+		case VLE_INS_SE_SUB:
+			ei0 = il.Sub(4, il.Register(4, oper0->reg), il.Register(4, oper1->reg));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_STHBRX:
-			REQUIRE3OPS
-			ByteReversedStore(il, ppc, 2);
+		case VLE_INS_SE_SUBF:
+			ei0 = il.Sub(4, il.Register(4, oper1->reg), il.Register(4, oper0->reg));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_STWBRX:
-			REQUIRE3OPS
-			ByteReversedStore(il, ppc, 4);
+		case VLE_INS_SE_CMP:
+		case VLE_INS_SE_CMPL:
+			ei0 = il.Register(4, oper0->reg);
+			ei1 = il.Register(4, oper1->reg);
+			il.AddInstruction(il.Sub(4, ei0, ei1,
+				crxToFlagWriteType(PPC_REG_CR0, insn->id == VLE_INS_SE_CMP)));
 			break;
 
-		case PPC_INS_MFCTR: // move from ctr
-			REQUIRE1OP
-			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Register(4, PPC_REG_CTR)));
+		case VLE_INS_SE_CMPH:
+		case VLE_INS_E_CMPH:
+			if (insn->id == VLE_INS_E_CMPH)
+			{
+				ei0 = il.SignExtend(4, il.LowPart(2, il.Register(4, oper1->reg)));
+				ei1 = il.SignExtend(4, il.LowPart(2, il.Register(4, oper2->reg)));
+			}
+			else
+			{
+				ei0 = il.SignExtend(4, il.LowPart(2, il.Register(4, oper0->reg)));
+				ei1 = il.SignExtend(4, il.LowPart(2, il.Register(4, oper1->reg)));
+			}
+			il.AddInstruction(il.Sub(4, ei0, ei1,
+				crxToFlagWriteType(insn->id == VLE_INS_E_CMPH ? oper0->reg : PPC_REG_CR0)));
 			break;
 
-		case PPC_INS_MFLR: // move from link register
-			REQUIRE1OP
-			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Register(4, PPC_REG_LR)));
+		case VLE_INS_SE_CMPHL:
+		case VLE_INS_E_CMPHL:
+			if (insn->id == VLE_INS_E_CMPHL)
+			{
+				ei0 = il.ZeroExtend(4, il.LowPart(2, il.Register(4, oper1->reg)));
+				ei1 = il.ZeroExtend(4, il.LowPart(2, il.Register(4, oper2->reg)));
+			}
+			else
+			{
+				ei0 = il.ZeroExtend(4, il.LowPart(2, il.Register(4, oper0->reg)));
+				ei1 = il.ZeroExtend(4, il.LowPart(2, il.Register(4, oper1->reg)));
+			}
+			il.AddInstruction(il.Sub(4, ei0, ei1,
+				crxToFlagWriteType(insn->id == VLE_INS_E_CMPHL ? oper0->reg : PPC_REG_CR0, false)));
 			break;
 
-		case PPC_INS_MTCTR: // move to ctr
-			REQUIRE1OP
-			il.AddInstruction(il.SetRegister(4, PPC_REG_CTR, operToIL(il, oper0)));
+		case VLE_INS_SE_ADDI:
+		case VLE_INS_E_ADD2I:
+			ei0 = il.Add(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_MTLR: // move to link register
-			REQUIRE1OP
-			il.AddInstruction(il.SetRegister(4, PPC_REG_LR, operToIL(il, oper0)));
+		case VLE_INS_E_ADD2IS:
+			ei0 = il.Add(4, il.Register(4, oper0->reg), il.Const(4, (uint32_t)oper1->imm << 16));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_NEG:
-			REQUIRE2OPS
-			ei0 = il.Neg(4, operToIL(il, oper1));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+		case VLE_INS_SE_SUBI:
+			ei0 = il.Sub(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_NOP:
-			il.AddInstruction(il.Nop());
+		case VLE_INS_E_ADDI:
+		case VLE_INS_E_ADD16I:
+			ei0 = il.Add(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_NOT:
-			REQUIRE2OPS
-			ei0 = il.Not(4, operToIL(il, oper1));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
-			break;
-
-		case PPC_INS_OR:
-		case PPC_INS_ORC:
-		case PPC_INS_NOR:
-			REQUIRE3OPS
-			ei0 = operToIL(il, oper2);
-			if (insn->id == PPC_INS_ORC)
-				ei0 = il.Not(4, ei0);
-			ei0 = il.Or(4, operToIL(il, oper1), ei0);
-			if (insn->id == PPC_INS_NOR)
-				ei0 = il.Not(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
+		case VLE_INS_E_ADDIC:
+			ei0 = il.Add(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm), IL_FLAGWRITE_XER_CA);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_ORI:
-		case PPC_INS_ORIS:
-			REQUIRE3OPS
-			if (insn->id == PPC_INS_ORIS)
-				ei0 = il.Const(4, oper2->imm << 16);
-			else
-				ei0 = il.Const(4, oper2->imm);
-			ei0 = il.Or(4, operToIL(il, oper1), ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0);
-			il.AddInstruction(ei0);
+		case VLE_INS_E_SUBFIC:
+			ei0 = il.Sub(4, il.Const(4, oper2->imm), il.Register(4, oper1->reg), IL_FLAGWRITE_XER_CA);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_XOR:
-		case PPC_INS_EQV:
-			REQUIRE3OPS
-			ei0 = il.Xor(4,
-				operToIL(il, oper1),
-				operToIL(il, oper2)
-			);
-			if (insn->id == PPC_INS_EQV)
-				ei0 = il.Not(4, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
+		case VLE_INS_E_MULLI:
+			ei0 = il.Mult(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_XORI:
-		case PPC_INS_XORIS:
-			REQUIRE3OPS
-			if (insn->id == PPC_INS_XORIS)
-				ei0 = il.Const(4, oper2->imm << 16);
-			else
-				ei0 = il.Const(4, oper2->imm);
-			ei0 = il.SetRegister(
-				4,
-				oper0->reg,
-				il.Xor(4,
-					operToIL(il, oper1),
-					ei0
-				)
-			);
-			il.AddInstruction(ei0);
+		case VLE_INS_E_MULL2I:
+			ei0 = il.Mult(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_SUBF:
-		case PPC_INS_SUBFC:
-		case PPC_INS_SUBFIC:
-			REQUIRE3OPS
-			ei0 = il.Sub(
-				4,
-				operToIL(il, oper2),
-				operToIL(il, oper1),
-				(insn->id != PPC_INS_SUBF) ? IL_FLAGWRITE_XER_CA : 0
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
+		case VLE_INS_SE_CMPI:
+		case VLE_INS_E_CMP16I:
+			ei0 = il.Sub(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm),
+				crxToFlagWriteType(PPC_REG_CR0));
 			il.AddInstruction(ei0);
 			break;
 
-		case PPC_INS_SUBFE:
-			REQUIRE3OPS
-			ei0 = il.SubBorrow(
-				4,
-				operToIL(il, oper2),
-				operToIL(il, oper1),
-				il.Flag(IL_FLAG_XER_CA),
-				IL_FLAGWRITE_XER_CA
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
+		case VLE_INS_SE_CMPLI:
+		case VLE_INS_E_CMPL16I:
+			ei0 = il.Sub(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm),
+				crxToFlagWriteType(PPC_REG_CR0, false));
 			il.AddInstruction(ei0);
 			break;
 
-		case PPC_INS_SUBFME:
-		case PPC_INS_SUBFZE:
-			REQUIRE2OPS
-			if (insn->id == PPC_INS_SUBFME)
-				ei0 = il.Const(4, 0xffffffff);
+		case VLE_INS_E_CMPH16I:
+		case VLE_INS_E_CMPHL16I:
+			ei0 = il.LowPart(2, il.Register(4, oper0->reg));
+			if (insn->id == VLE_INS_E_CMPH16I)
+				ei0 = il.SignExtend(4, ei0);
 			else
-				ei0 = il.Const(4, 0);
-			ei0 = il.AddCarry(
-				4,
-				ei0,
-				operToIL(il, oper1),
-				il.Flag(IL_FLAG_XER_CA),
-				IL_FLAGWRITE_XER_CA
-			);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-				ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
+				ei0 = il.ZeroExtend(4, ei0);
+			ei0 = il.Sub(4, ei0, il.Const(4, oper1->imm),
+				crxToFlagWriteType(PPC_REG_CR0, insn->id == VLE_INS_E_CMPH16I));
 			il.AddInstruction(ei0);
 			break;
 
-		case PPC_INS_STMW:
-			REQUIRE2OPS
-			for(i=oper0->reg; i<=PPC_REG_R31; ++i) {
-				ei0 = il.Register(4, i); // source
-				ei1 = operToIL(il, oper1, OTI_IMM_BIAS, (i-(oper0->reg))*4);
-				il.AddInstruction(
-					il.Store(4,
-						ei1,
-						ei0
-					)
-				);
-			}
-
-			break;
-
-		/* store half word [with update] */
-		case PPC_INS_STB:
-		case PPC_INS_STBU: /* store(size, addr, val) */
-			REQUIRE2OPS
-			ei0 = il.Store(1,
-				operToIL(il, oper1, OTI_GPR0_ZERO),
-				il.LowPart(1, operToIL(il, oper0))
-			);
+		case VLE_INS_E_CMPI:
+		case VLE_INS_E_CMPLI:
+			ei0 = il.Sub(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm),
+				crxToFlagWriteType(oper0->reg, insn->id == VLE_INS_E_CMPI));
 			il.AddInstruction(ei0);
-
-			// if update, then rA gets updated address
-			if(insn->id == PPC_INS_STBU) {
-				ei0 = il.SetRegister(4, oper1->mem.base, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
-
 			break;
 
-		/* store half word indexed [with update] */
-		case PPC_INS_STBX:
-		case PPC_INS_STBUX: /* store(size, addr, val) */
-			REQUIRE3OPS
-			ei0 = il.Store(1,
-				il.Add(4, operToIL(il, oper1, OTI_GPR0_ZERO), operToIL(il, oper2)),
-				il.LowPart(1, operToIL(il, oper0))
-			);
-			il.AddInstruction(ei0);
-
-			// if update, then rA gets updated address
-			if(insn->id == PPC_INS_STBUX) {
-				ei0 = il.SetRegister(4, oper1->reg,
-					il.Add(4, operToIL(il, oper1), operToIL(il, oper2))
-				);
-				il.AddInstruction(ei0);
-			}
-
+		case VLE_INS_SE_BMASKI:
+			ei0 = il.Const(4, oper1->imm ? (0xffffffff >> (32 - oper1->imm)) : 0xffffffff);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		/* store half word [with update] */
-		case PPC_INS_STH:
-		case PPC_INS_STHU: /* store(size, addr, val) */
-			REQUIRE2OPS
-			ei0 = il.Store(2,
-				operToIL(il, oper1, OTI_GPR0_ZERO),
-				il.LowPart(2, operToIL(il, oper0))
-			);
-			il.AddInstruction(ei0);
-
-			// if update, then rA gets updated address
-			if(insn->id == PPC_INS_STHU) {
-				ei0 = il.SetRegister(4, oper1->mem.base, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
-
+		case VLE_INS_SE_ANDI:
+		case VLE_INS_E_AND2I:
+			ei0 = il.And(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		/* store half word indexed [with update] */
-		case PPC_INS_STHX:
-		case PPC_INS_STHUX: /* store(size, addr, val) */
-			REQUIRE3OPS
-			ei0 = il.Store(2,
-				il.Add(4, operToIL(il, oper1, OTI_GPR0_ZERO), operToIL(il, oper2)),
-				il.LowPart(2, operToIL(il, oper0))
-			);
-			il.AddInstruction(ei0);
-
-			// if update, then rA gets updated address
-			if(insn->id == PPC_INS_STHUX) {
-				ei0 = il.SetRegister(4, oper1->reg,
-					il.Add(4, operToIL(il, oper1), operToIL(il, oper2))
-				);
-				il.AddInstruction(ei0);
-			}
-
+		case VLE_INS_E_AND2IS:
+			ei0 = il.And(4, il.Register(4, oper0->reg), il.Const(4, (uint32_t)oper1->imm << 16));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		/* store word [with update] */
-		case PPC_INS_STW:
-		case PPC_INS_STWU: /* store(size, addr, val) */
-			REQUIRE2OPS
-			ei0 = il.Store(4,
-				operToIL(il, oper1, OTI_GPR0_ZERO),
-				operToIL(il, oper0)
-			);
-			il.AddInstruction(ei0);
-
-			// if update, then rA gets updated address
-			if(insn->id == PPC_INS_STWU) {
-				ei0 = il.SetRegister(4, oper1->mem.base, operToIL(il, oper1));
-				il.AddInstruction(ei0);
-			}
-
+		case VLE_INS_E_OR2I:
+			ei0 = il.Or(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		/* store word indexed [with update] */
-		case PPC_INS_STWX:
-		case PPC_INS_STWUX: /* store(size, addr, val) */
-			REQUIRE3OPS
-			ei0 = il.Store(4,
-				il.Add(4, operToIL(il, oper1, OTI_GPR0_ZERO), operToIL(il, oper2)),
-				operToIL(il, oper0)
-			);
-			il.AddInstruction(ei0);
-
-			// if update, then rA gets updated address
-			if(insn->id == PPC_INS_STWUX) {
-				ei0 = il.SetRegister(4, oper1->reg,
-					il.Add(4, operToIL(il, oper1), operToIL(il, oper2))
-				);
-				il.AddInstruction(ei0);
-			}
-
+		case VLE_INS_E_OR2IS:
+			ei0 = il.Or(4, il.Register(4, oper0->reg), il.Const(4, (uint32_t)oper1->imm << 16));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_RLWIMI:
-			REQUIRE5OPS
-			{
-				uint32_t mask = genMask(oper3->imm, oper4->imm);
+		case VLE_INS_E_ANDI:
+		case VLE_INS_E_ORI:
+		case VLE_INS_E_XORI:
+			ei0 = il.Register(4, oper1->reg);
+			ei1 = il.Const(4, oper2->imm);
+			if (insn->id == VLE_INS_E_ANDI)
+				ei0 = il.And(4, ei0, ei1);
+			else if (insn->id == VLE_INS_E_ORI)
+				ei0 = il.Or(4, ei0, ei1);
+			else
+				ei0 = il.Xor(4, ei0, ei1);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
+			break;
 
-				ei0 = il.Register(4, oper1->reg);
+		case VLE_INS_SE_SRW:
+		case VLE_INS_SE_SLW:
+			ei0 = il.Register(4, oper0->reg);
+			// permit bit 26 to survive to enable clearing the whole register
+			ei1 = il.And(4, il.Register(4, oper1->reg), il.Const(4, 0x3f));
+			if (insn->id == VLE_INS_SE_SLW)
+				ei0 = il.ShiftLeft(4, ei0, ei1);
+			else
+				ei0 = il.LogicalShiftRight(4, ei0, ei1);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
+			break;
 
-				if (oper2->imm != 0)
-				{
-					if ((mask & (~0u >> (32 - oper2->imm))) == 0)
-						ei0 = il.ShiftLeft(4, ei0, il.Const(4, oper2->imm));
-					else if ((mask & (~0u << oper2->imm)) == 0)
-						ei0 = il.LogicalShiftRight(4, ei0, il.Const(4, 32 - oper2->imm));
-					else
-						ei0 = il.RotateLeft(4, ei0, il.Const(4, oper2->imm));
-				}
+		case VLE_INS_SE_SRAW:
+			ei0 = il.Register(4, oper0->reg);
+			ei1 = il.And(4, il.Register(4, oper1->reg), il.Const(4, 0x1f));
+			ei0 = il.ArithShiftRight(4, ei0, ei1, IL_FLAGWRITE_XER_CA);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
+			break;
 
-				ei0 = il.And(4, ei0, il.Const(4, mask));
-				uint32_t invertMask = ~mask;
-				ei0 = il.Or(4, il.And(4, il.Register(4, oper0->reg), il.Const(4, invertMask)), ei0);
+		case VLE_INS_SE_OR:
+		case VLE_INS_SE_ANDC:
+		case VLE_INS_SE_AND:
+			ei0 = il.Register(4, oper0->reg);
+			ei1 = il.Register(4, oper1->reg);
+			if (insn->id == VLE_INS_SE_OR)
+				ei0 = il.Or(4, ei0, ei1);
+			else if (insn->id == VLE_INS_SE_ANDC)
+				ei0 = il.And(4, ei0, il.Not(4, ei1));
+			else
+				ei0 = il.And(4, ei0, ei1);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
+			break;
 
-				ei0 = il.SetRegister(4, oper0->reg, ei0,
-						ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-				);
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_LI:
+		case VLE_INS_E_LI:
+			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Const(4, oper1->imm)));
 			break;
 
-		case PPC_INS_RLWINM:
-			REQUIRE5OPS
-			{
-				uint32_t mask = genMask(oper3->imm, oper4->imm);
+		case VLE_INS_E_LIS:
+			ei0 = il.ConstPointer(4, (uint32_t)oper1->imm << 16);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
+			break;
 
-				ei0 = il.Register(4, oper1->reg);
+		/* bit numbering is big endian, bit 0 is the msb */
+		case VLE_INS_SE_BCLRI:
+			bit = 0x80000000 >> oper1->imm;
+			ei0 = il.And(4, il.Register(4, oper0->reg), il.Const(4, ~bit));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
+			break;
 
-				if (oper2->imm != 0)
-				{
-					if ((mask & (~0u >> (32 - oper2->imm))) == 0)
-					{
-						if (mask != 0xffffffff)
-							ei0 = il.And(4, ei0, il.Const(4, mask >> oper2->imm));
-
-						ei0 = il.ShiftLeft(4, ei0, il.Const(4, oper2->imm));
-					}
-					else if ((mask & (~0u << oper2->imm)) == 0)
-					{
-						if (mask != 0xffffffff)
-							ei0 = il.And(4, ei0, il.Const(4, mask << (32 - oper2->imm)));
-
-						ei0 = il.LogicalShiftRight(4, ei0, il.Const(4, 32 - oper2->imm));
-					}
-					else
-					{
-						ei0 = il.RotateLeft(4, ei0, il.Const(4, oper2->imm));
-
-						if (mask != 0xffffffff)
-							ei0 = il.And(4, ei0, il.Const(4, mask));
-					}
-				}
-				else if (mask != 0xffffffff)
-				{
-					ei0 = il.And(4, ei0, il.Const(4, mask));
-				}
+		case VLE_INS_SE_BGENI:
+			bit = 0x80000000 >> oper1->imm;
+			il.AddInstruction(il.SetRegister(4, oper0->reg, il.Const(4, bit)));
+			break;
 
-				ei0 = il.SetRegister(4, oper0->reg, ei0,
-						ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-				);
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_SE_BSETI:
+			bit = 0x80000000 >> oper1->imm;
+			ei0 = il.Or(4, il.Register(4, oper0->reg), il.Const(4, bit));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_SLWI:
-			REQUIRE3OPS
-			ei0 = il.Const(4, oper2->imm);           // amt: shift amount
-			ei1 = il.Register(4, oper1->reg);        //  rS: reg to be shifted
-			ei0 = il.ShiftLeft(4, ei1, ei0);         // (rS << amt)
-			ei0 = il.SetRegister(4, oper0->reg, ei0, // rD = (rs << amt)
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
+		case VLE_INS_SE_BTSTI:
+			/* cr0 gets gt if the bit is set, eq otherwise */
+			ei0 = il.LogicalShiftRight(4, il.Register(4, oper0->reg), il.Const(4, 31 - oper1->imm));
+			ei0 = il.And(4, ei0, il.Const(4, 1), IL_FLAGWRITE_CR0_S);
 			il.AddInstruction(ei0);
 			break;
 
-		case PPC_INS_SRWI:
-			REQUIRE3OPS
-			ei0 = il.Const(4, oper2->imm);           // amt: shift amount
-			ei1 = il.Register(4, oper1->reg);        //  rS: reg to be shifted
-			ei0 = il.LogicalShiftRight(4, ei1, ei0);        // (rS << amt)
-			ei0 = il.SetRegister(4, oper0->reg, ei0, // rD = (rs << amt)
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_SRWI:
+			ei0 = il.LogicalShiftRight(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_CLRLWI:
-			REQUIRE3OPS
-			ei0 = il.Const(4, (uint32_t) (0xffffffff >> oper2->imm));
-			ei1 = il.Register(4, oper1->reg);
-			ei0 = il.And(4, ei1, ei0);
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_SRAWI:
+			ei0 = il.ArithShiftRight(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm), IL_FLAGWRITE_XER_CA);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_ROTLWI:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.RotateLeft(4, ei0, il.Const(4, oper2->imm));
-			ei0 = il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			);
-			il.AddInstruction(ei0);
+		case VLE_INS_SE_SLWI:
+			ei0 = il.ShiftLeft(4, il.Register(4, oper0->reg), il.Const(4, oper1->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_ROTLW:
-		case PPC_INS_RLWNM:
-			REQUIRE3OPS
-			{
-				uint32_t mask = 0xffffffff;
-				if (insn->id == PPC_INS_RLWNM)
-				{
-					REQUIRE5OPS
-					mask = genMask(oper3->imm, oper4->imm);
-				}
-				ei0 = il.Register(4, oper1->reg);
-				ei1 = il.Register(4, oper2->reg);
-				ei1 = il.And(4, ei1, il.Const(4, 0x1f));
-				ei0 = il.RotateLeft(4, ei0, ei1);
-				if (mask != 0xffffffff)
-					ei0 = il.And(4, ei0, il.Const(4, mask));
-				ei0 = il.SetRegister(4, oper0->reg, ei0,
-						ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-				);
-				il.AddInstruction(ei0);
-			}
+		case VLE_INS_E_SRWI:
+			ei0 = il.LogicalShiftRight(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
+		case VLE_INS_E_SLWI:
+			ei0 = il.ShiftLeft(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
+			break;
 
-		case PPC_INS_SLW:
-		case PPC_INS_SRW:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			// permit bit 26 to survive to enable clearing the whole register
-			ei1 = il.And(4, il.Register(4, oper2->reg), il.Const(4, 0x3f));
-			if (insn->id == PPC_INS_SLW)
-				ei0 = il.ShiftLeft(4, ei0, ei1);
-			else
-				ei0 = il.LogicalShiftRight(4, ei0, ei1);
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+		case VLE_INS_E_RLWI:
+			ei0 = il.RotateLeft(4, il.Register(4, oper1->reg), il.Const(4, oper2->imm));
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_SRAW:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
+		case VLE_INS_E_RLW:
 			ei1 = il.And(4, il.Register(4, oper2->reg), il.Const(4, 0x1f));
-			ei0 = il.ArithShiftRight(4, ei0, ei1, IL_FLAGWRITE_XER_CA);
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+			ei0 = il.RotateLeft(4, il.Register(4, oper1->reg), ei1);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0, flags));
 			break;
 
-		case PPC_INS_SRAWI:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.ArithShiftRight(4, ei0, il.Const(4, oper2->imm), IL_FLAGWRITE_XER_CA);
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+		case VLE_INS_E_RLWINM:
+			ei0 = RotateAndMask(il, oper1->reg, oper2->imm, oper3->imm, oper4->imm);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_MULLW:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.Mult(4, ei0, il.Register(4, oper2->reg));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+		case VLE_INS_E_RLWIMI:
+			ei0 = RotateAndInsert(il, oper0->reg, oper1->reg, oper2->imm, oper3->imm, oper4->imm);
+			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
 			break;
 
-		case PPC_INS_MULLI:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.Mult(4, ei0, il.Const(4, oper2->imm));
+		/* se_ loads and stores take rX as is, the e_ forms use (rA|0) */
+		case VLE_INS_SE_LBZ:
+		case VLE_INS_SE_LHZ:
+		case VLE_INS_SE_LWZ:
+		case VLE_INS_E_LBZ:
+		case VLE_INS_E_LHZ:
+		case VLE_INS_E_LHA:
+		case VLE_INS_E_LWZ:
+		case VLE_INS_E_LBZU:
+		case VLE_INS_E_LHZU:
+		case VLE_INS_E_LHAU:
+		case VLE_INS_E_LWZU:
+			switch (insn->id)
+			{
+				case VLE_INS_SE_LBZ: case VLE_INS_E_LBZ: case VLE_INS_E_LBZU: size = 1; break;
+				case VLE_INS_SE_LWZ: case VLE_INS_E_LWZ: case VLE_INS_E_LWZU: size = 4; break;
+				default: size = 2;
+			}
+
+			if (insn->size == 2 || oper1->mem.base != PPC_REG_R0)
+				ei0 = il.Register(4, oper1->mem.base);
+			else
+				ei0 = il.Const(4, 0);
+			ei0 = il.Load(size, il.Add(4, ei0, il.Const(4, oper1->mem.disp)));
+
+			if (insn->id == VLE_INS_E_LHA || insn->id == VLE_INS_E_LHAU)
+				ei0 = il.SignExtend(4, ei0);
+			else if (size < 4)
+				ei0 = il.ZeroExtend(4, ei0);
 			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0));
-			break;
 
-		case PPC_INS_MULHW:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.MultDoublePrecSigned(4, ei0, il.Register(4, oper2->reg));
-			ei0 = il.LowPart(4, il.LogicalShiftRight(8, ei0, il.Const(1, 32)));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+			// if update, rA is set to effective address (d(rA))
+			if (insn->id == VLE_INS_E_LBZU || insn->id == VLE_INS_E_LHZU ||
+			  insn->id == VLE_INS_E_LHAU || insn->id == VLE_INS_E_LWZU)
+			{
+				ei0 = il.Add(4, il.Register(4, oper1->mem.base), il.Const(4, oper1->mem.disp));
+				il.AddInstruction(il.SetRegister(4, oper1->mem.base, ei0));
+			}
 			break;
 
-		case PPC_INS_MULHWU:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.MultDoublePrecUnsigned(4, ei0, il.Register(4, oper2->reg));
-			ei0 = il.LowPart(4, il.LogicalShiftRight(8, ei0, il.Const(1, 32)));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
-			break;
+		case VLE_INS_SE_STB:
+		case VLE_INS_SE_STH:
+		case VLE_INS_SE_STW:
+		case VLE_INS_E_STB:
+		case VLE_INS_E_STH:
+		case VLE_INS_E_STW:
+		case VLE_INS_E_STBU:
+		case VLE_INS_E_STHU:
+		case VLE_INS_E_STWU:
+			switch (insn->id)
+			{
+				case VLE_INS_SE_STB: case VLE_INS_E_STB: case VLE_INS_E_STBU: size = 1; break;
+				case VLE_INS_SE_STW: case VLE_INS_E_STW: case VLE_INS_E_STWU: size = 4; break;
+				default: size = 2;
+			}
 
-		case PPC_INS_DIVW:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.DivSigned(4, ei0, il.Register(4, oper2->reg));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+			if (insn->size == 2 || oper1->mem.base != PPC_REG_R0)
+				ei0 = il.Register(4, oper1->mem.base);
+			else
+				ei0 = il.Const(4, 0);
+			ei0 = il.Add(4, ei0, il.Const(4, oper1->mem.disp));
+
+			ei1 = il.Register(4, oper0->reg);
+			if (size < 4)
+				ei1 = il.LowPart(size, ei1);
+			il.AddInstruction(il.Store(size, ei0, ei1));
+
+			// if update, then rA gets updated address
+			if (insn->id == VLE_INS_E_STBU || insn->id == VLE_INS_E_STHU || insn->id == VLE_INS_E_STWU)
+			{
+				ei0 = il.Add(4, il.Register(4, oper1->mem.base), il.Const(4, oper1->mem.disp));
+				il.AddInstruction(il.SetRegister(4, oper1->mem.base, ei0));
+			}
 			break;
 
-		case PPC_INS_DIVWU:
-			REQUIRE3OPS
-			ei0 = il.Register(4, oper1->reg);
-			ei0 = il.DivUnsigned(4, ei0, il.Register(4, oper2->reg));
-			il.AddInstruction(il.SetRegister(4, oper0->reg, ei0,
-					ppc->update_cr0 ? IL_FLAGWRITE_CR0_S : 0
-			));
+		case VLE_INS_E_LMW:
+		case VLE_INS_E_STMW:
+			ei0 = (oper1->mem.base == PPC_REG_R0) ? il.Const(4, 0) : il.Register(4, oper1->mem.base);
+			ei0 = il.Add(4, ei0, il.Const(4, oper1->mem.disp));
+			LiftMultipleWord(il, insn->id == VLE_INS_E_LMW, oper0->reg, ei0);
 			break;
 
-		case PPC_INS_MR: /* move register */
-			REQUIRE2OPS
-			il.AddInstruction(il.SetRegister(4, oper0->reg, operToIL(il, oper1)));
+		case VLE_INS_E_MCRF:
+			for (i = 0; i < 4; i++)
+			{
+				ei0 = il.Flag((oper1->reg - PPC_REG_CR0) * 4 + i);
+				il.AddInstruction(il.SetFlag((oper0->reg - PPC_REG_CR0) * 4 + i, ei0));
+			}
 			break;
 
-		case PPC_INS_SC:
-			il.AddInstruction(il.SystemCall());
+		case VLE_INS_E_CRAND:
+		case VLE_INS_E_CRANDC:
+		case VLE_INS_E_CRNAND:
+		case VLE_INS_E_CROR:
+		case VLE_INS_E_CRORC:
+		case VLE_INS_E_CRNOR:
+		case VLE_INS_E_CREQV:
+		case VLE_INS_E_CRXOR:
+			ei0 = il.Flag(oper1->crbit);
+			ei1 = il.Flag(oper2->crbit);
+			if (insn->id == VLE_INS_E_CRANDC || insn->id == VLE_INS_E_CRORC)
+				ei1 = il.Not(0, ei1);
+			switch (insn->id)
+			{
+				case VLE_INS_E_CRAND: case VLE_INS_E_CRANDC: case VLE_INS_E_CRNAND:
+					ei0 = il.And(0, ei0, ei1);
+					break;
+				case VLE_INS_E_CROR: case VLE_INS_E_CRORC: case VLE_INS_E_CRNOR:
+					ei0 = il.Or(0, ei0, ei1);
+					break;
+				default:
+					ei0 = il.Xor(0, ei0, ei1);
+					break;
+			}
+			if (insn->id == VLE_INS_E_CRNAND || insn->id == VLE_INS_E_CRNOR || insn->id == VLE_INS_E_CREQV)
+				ei0 = il.Not(0, ei0);
+			il.AddInstruction(il.SetFlag(oper0->crbit, ei0));
 			break;
 
-		case PPC_INS_RFI:
-			il.AddInstruction(il.Return(il.Unimplemented()));
-			break;
-
-		case PPC_INS_TRAP:
-			il.AddInstruction(il.Trap(0));
-			break;
-
-		case PPC_INS_BCL:
-		case PPC_INS_BCLR:
-		case PPC_INS_BCLRL:
-		case PPC_INS_CNTLZD:
-		case PPC_INS_CNTLZW:
-		case PPC_INS_DCBA:
-		case PPC_INS_DCBF:
-		case PPC_INS_DCBI:
-		case PPC_INS_DCBST:
-		case PPC_INS_DCBT:
-		case PPC_INS_DCBTST:
-		case PPC_INS_DCBZ:
-		case PPC_INS_DCBZL:
-		case PPC_INS_DCCCI:
-		case PPC_INS_DIVD:
-		case PPC_INS_DIVDU:
-		case PPC_INS_DSS:
-		case PPC_INS_DSSALL:
-		case PPC_INS_DST:
-		case PPC_INS_DSTST:
-		case PPC_INS_DSTSTT:
-		case PPC_INS_DSTT:
-		case PPC_INS_EIEIO:
-		case PPC_INS_EVABS:
-		case PPC_INS_EVADDIW:
-		case PPC_INS_EVADDSMIAAW:
-		case PPC_INS_EVADDSSIAAW:
-		case PPC_INS_EVADDUMIAAW:
-		case PPC_INS_EVADDUSIAAW:
-		case PPC_INS_EVADDW:
-		case PPC_INS_EVAND:
-		case PPC_INS_EVANDC:
-		case PPC_INS_EVCMPEQ:
-		case PPC_INS_EVCMPGTS:
-		case PPC_INS_EVCMPGTU:
-		case PPC_INS_EVCMPLTS:
-		case PPC_INS_EVCMPLTU:
-		case PPC_INS_EVCNTLSW:
-		case PPC_INS_EVCNTLZW:
-		case PPC_INS_EVDIVWS:
-		case PPC_INS_EVDIVWU:
-		case PPC_INS_EVEQV:
-		case PPC_INS_EVEXTSB:
-		case PPC_INS_EVEXTSH:
-		case PPC_INS_EVLDD:
-		case PPC_INS_EVLDDX:
-		case PPC_INS_EVLDH:
-		case PPC_INS_EVLDHX:
-		case PPC_INS_EVLDW:
-		case PPC_INS_EVLDWX:
-		case PPC_INS_EVLHHESPLAT:
-		case PPC_INS_EVLHHESPLATX:
-		case PPC_INS_EVLHHOSSPLAT:
-		case PPC_INS_EVLHHOSSPLATX:
-		case PPC_INS_EVLHHOUSPLAT:
-		case PPC_INS_EVLHHOUSPLATX:
-		case PPC_INS_EVLWHE:
-		case PPC_INS_EVLWHEX:
-		case PPC_INS_EVLWHOS:
-		case PPC_INS_EVLWHOSX:
-		case PPC_INS_EVLWHOU:
-		case PPC_INS_EVLWHOUX:
-		case PPC_INS_EVLWHSPLAT:
-		case PPC_INS_EVLWHSPLATX:
-		case PPC_INS_EVLWWSPLAT:
-		case PPC_INS_EVLWWSPLATX:
-		case PPC_INS_EVMERGEHI:
-		case PPC_INS_EVMERGEHILO:
-		case PPC_INS_EVMERGELO:
-		case PPC_INS_EVMERGELOHI:
-		case PPC_INS_EVMHEGSMFAA:
-		case PPC_INS_EVMHEGSMFAN:
-		case PPC_INS_EVMHEGSMIAA:
-		case PPC_INS_EVMHEGSMIAN:
-		case PPC_INS_EVMHEGUMIAA:
-		case PPC_INS_EVMHEGUMIAN:
-		case PPC_INS_EVMHESMF:
-		case PPC_INS_EVMHESMFA:
-		case PPC_INS_EVMHESMFAAW:
-		case PPC_INS_EVMHESMFANW:
-		case PPC_INS_EVMHESMI:
-		case PPC_INS_EVMHESMIA:
-		case PPC_INS_EVMHESMIAAW:
-		case PPC_INS_EVMHESMIANW:
-		case PPC_INS_EVMHESSF:
-		case PPC_INS_EVMHESSFA:
-		case PPC_INS_EVMHESSFAAW:
-		case PPC_INS_EVMHESSFANW:
-		case PPC_INS_EVMHESSIAAW:
-		case PPC_INS_EVMHESSIANW:
-		case PPC_INS_EVMHEUMI:
-		case PPC_INS_EVMHEUMIA:
-		case PPC_INS_EVMHEUMIAAW:
-		case PPC_INS_EVMHEUMIANW:
-		case PPC_INS_EVMHEUSIAAW:
-		case PPC_INS_EVMHEUSIANW:
-		case PPC_INS_EVMHOGSMFAA:
-		case PPC_INS_EVMHOGSMFAN:
-		case PPC_INS_EVMHOGSMIAA:
-		case PPC_INS_EVMHOGSMIAN:
-		case PPC_INS_EVMHOGUMIAA:
-		case PPC_INS_EVMHOGUMIAN:
-		case PPC_INS_EVMHOSMF:
-		case PPC_INS_EVMHOSMFA:
-		case PPC_INS_EVMHOSMFAAW:
-		case PPC_INS_EVMHOSMFANW:
-		case PPC_INS_EVMHOSMI:
-		case PPC_INS_EVMHOSMIA:
-		case PPC_INS_EVMHOSMIAAW:
-		case PPC_INS_EVMHOSMIANW:
-		case PPC_INS_EVMHOSSF:
-		case PPC_INS_EVMHOSSFA:
-		case PPC_INS_EVMHOSSFAAW:
-		case PPC_INS_EVMHOSSFANW:
-		case PPC_INS_EVMHOSSIAAW:
-		case PPC_INS_EVMHOSSIANW:
-		case PPC_INS_EVMHOUMI:
-		case PPC_INS_EVMHOUMIA:
-		case PPC_INS_EVMHOUMIAAW:
-		case PPC_INS_EVMHOUMIANW:
-		case PPC_INS_EVMHOUSIAAW:
-		case PPC_INS_EVMHOUSIANW:
-		case PPC_INS_EVMRA:
-		case PPC_INS_EVMWHSMF:
-		case PPC_INS_EVMWHSMFA:
-		case PPC_INS_EVMWHSMI:
-		case PPC_INS_EVMWHSMIA:
-		case PPC_INS_EVMWHSSF:
-		case PPC_INS_EVMWHSSFA:
-		case PPC_INS_EVMWHUMI:
-		case PPC_INS_EVMWHUMIA:
-		case PPC_INS_EVMWLSMIAAW:
-		case PPC_INS_EVMWLSMIANW:
-		case PPC_INS_EVMWLSSIAAW:
-		case PPC_INS_EVMWLSSIANW:
-		case PPC_INS_EVMWLUMI:
-		case PPC_INS_EVMWLUMIA:
-		case PPC_INS_EVMWLUMIAAW:
-		case PPC_INS_EVMWLUMIANW:
-		case PPC_INS_EVMWLUSIAAW:
-		case PPC_INS_EVMWLUSIANW:
-		case PPC_INS_EVMWSMF:
-		case PPC_INS_EVMWSMFA:
-		case PPC_INS_EVMWSMFAA:
-		case PPC_INS_EVMWSMFAN:
-		case PPC_INS_EVMWSMI:
-		case PPC_INS_EVMWSMIA:
-		case PPC_INS_EVMWSMIAA:
-		case PPC_INS_EVMWSMIAN:
-		case PPC_INS_EVMWSSF:
-		case PPC_INS_EVMWSSFA:
-		case PPC_INS_EVMWSSFAA:
-		case PPC_INS_EVMWSSFAN:
-		case PPC_INS_EVMWUMI:
-		case PPC_INS_EVMWUMIA:
-		case PPC_INS_EVMWUMIAA:
-		case PPC_INS_EVMWUMIAN:
-		case PPC_INS_EVNAND:
-		case PPC_INS_EVNEG:
-		case PPC_INS_EVNOR:
-		case PPC_INS_EVOR:
-		case PPC_INS_EVORC:
-		case PPC_INS_EVRLW:
-		case PPC_INS_EVRLWI:
-		case PPC_INS_EVRNDW:
-		case PPC_INS_EVSLW:
-		case PPC_INS_EVSLWI:
-		case PPC_INS_EVSPLATFI:
-		case PPC_INS_EVSPLATI:
-		case PPC_INS_EVSRWIS:
-		case PPC_INS_EVSRWIU:
-		case PPC_INS_EVSRWS:
-		case PPC_INS_EVSRWU:
-		case PPC_INS_EVSTDD:
-		case PPC_INS_EVSTDDX:
-		case PPC_INS_EVSTDH:
-		case PPC_INS_EVSTDHX:
-		case PPC_INS_EVSTDW:
-		case PPC_INS_EVSTDWX:
-		case PPC_INS_EVSTWHE:
-		case PPC_INS_EVSTWHEX:
-		case PPC_INS_EVSTWHO:
-		case PPC_INS_EVSTWHOX:
-		case PPC_INS_EVSTWWE:
-		case PPC_INS_EVSTWWEX:
-		case PPC_INS_EVSTWWO:
-		case PPC_INS_EVSTWWOX:
-		case PPC_INS_EVSUBFSMIAAW:
-		case PPC_INS_EVSUBFSSIAAW:
-		case PPC_INS_EVSUBFUMIAAW:
-		case PPC_INS_EVSUBFUSIAAW:
-		case PPC_INS_EVSUBFW:
-		case PPC_INS_EVSUBIFW:
-		case PPC_INS_EVXOR:
-		case PPC_INS_EXTSW:
-		case PPC_INS_FABS:
-		case PPC_INS_FADD:
-		case PPC_INS_FADDS:
-		case PPC_INS_FCFID:
-		case PPC_INS_FCFIDS:
-		case PPC_INS_FCFIDU:
-		case PPC_INS_FCFIDUS:
-		case PPC_INS_FCPSGN:
-		case PPC_INS_FCTID:
-		case PPC_INS_FCTIDUZ:
-		case PPC_INS_FCTIDZ:
-		case PPC_INS_FCTIW:
-		case PPC_INS_FCTIWUZ:
-		case PPC_INS_FCTIWZ:
-		case PPC_INS_FDIV:
-		case PPC_INS_FDIVS:
-		case PPC_INS_FMADD:
-		case PPC_INS_FMADDS:
-		case PPC_INS_FMR:
-		case PPC_INS_FMSUB:
-		case PPC_INS_FMSUBS:
-		case PPC_INS_FMUL:
-		case PPC_INS_FMULS:
-		case PPC_INS_FNABS:
-		case PPC_INS_FNEG:
-		case PPC_INS_FNMADD:
-		case PPC_INS_FNMADDS:
-		case PPC_INS_FNMSUB:
-		case PPC_INS_FNMSUBS:
-		case PPC_INS_FRE:
-		case PPC_INS_FRES:
-		case PPC_INS_FRIM:
-		case PPC_INS_FRIN:
-		case PPC_INS_FRIP:
-		case PPC_INS_FRIZ:
-		case PPC_INS_FRSP:
-		case PPC_INS_FRSQRTE:
-		case PPC_INS_FRSQRTES:
-		case PPC_INS_FSEL:
-		case PPC_INS_FSQRT:
-		case PPC_INS_FSQRTS:
-		case PPC_INS_FSUB:
-		case PPC_INS_FSUBS:
-		case PPC_INS_ICBI:
-		case PPC_INS_ICCCI:
-		case PPC_INS_ISYNC:
-		case PPC_INS_LD:
-		case PPC_INS_LDARX:
-		case PPC_INS_LDBRX:
-		case PPC_INS_LDU:
-		case PPC_INS_LDUX:
-		case PPC_INS_LDX:
-		case PPC_INS_LFD:
-		case PPC_INS_LFDU:
-		case PPC_INS_LFDUX:
-		case PPC_INS_LFDX:
-		case PPC_INS_LFIWAX:
-		case PPC_INS_LFIWZX:
-		case PPC_INS_LFS:
-		case PPC_INS_LFSU:
-		case PPC_INS_LFSUX:
-		case PPC_INS_LFSX:
-		case PPC_INS_LSWI:
-		case PPC_INS_LVEBX:
-		case PPC_INS_LVEHX:
-		case PPC_INS_LVEWX:
-		case PPC_INS_LVSL:
-		case PPC_INS_LVSR:
-		case PPC_INS_LVX:
-		case PPC_INS_LVXL:
-		case PPC_INS_LWA:
-		case PPC_INS_LWARX:
-		case PPC_INS_LWAUX:
-		case PPC_INS_LWAX:
-		case PPC_INS_LXSDX:
-		case PPC_INS_LXVD2X:
-		case PPC_INS_LXVDSX:
-		case PPC_INS_LXVW4X:
-		case PPC_INS_MBAR:
-		case PPC_INS_MCRF:
-		case PPC_INS_MFDCR:
-		case PPC_INS_MFFS:
-		case PPC_INS_MFMSR:
-		case PPC_INS_MFOCRF:
-		case PPC_INS_MFSPR:
-		case PPC_INS_MFSR:
-		case PPC_INS_MFSRIN:
-		case PPC_INS_MFTB:
-		case PPC_INS_MFVSCR:
-		case PPC_INS_MSYNC:
-		case PPC_INS_MTDCR:
-		case PPC_INS_MTFSB0:
-		case PPC_INS_MTFSB1:
-		case PPC_INS_MTFSF:
-		case PPC_INS_MTMSR:
-		case PPC_INS_MTMSRD:
-		case PPC_INS_MTOCRF:
-		case PPC_INS_MTSPR:
-		case PPC_INS_MTSR:
-		case PPC_INS_MTSRIN:
-		case PPC_INS_MTVSCR:
-		case PPC_INS_MULHD:
-		case PPC_INS_MULHDU:
-		case PPC_INS_MULLD:
-		case PPC_INS_POPCNTD:
-		case PPC_INS_POPCNTW:
-		case PPC_INS_RFCI:
-		case PPC_INS_RFDI:
-		case PPC_INS_RFID:
-		case PPC_INS_RFMCI:
-		case PPC_INS_RLDCL:
-		case PPC_INS_RLDCR:
-		case PPC_INS_RLDIC:
-		case PPC_INS_RLDICL:
-		case PPC_INS_RLDICR:
-		case PPC_INS_RLDIMI:
-		case PPC_INS_SLBIA:
-		case PPC_INS_SLBIE:
-		case PPC_INS_SLBMFEE:
-		case PPC_INS_SLBMTE:
-		case PPC_INS_SLD:
-		case PPC_INS_SRAD:
-		case PPC_INS_SRADI:
-		case PPC_INS_SRD:
-		case PPC_INS_STD:
-		case PPC_INS_STDBRX:
-		case PPC_INS_STDCX:
-		case PPC_INS_STDU:
-		case PPC_INS_STDUX:
-		case PPC_INS_STDX:
-		case PPC_INS_STFD:
-		case PPC_INS_STFDU:
-		case PPC_INS_STFDUX:
-		case PPC_INS_STFDX:
-		case PPC_INS_STFIWX:
-		case PPC_INS_STFS:
-		case PPC_INS_STFSU:
-		case PPC_INS_STFSUX:
-		case PPC_INS_STFSX:
-		case PPC_INS_STSWI:
-		case PPC_INS_STVEBX:
-		case PPC_INS_STVEHX:
-		case PPC_INS_STVEWX:
-		case PPC_INS_STVX:
-		case PPC_INS_STVXL:
-		case PPC_INS_STWCX:
-		case PPC_INS_STXSDX:
-		case PPC_INS_STXVD2X:
-		case PPC_INS_STXVW4X:
-		case PPC_INS_SYNC:
-		case PPC_INS_TD:
-		case PPC_INS_TDI:
-		case PPC_INS_TLBIA:
-		case PPC_INS_TLBIE:
-		case PPC_INS_TLBIEL:
-		case PPC_INS_TLBIVAX:
-		case PPC_INS_TLBLD:
-		case PPC_INS_TLBLI:
-		case PPC_INS_TLBRE:
-		case PPC_INS_TLBSX:
-		case PPC_INS_TLBSYNC:
-		case PPC_INS_TLBWE:
-		case PPC_INS_TW:
-		case PPC_INS_TWI:
-		case PPC_INS_VADDCUW:
-		case PPC_INS_VADDFP:
-		case PPC_INS_VADDSBS:
-		case PPC_INS_VADDSHS:
-		case PPC_INS_VADDSWS:
-		case PPC_INS_VADDUBM:
-		case PPC_INS_VADDUBS:
-		case PPC_INS_VADDUHM:
-		case PPC_INS_VADDUHS:
-		case PPC_INS_VADDUWM:
-		case PPC_INS_VADDUWS:
-		case PPC_INS_VAND:
-		case PPC_INS_VANDC:
-		case PPC_INS_VAVGSB:
-		case PPC_INS_VAVGSH:
-		case PPC_INS_VAVGSW:
-		case PPC_INS_VAVGUB:
-		case PPC_INS_VAVGUH:
-		case PPC_INS_VAVGUW:
-		case PPC_INS_VCFSX:
-		case PPC_INS_VCFUX:
-		case PPC_INS_VCMPBFP:
-		case PPC_INS_VCMPEQFP:
-		case PPC_INS_VCMPEQUB:
-		case PPC_INS_VCMPEQUH:
-		case PPC_INS_VCMPEQUW:
-		case PPC_INS_VCMPGEFP:
-		case PPC_INS_VCMPGTFP:
-		case PPC_INS_VCMPGTSB:
-		case PPC_INS_VCMPGTSH:
-		case PPC_INS_VCMPGTSW:
-		case PPC_INS_VCMPGTUB:
-		case PPC_INS_VCMPGTUH:
-		case PPC_INS_VCMPGTUW:
-		case PPC_INS_VCTSXS:
-		case PPC_INS_VCTUXS:
-		case PPC_INS_VEXPTEFP:
-		case PPC_INS_VLOGEFP:
-		case PPC_INS_VMADDFP:
-		case PPC_INS_VMAXFP:
-		case PPC_INS_VMAXSB:
-		case PPC_INS_VMAXSH:
-		case PPC_INS_VMAXSW:
-		case PPC_INS_VMAXUB:
-		case PPC_INS_VMAXUH:
-		case PPC_INS_VMAXUW:
-		case PPC_INS_VMHADDSHS:
-		case PPC_INS_VMHRADDSHS:
-		case PPC_INS_VMINFP:
-		case PPC_INS_VMINSB:
-		case PPC_INS_VMINSH:
-		case PPC_INS_VMINSW:
-		case PPC_INS_VMINUB:
-		case PPC_INS_VMINUH:
-		case PPC_INS_VMINUW:
-		case PPC_INS_VMLADDUHM:
-		case PPC_INS_VMRGHB:
-		case PPC_INS_VMRGHH:
-		case PPC_INS_VMRGHW:
-		case PPC_INS_VMRGLB:
-		case PPC_INS_VMRGLH:
-		case PPC_INS_VMRGLW:
-		case PPC_INS_VMSUMMBM:
-		case PPC_INS_VMSUMSHM:
-		case PPC_INS_VMSUMSHS:
-		case PPC_INS_VMSUMUBM:
-		case PPC_INS_VMSUMUHM:
-		case PPC_INS_VMSUMUHS:
-		case PPC_INS_VMULESB:
-		case PPC_INS_VMULESH:
-		case PPC_INS_VMULEUB:
-		case PPC_INS_VMULEUH:
-		case PPC_INS_VMULOSB:
-		case PPC_INS_VMULOSH:
-		case PPC_INS_VMULOUB:
-		case PPC_INS_VMULOUH:
-		case PPC_INS_VNMSUBFP:
-		case PPC_INS_VNOR:
-		case PPC_INS_VOR:
-		case PPC_INS_VPERM:
-		case PPC_INS_VPKPX:
-		case PPC_INS_VPKSHSS:
-		case PPC_INS_VPKSHUS:
-		case PPC_INS_VPKSWSS:
-		case PPC_INS_VPKSWUS:
-		case PPC_INS_VPKUHUM:
-		case PPC_INS_VPKUHUS:
-		case PPC_INS_VPKUWUM:
-		case PPC_INS_VPKUWUS:
-		case PPC_INS_VREFP:
-		case PPC_INS_VRFIM:
-		case PPC_INS_VRFIN:
-		case PPC_INS_VRFIP:
-		case PPC_INS_VRFIZ:
-		case PPC_INS_VRLB:
-		case PPC_INS_VRLH:
-		case PPC_INS_VRLW:
-		case PPC_INS_VRSQRTEFP:
-		case PPC_INS_VSEL:
-		case PPC_INS_VSL:
-		case PPC_INS_VSLB:
-		case PPC_INS_VSLDOI:
-		case PPC_INS_VSLH:
-		case PPC_INS_VSLO:
-		case PPC_INS_VSLW:
-		case PPC_INS_VSPLTB:
-		case PPC_INS_VSPLTH:
-		case PPC_INS_VSPLTISB:
-		case PPC_INS_VSPLTISH:
-		case PPC_INS_VSPLTISW:
-		case PPC_INS_VSPLTW:
-		case PPC_INS_VSR:
-		case PPC_INS_VSRAB:
-		case PPC_INS_VSRAH:
-		case PPC_INS_VSRAW:
-		case PPC_INS_VSRB:
-		case PPC_INS_VSRH:
-		case PPC_INS_VSRO:
-		case PPC_INS_VSRW:
-		case PPC_INS_VSUBCUW:
-		case PPC_INS_VSUBFP:
-		case PPC_INS_VSUBSBS:
-		case PPC_INS_VSUBSHS:
-		case PPC_INS_VSUBSWS:
-		case PPC_INS_VSUBUBM:
-		case PPC_INS_VSUBUBS:
-		case PPC_INS_VSUBUHM:
-		case PPC_INS_VSUBUHS:
-		case PPC_INS_VSUBUWM:
-		case PPC_INS_VSUBUWS:
-		case PPC_INS_VSUM2SWS:
-		case PPC_INS_VSUM4SBS:
-		case PPC_INS_VSUM4SHS:
-		case PPC_INS_VSUM4UBS:
-		case PPC_INS_VSUMSWS:
-		case PPC_INS_VUPKHPX:
-		case PPC_INS_VUPKHSB:
-		case PPC_INS_VUPKHSH:
-		case PPC_INS_VUPKLPX:
-		case PPC_INS_VUPKLSB:
-		case PPC_INS_VUPKLSH:
-		case PPC_INS_VXOR:
-		case PPC_INS_WAIT:
-		case PPC_INS_WRTEE:
-		case PPC_INS_WRTEEI:
-		case PPC_INS_XSABSDP:
-		case PPC_INS_XSADDDP:
-		case PPC_INS_XSCMPODP:
-		case PPC_INS_XSCMPUDP:
-		case PPC_INS_XSCPSGNDP:
-		case PPC_INS_XSCVDPSP:
-		case PPC_INS_XSCVDPSXDS:
-		case PPC_INS_XSCVDPSXWS:
-		case PPC_INS_XSCVDPUXDS:
-		case PPC_INS_XSCVDPUXWS:
-		case PPC_INS_XSCVSPDP:
-		case PPC_INS_XSCVSXDDP:
-		case PPC_INS_XSCVUXDDP:
-		case PPC_INS_XSDIVDP:
-		case PPC_INS_XSMADDADP:
-		case PPC_INS_XSMADDMDP:
-		case PPC_INS_XSMAXDP:
-		case PPC_INS_XSMINDP:
-		case PPC_INS_XSMSUBADP:
-		case PPC_INS_XSMSUBMDP:
-		case PPC_INS_XSMULDP:
-		case PPC_INS_XSNABSDP:
-		case PPC_INS_XSNEGDP:
-		case PPC_INS_XSNMADDADP:
-		case PPC_INS_XSNMADDMDP:
-		case PPC_INS_XSNMSUBADP:
-		case PPC_INS_XSNMSUBMDP:
-		case PPC_INS_XSRDPI:
-		case PPC_INS_XSRDPIC:
-		case PPC_INS_XSRDPIM:
-		case PPC_INS_XSRDPIP:
-		case PPC_INS_XSRDPIZ:
-		case PPC_INS_XSREDP:
-		case PPC_INS_XSRSQRTEDP:
-		case PPC_INS_XSSQRTDP:
-		case PPC_INS_XSSUBDP:
-		case PPC_INS_XSTDIVDP:
-		case PPC_INS_XSTSQRTDP:
-		case PPC_INS_XVABSDP:
-		case PPC_INS_XVABSSP:
-		case PPC_INS_XVADDDP:
-		case PPC_INS_XVADDSP:
-		case PPC_INS_XVCMPEQDP:
-		case PPC_INS_XVCMPEQSP:
-		case PPC_INS_XVCMPGEDP:
-		case PPC_INS_XVCMPGESP:
-		case PPC_INS_XVCMPGTDP:
-		case PPC_INS_XVCMPGTSP:
-		case PPC_INS_XVCPSGNDP:
-		case PPC_INS_XVCPSGNSP:
-		case PPC_INS_XVCVDPSP:
-		case PPC_INS_XVCVDPSXDS:
-		case PPC_INS_XVCVDPSXWS:
-		case PPC_INS_XVCVDPUXDS:
-		case PPC_INS_XVCVDPUXWS:
-		case PPC_INS_XVCVSPDP:
-		case PPC_INS_XVCVSPSXDS:
-		case PPC_INS_XVCVSPSXWS:
-		case PPC_INS_XVCVSPUXDS:
-		case PPC_INS_XVCVSPUXWS:
-		case PPC_INS_XVCVSXDDP:
-		case PPC_INS_XVCVSXDSP:
-		case PPC_INS_XVCVSXWDP:
-		case PPC_INS_XVCVSXWSP:
-		case PPC_INS_XVCVUXDDP:
-		case PPC_INS_XVCVUXDSP:
-		case PPC_INS_XVCVUXWDP:
-		case PPC_INS_XVCVUXWSP:
-		case PPC_INS_XVDIVDP:
-		case PPC_INS_XVDIVSP:
-		case PPC_INS_XVMADDADP:
-		case PPC_INS_XVMADDASP:
-		case PPC_INS_XVMADDMDP:
-		case PPC_INS_XVMADDMSP:
-		case PPC_INS_XVMAXDP:
-		case PPC_INS_XVMAXSP:
-		case PPC_INS_XVMINDP:
-		case PPC_INS_XVMINSP:
-		case PPC_INS_XVMSUBADP:
-		case PPC_INS_XVMSUBASP:
-		case PPC_INS_XVMSUBMDP:
-		case PPC_INS_XVMSUBMSP:
-		case PPC_INS_XVMULDP:
-		case PPC_INS_XVMULSP:
-		case PPC_INS_XVNABSDP:
-		case PPC_INS_XVNABSSP:
-		case PPC_INS_XVNEGDP:
-		case PPC_INS_XVNEGSP:
-		case PPC_INS_XVNMADDADP:
-		case PPC_INS_XVNMADDASP:
-		case PPC_INS_XVNMADDMDP:
-		case PPC_INS_XVNMADDMSP:
-		case PPC_INS_XVNMSUBADP:
-		case PPC_INS_XVNMSUBASP:
-		case PPC_INS_XVNMSUBMDP:
-		case PPC_INS_XVNMSUBMSP:
-		case PPC_INS_XVRDPI:
-		case PPC_INS_XVRDPIC:
-		case PPC_INS_XVRDPIM:
-		case PPC_INS_XVRDPIP:
-		case PPC_INS_XVRDPIZ:
-		case PPC_INS_XVREDP:
-		case PPC_INS_XVRESP:
-		case PPC_INS_XVRSPI:
-		case PPC_INS_XVRSPIC:
-		case PPC_INS_XVRSPIM:
-		case PPC_INS_XVRSPIP:
-		case PPC_INS_XVRSPIZ:
-		case PPC_INS_XVRSQRTEDP:
-		case PPC_INS_XVRSQRTESP:
-		case PPC_INS_XVSQRTDP:
-		case PPC_INS_XVSQRTSP:
-		case PPC_INS_XVSUBDP:
-		case PPC_INS_XVSUBSP:
-		case PPC_INS_XVTDIVDP:
-		case PPC_INS_XVTDIVSP:
-		case PPC_INS_XVTSQRTDP:
-		case PPC_INS_XVTSQRTSP:
-		case PPC_INS_XXLAND:
-		case PPC_INS_XXLANDC:
-		case PPC_INS_XXLNOR:
-		case PPC_INS_XXLOR:
-		case PPC_INS_XXLXOR:
-		case PPC_INS_XXMRGHW:
-		case PPC_INS_XXMRGLW:
-		case PPC_INS_XXPERMDI:
-		case PPC_INS_XXSEL:
-		case PPC_INS_XXSLDWI:
-		case PPC_INS_XXSPLTW:
-		case PPC_INS_BCA:
-		case PPC_INS_BCLA:
-		case PPC_INS_SLDI:
-		case PPC_INS_BTA:
-		case PPC_INS_MFBR0:
-		case PPC_INS_MFBR1:
-		case PPC_INS_MFBR2:
-		case PPC_INS_MFBR3:
-		case PPC_INS_MFBR4:
-		case PPC_INS_MFBR5:
-		case PPC_INS_MFBR6:
-		case PPC_INS_MFBR7:
-		case PPC_INS_MFXER:
-		case PPC_INS_MFRTCU:
-		case PPC_INS_MFRTCL:
-		case PPC_INS_MFDSCR:
-		case PPC_INS_MFDSISR:
-		case PPC_INS_MFDAR:
-		case PPC_INS_MFSRR2:
-		case PPC_INS_MFSRR3:
-		case PPC_INS_MFCFAR:
-		case PPC_INS_MFAMR:
-		case PPC_INS_MFPID:
-		case PPC_INS_MFTBLO:
-		case PPC_INS_MFTBHI:
-		case PPC_INS_MFDBATU:
-		case PPC_INS_MFDBATL:
-		case PPC_INS_MFIBATU:
-		case PPC_INS_MFIBATL:
-		case PPC_INS_MFDCCR:
-		case PPC_INS_MFICCR:
-		case PPC_INS_MFDEAR:
-		case PPC_INS_MFESR:
-		case PPC_INS_MFSPEFSCR:
-		case PPC_INS_MFTCR:
-		case PPC_INS_MFASR:
-		case PPC_INS_MFPVR:
-		case PPC_INS_MFTBU:
-		case PPC_INS_MTCR:
-		case PPC_INS_MTBR0:
-		case PPC_INS_MTBR1:
-		case PPC_INS_MTBR2:
-		case PPC_INS_MTBR3:
-		case PPC_INS_MTBR4:
-		case PPC_INS_MTBR5:
-		case PPC_INS_MTBR6:
-		case PPC_INS_MTBR7:
-		case PPC_INS_MTXER:
-		case PPC_INS_MTDSCR:
-		case PPC_INS_MTDSISR:
-		case PPC_INS_MTDAR:
-		case PPC_INS_MTSRR2:
-		case PPC_INS_MTSRR3:
-		case PPC_INS_MTCFAR:
-		case PPC_INS_MTAMR:
-		case PPC_INS_MTPID:
-		case PPC_INS_MTTBL:
-		case PPC_INS_MTTBU:
-		case PPC_INS_MTTBLO:
-		case PPC_INS_MTTBHI:
-		case PPC_INS_MTDBATU:
-		case PPC_INS_MTDBATL:
-		case PPC_INS_MTIBATU:
-		case PPC_INS_MTIBATL:
-		case PPC_INS_MTDCCR:
-		case PPC_INS_MTICCR:
-		case PPC_INS_MTDEAR:
-		case PPC_INS_MTESR:
-		case PPC_INS_MTSPEFSCR:
-		case PPC_INS_MTTCR:
-		case PPC_INS_ROTLD:
-		case PPC_INS_ROTLDI:
-		case PPC_INS_CLRLDI:
-		case PPC_INS_SUB:
-		case PPC_INS_SUBC:
-		case PPC_INS_LWSYNC:
-		case PPC_INS_PTESYNC:
-		case PPC_INS_TDLT:
-		case PPC_INS_TDEQ:
-		case PPC_INS_TDGT:
-		case PPC_INS_TDNE:
-		case PPC_INS_TDLLT:
-		case PPC_INS_TDLGT:
-		case PPC_INS_TDU:
-		case PPC_INS_TDLTI:
-		case PPC_INS_TDEQI:
-		case PPC_INS_TDGTI:
-		case PPC_INS_TDNEI:
-		case PPC_INS_TDLLTI:
-		case PPC_INS_TDLGTI:
-		case PPC_INS_TDUI:
-		case PPC_INS_TLBREHI:
-		case PPC_INS_TLBRELO:
-		case PPC_INS_TLBWEHI:
-		case PPC_INS_TLBWELO:
-		case PPC_INS_TWLT:
-		case PPC_INS_TWEQ:
-		case PPC_INS_TWGT:
-		case PPC_INS_TWNE:
-		case PPC_INS_TWLLT:
-		case PPC_INS_TWLGT:
-		case PPC_INS_TWU:
-		case PPC_INS_TWLTI:
-		case PPC_INS_TWEQI:
-		case PPC_INS_TWGTI:
-		case PPC_INS_TWNEI:
-		case PPC_INS_TWLLTI:
-		case PPC_INS_TWLGTI:
-		case PPC_INS_TWUI:
-		case PPC_INS_WAITRSV:
-		case PPC_INS_WAITIMPL:
-		case PPC_INS_XNOP:
-		case PPC_INS_XVMOVDP:
-		case PPC_INS_XVMOVSP:
-		case PPC_INS_XXSPLTD:
-		case PPC_INS_XXMRGHD:
-		case PPC_INS_XXMRGLD:
-		case PPC_INS_XXSWAPD:
-		case PPC_INS_BT:
-		case PPC_INS_BF:
-		case PPC_INS_BDNZT:
-		case PPC_INS_BDNZF:
-		case PPC_INS_BDZF:
-		case PPC_INS_BDZT:
-		case PPC_INS_BFA:
-		case PPC_INS_BDNZTA:
-		case PPC_INS_BDNZFA:
-		case PPC_INS_BDZTA:
-		case PPC_INS_BDZFA:
-		case PPC_INS_BTCTR:
-		case PPC_INS_BFCTR:
-		case PPC_INS_BTCTRL:
-		case PPC_INS_BFCTRL:
-		case PPC_INS_BTL:
-		case PPC_INS_BFL:
-		case PPC_INS_BDNZTL:
-		case PPC_INS_BDNZFL:
-		case PPC_INS_BDZTL:
-		case PPC_INS_BDZFL:
-		case PPC_INS_BTLA:
-		case PPC_INS_BFLA:
-		case PPC_INS_BDNZTLA:
-		case PPC_INS_BDNZFLA:
-		case PPC_INS_BDZTLA:
-		case PPC_INS_BDZFLA:
-		case PPC_INS_BTLR:
-		case PPC_INS_BFLR:
-		case PPC_INS_BDNZTLR:
-		case PPC_INS_BDZTLR:
-		case PPC_INS_BDZFLR:
-		case PPC_INS_BTLRL:
-		case PPC_INS_BFLRL:
-		case PPC_INS_BDNZTLRL:
-		case PPC_INS_BDNZFLRL:
-		case PPC_INS_BDZTLRL:
-		case PPC_INS_BDZFLRL:
-		case PPC_INS_BRINC:
-
-		ReturnUnimpl:
 		default:
-			MYLOG("%s:%s() returning Unimplemented(...) on:\n",
-			  __FILE__, __func__);
-
-			MYLOG("    %08llx: %02X %02X %02X %02X %s %s\n",
-			  addr, data[0], data[1], data[2], data[3],
-			  res->insn.mnemonic, res->insn.op_str);
+			MYLOG("%s:%s() returning Unimplemented(...) on %08x\n",
+			  __FILE__, __func__, insn->insword);
 
 			il.AddInstruction(il.Unimplemented());
 	}
 
 	return rc;
 }
-
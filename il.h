@@ -172,5 +172,540 @@ if a==b then c=0b001 (not setting SO, setting EQ)
 #define IL_FLAGGROUP_CR7_EQ (70 + 4)
 #define IL_FLAGGROUP_CR7_NE (70 + 5)
 
+/* the whole field as a 4-bit value, lt in bit 3 down to so in bit 0, as
+ * mfcr places it; add the field number times 10 like the groups above */
+#define IL_FLAGGROUP_CR0_FIELD (0 + 6)
 
-bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction& il, const uint8_t *data, uint64_t addr, decomp_result *res, bool le);
+/* registers capstone has no id for */
+#define PPC_REG_FPSCR (PPC_REG_ENDING + 2)
+#define PPC_REG_ACC (PPC_REG_ENDING + 3) /* SPE accumulator */
+#define PPC_REG_R0_UPPER (PPC_REG_ENDING + 4) /* SPE upper halves, r0h-r31h */
+#define PPC_REG_R31_UPPER (PPC_REG_R0_UPPER + 31)
+#define PPC_REG_MSR (PPC_REG_R31_UPPER + 1)
+#define PPC_REG_SPR0 (PPC_REG_R31_UPPER + 2) /* one per SPR number, spr0-spr1023 */
+#define PPC_REG_SPR1023 (PPC_REG_SPR0 + 1023)
+
+/* SPRs that go by a name, X(number, name). lr, ctr and vrsave are capstone
+ * registers and the tbl/tbu write numbers (284/285) share the read ones. */
+#define PPC_SPRS(X) \
+	X(1, "xer") \
+	X(18, "dsisr") \
+	X(19, "dar") \
+	X(22, "dec") \
+	X(25, "sdr1") \
+	X(26, "srr0") \
+	X(27, "srr1") \
+	X(48, "pid") \
+	X(54, "decar") \
+	X(58, "csrr0") \
+	X(59, "csrr1") \
+	X(61, "dear") \
+	X(62, "esr") \
+	X(63, "ivpr") \
+	X(268, "tbl") \
+	X(269, "tbu") \
+	X(272, "sprg0") \
+	X(273, "sprg1") \
+	X(274, "sprg2") \
+	X(275, "sprg3") \
+	X(276, "sprg4") \
+	X(277, "sprg5") \
+	X(278, "sprg6") \
+	X(279, "sprg7") \
+	X(282, "ear") \
+	X(286, "pir") \
+	X(287, "pvr") \
+	X(304, "dbsr") \
+	X(308, "dbcr0") \
+	X(309, "dbcr1") \
+	X(310, "dbcr2") \
+	X(336, "tsr") \
+	X(340, "tcr") \
+	X(400, "ivor0") \
+	X(401, "ivor1") \
+	X(402, "ivor2") \
+	X(403, "ivor3") \
+	X(404, "ivor4") \
+	X(405, "ivor5") \
+	X(406, "ivor6") \
+	X(407, "ivor7") \
+	X(408, "ivor8") \
+	X(409, "ivor9") \
+	X(410, "ivor10") \
+	X(411, "ivor11") \
+	X(412, "ivor12") \
+	X(413, "ivor13") \
+	X(414, "ivor14") \
+	X(415, "ivor15") \
+	X(512, "spefscr") \
+	X(528, "ibat0u") \
+	X(529, "ibat0l") \
+	X(530, "ibat1u") \
+	X(531, "ibat1l") \
+	X(532, "ibat2u") \
+	X(533, "ibat2l") \
+	X(534, "ibat3u") \
+	X(535, "ibat3l") \
+	X(536, "dbat0u") \
+	X(537, "dbat0l") \
+	X(538, "dbat1u") \
+	X(539, "dbat1l") \
+	X(540, "dbat2u") \
+	X(541, "dbat2l") \
+	X(542, "dbat3u") \
+	X(543, "dbat3l") \
+	X(570, "mcsrr0") \
+	X(571, "mcsrr1") \
+	X(574, "dsrr0") \
+	X(575, "dsrr1") \
+	X(624, "mas0") \
+	X(625, "mas1") \
+	X(626, "mas2") \
+	X(627, "mas3") \
+	X(628, "mas4") \
+	X(630, "mas6") \
+	X(688, "tlb0cfg") \
+	X(689, "tlb1cfg") \
+	X(912, "gqr0") \
+	X(913, "gqr1") \
+	X(914, "gqr2") \
+	X(915, "gqr3") \
+	X(916, "gqr4") \
+	X(917, "gqr5") \
+	X(918, "gqr6") \
+	X(919, "gqr7") \
+	X(920, "hid2") \
+	X(944, "mas7") \
+	X(976, "dmiss") \
+	X(977, "dcmp") \
+	X(978, "hash1") \
+	X(979, "hash2") \
+	X(980, "imiss") \
+	X(981, "icmp") \
+	X(982, "rpa") \
+	X(1008, "hid0") \
+	X(1009, "hid1") \
+	X(1010, "iabr") \
+	X(1011, "hid4") \
+	X(1013, "dabr") \
+	X(1017, "l2cr") \
+	X(1019, "ictc") \
+	X(1020, "thrm1") \
+	X(1021, "thrm2") \
+	X(1022, "thrm3")
+
+/* intrinsics, for what has no compact LLIL equivalent */
+#define PPC_INTRIN_BSWAP16 1
+#define PPC_INTRIN_BSWAP32 2
+#define PPC_INTRIN_BSWAP64 3
+#define PPC_INTRIN_XXPERMR 4 /* decoded by hand, no capstone id */
+
+/* AltiVec and VSX, one intrinsic per instruction that has no plain LLIL
+ * equivalent: X(capstone id, name, inputs, output) where v is a vector, d a
+ * double (the first doubleword of a VSX register), b/h/w a 1/2/4 byte integer,
+ * i an immediate and 0 no output. Upper case V/D reads the target register
+ * itself, for the accumulating forms. The element loads and stores take the
+ * effective address along so the element position stays visible. */
+#define VMX_INTRINSICS(X) \
+	X(VADDCUW, "vaddcuw", "vv", 'v') \
+	X(VADDFP, "vaddfp", "vv", 'v') \
+	X(VADDSBS, "vaddsbs", "vv", 'v') \
+	X(VADDSHS, "vaddshs", "vv", 'v') \
+	X(VADDSWS, "vaddsws", "vv", 'v') \
+	X(VADDUBM, "vaddubm", "vv", 'v') \
+	X(VADDUBS, "vaddubs", "vv", 'v') \
+	X(VADDUHM, "vadduhm", "vv", 'v') \
+	X(VADDUHS, "vadduhs", "vv", 'v') \
+	X(VADDUWM, "vadduwm", "vv", 'v') \
+	X(VADDUWS, "vadduws", "vv", 'v') \
+	X(VAVGSB, "vavgsb", "vv", 'v') \
+	X(VAVGSH, "vavgsh", "vv", 'v') \
+	X(VAVGSW, "vavgsw", "vv", 'v') \
+	X(VAVGUB, "vavgub", "vv", 'v') \
+	X(VAVGUH, "vavguh", "vv", 'v') \
+	X(VAVGUW, "vavguw", "vv", 'v') \
+	X(VCMPBFP, "vcmpbfp", "vv", 'v') \
+	X(VCMPEQFP, "vcmpeqfp", "vv", 'v') \
+	X(VCMPEQUB, "vcmpequb", "vv", 'v') \
+	X(VCMPEQUH, "vcmpequh", "vv", 'v') \
+	X(VCMPEQUW, "vcmpequw", "vv", 'v') \
+	X(VCMPGEFP, "vcmpgefp", "vv", 'v') \
+	X(VCMPGTFP, "vcmpgtfp", "vv", 'v') \
+	X(VCMPGTSB, "vcmpgtsb", "vv", 'v') \
+	X(VCMPGTSH, "vcmpgtsh", "vv", 'v') \
+	X(VCMPGTSW, "vcmpgtsw", "vv", 'v') \
+	X(VCMPGTUB, "vcmpgtub", "vv", 'v') \
+	X(VCMPGTUH, "vcmpgtuh", "vv", 'v') \
+	X(VCMPGTUW, "vcmpgtuw", "vv", 'v') \
+	X(VMAXFP, "vmaxfp", "vv", 'v') \
+	X(VMAXSB, "vmaxsb", "vv", 'v') \
+	X(VMAXSH, "vmaxsh", "vv", 'v') \
+	X(VMAXSW, "vmaxsw", "vv", 'v') \
+	X(VMAXUB, "vmaxub", "vv", 'v') \
+	X(VMAXUH, "vmaxuh", "vv", 'v') \
+	X(VMAXUW, "vmaxuw", "vv", 'v') \
+	X(VMINFP, "vminfp", "vv", 'v') \
+	X(VMINSB, "vminsb", "vv", 'v') \
+	X(VMINSH, "vminsh", "vv", 'v') \
+	X(VMINSW, "vminsw", "vv", 'v') \
+	X(VMINUB, "vminub", "vv", 'v') \
+	X(VMINUH, "vminuh", "vv", 'v') \
+	X(VMINUW, "vminuw", "vv", 'v') \
+	X(VMRGHB, "vmrghb", "vv", 'v') \
+	X(VMRGHH, "vmrghh", "vv", 'v') \
+	X(VMRGHW, "vmrghw", "vv", 'v') \
+	X(VMRGLB, "vmrglb", "vv", 'v') \
+	X(VMRGLH, "vmrglh", "vv", 'v') \
+	X(VMRGLW, "vmrglw", "vv", 'v') \
+	X(VMULESB, "vmulesb", "vv", 'v') \
+	X(VMULESH, "vmulesh", "vv", 'v') \
+	X(VMULEUB, "vmuleub", "vv", 'v') \
+	X(VMULEUH, "vmuleuh", "vv", 'v') \
+	X(VMULOSB, "vmulosb", "vv", 'v') \
+	X(VMULOSH, "vmulosh", "vv", 'v') \
+	X(VMULOUB, "vmuloub", "vv", 'v') \
+	X(VMULOUH, "vmulouh", "vv", 'v') \
+	X(VPKPX, "vpkpx", "vv", 'v') \
+	X(VPKSHSS, "vpkshss", "vv", 'v') \
+	X(VPKSHUS, "vpkshus", "vv", 'v') \
+	X(VPKSWSS, "vpkswss", "vv", 'v') \
+	X(VPKSWUS, "vpkswus", "vv", 'v') \
+	X(VPKUHUM, "vpkuhum", "vv", 'v') \
+	X(VPKUHUS, "vpkuhus", "vv", 'v') \
+	X(VPKUWUM, "vpkuwum", "vv", 'v') \
+	X(VPKUWUS, "vpkuwus", "vv", 'v') \
+	X(VRLB, "vrlb", "vv", 'v') \
+	X(VRLH, "vrlh", "vv", 'v') \
+	X(VRLW, "vrlw", "vv", 'v') \
+	X(VSL, "vsl", "vv", 'v') \
+	X(VSLB, "vslb", "vv", 'v') \
+	X(VSLH, "vslh", "vv", 'v') \
+	X(VSLO, "vslo", "vv", 'v') \
+	X(VSLW, "vslw", "vv", 'v') \
+	X(VSR, "vsr", "vv", 'v') \
+	X(VSRAB, "vsrab", "vv", 'v') \
+	X(VSRAH, "vsrah", "vv", 'v') \
+	X(VSRAW, "vsraw", "vv", 'v') \
+	X(VSRB, "vsrb", "vv", 'v') \
+	X(VSRH, "vsrh", "vv", 'v') \
+	X(VSRO, "vsro", "vv", 'v') \
+	X(VSRW, "vsrw", "vv", 'v') \
+	X(VSUBCUW, "vsubcuw", "vv", 'v') \
+	X(VSUBFP, "vsubfp", "vv", 'v') \
+	X(VSUBSBS, "vsubsbs", "vv", 'v') \
+	X(VSUBSHS, "vsubshs", "vv", 'v') \
+	X(VSUBSWS, "vsubsws", "vv", 'v') \
+	X(VSUBUBM, "vsububm", "vv", 'v') \
+	X(VSUBUBS, "vsububs", "vv", 'v') \
+	X(VSUBUHM, "vsubuhm", "vv", 'v') \
+	X(VSUBUHS, "vsubuhs", "vv", 'v') \
+	X(VSUBUWM, "vsubuwm", "vv", 'v') \
+	X(VSUBUWS, "vsubuws", "vv", 'v') \
+	X(VSUM2SWS, "vsum2sws", "vv", 'v') \
+	X(VSUM4SBS, "vsum4sbs", "vv", 'v') \
+	X(VSUM4SHS, "vsum4shs", "vv", 'v') \
+	X(VSUM4UBS, "vsum4ubs", "vv", 'v') \
+	X(VSUMSWS, "vsumsws", "vv", 'v') \
+	X(VMADDFP, "vmaddfp", "vvv", 'v') \
+	X(VMHADDSHS, "vmhaddshs", "vvv", 'v') \
+	X(VMHRADDSHS, "vmhraddshs", "vvv", 'v') \
+	X(VMLADDUHM, "vmladduhm", "vvv", 'v') \
+	X(VMSUMMBM, "vmsummbm", "vvv", 'v') \
+	X(VMSUMSHM, "vmsumshm", "vvv", 'v') \
+	X(VMSUMSHS, "vmsumshs", "vvv", 'v') \
+	X(VMSUMUBM, "vmsumubm", "vvv", 'v') \
+	X(VMSUMUHM, "vmsumuhm", "vvv", 'v') \
+	X(VMSUMUHS, "vmsumuhs", "vvv", 'v') \
+	X(VNMSUBFP, "vnmsubfp", "vvv", 'v') \
+	X(VPERM, "vperm", "vvv", 'v') \
+	X(VSEL, "vsel", "vvv", 'v') \
+	X(VSLDOI, "vsldoi", "vvi", 'v') \
+	X(VCFSX, "vcfsx", "vi", 'v') \
+	X(VCFUX, "vcfux", "vi", 'v') \
+	X(VCTSXS, "vctsxs", "vi", 'v') \
+	X(VCTUXS, "vctuxs", "vi", 'v') \
+	X(VSPLTB, "vspltb", "vi", 'v') \
+	X(VSPLTH, "vsplth", "vi", 'v') \
+	X(VSPLTW, "vspltw", "vi", 'v') \
+	X(VSPLTISB, "vspltisb", "i", 'v') \
+	X(VSPLTISH, "vspltish", "i", 'v') \
+	X(VSPLTISW, "vspltisw", "i", 'v') \
+	X(VEXPTEFP, "vexptefp", "v", 'v') \
+	X(VLOGEFP, "vlogefp", "v", 'v') \
+	X(VREFP, "vrefp", "v", 'v') \
+	X(VRFIM, "vrfim", "v", 'v') \
+	X(VRFIN, "vrfin", "v", 'v') \
+	X(VRFIP, "vrfip", "v", 'v') \
+	X(VRFIZ, "vrfiz", "v", 'v') \
+	X(VRSQRTEFP, "vrsqrtefp", "v", 'v') \
+	X(VUPKHPX, "vupkhpx", "v", 'v') \
+	X(VUPKHSB, "vupkhsb", "v", 'v') \
+	X(VUPKHSH, "vupkhsh", "v", 'v') \
+	X(VUPKLPX, "vupklpx", "v", 'v') \
+	X(VUPKLSB, "vupklsb", "v", 'v') \
+	X(VUPKLSH, "vupklsh", "v", 'v') \
+	X(LVEBX, "lvebx", "bw", 'v') \
+	X(LVEHX, "lvehx", "hw", 'v') \
+	X(LVEWX, "lvewx", "ww", 'v') \
+	X(LVSL, "lvsl", "w", 'v') \
+	X(LVSR, "lvsr", "w", 'v') \
+	X(STVEBX, "stvebx", "vw", 'b') \
+	X(STVEHX, "stvehx", "vw", 'h') \
+	X(STVEWX, "stvewx", "vw", 'w') \
+	X(MFVSCR, "mfvscr", "", 'v') \
+	X(MTVSCR, "mtvscr", "v", 0)
+
+#define VSX_INTRINSICS(X) \
+	X(XVADDDP, "xvadddp", "vv", 'v') \
+	X(XVADDSP, "xvaddsp", "vv", 'v') \
+	X(XVSUBDP, "xvsubdp", "vv", 'v') \
+	X(XVSUBSP, "xvsubsp", "vv", 'v') \
+	X(XVMULDP, "xvmuldp", "vv", 'v') \
+	X(XVMULSP, "xvmulsp", "vv", 'v') \
+	X(XVDIVDP, "xvdivdp", "vv", 'v') \
+	X(XVDIVSP, "xvdivsp", "vv", 'v') \
+	X(XVMAXDP, "xvmaxdp", "vv", 'v') \
+	X(XVMAXSP, "xvmaxsp", "vv", 'v') \
+	X(XVMINDP, "xvmindp", "vv", 'v') \
+	X(XVMINSP, "xvminsp", "vv", 'v') \
+	X(XVCPSGNDP, "xvcpsgndp", "vv", 'v') \
+	X(XVCPSGNSP, "xvcpsgnsp", "vv", 'v') \
+	X(XVCMPEQDP, "xvcmpeqdp", "vv", 'v') \
+	X(XVCMPEQSP, "xvcmpeqsp", "vv", 'v') \
+	X(XVCMPGEDP, "xvcmpgedp", "vv", 'v') \
+	X(XVCMPGESP, "xvcmpgesp", "vv", 'v') \
+	X(XVCMPGTDP, "xvcmpgtdp", "vv", 'v') \
+	X(XVCMPGTSP, "xvcmpgtsp", "vv", 'v') \
+	X(XXMRGHW, "xxmrghw", "vv", 'v') \
+	X(XXMRGLW, "xxmrglw", "vv", 'v') \
+	X(XVABSDP, "xvabsdp", "v", 'v') \
+	X(XVABSSP, "xvabssp", "v", 'v') \
+	X(XVNABSDP, "xvnabsdp", "v", 'v') \
+	X(XVNABSSP, "xvnabssp", "v", 'v') \
+	X(XVNEGDP, "xvnegdp", "v", 'v') \
+	X(XVNEGSP, "xvnegsp", "v", 'v') \
+	X(XVSQRTDP, "xvsqrtdp", "v", 'v') \
+	X(XVSQRTSP, "xvsqrtsp", "v", 'v') \
+	X(XVREDP, "xvredp", "v", 'v') \
+	X(XVRESP, "xvresp", "v", 'v') \
+	X(XVRSQRTEDP, "xvrsqrtedp", "v", 'v') \
+	X(XVRSQRTESP, "xvrsqrtesp", "v", 'v') \
+	X(XVRDPI, "xvrdpi", "v", 'v') \
+	X(XVRDPIC, "xvrdpic", "v", 'v') \
+	X(XVRDPIM, "xvrdpim", "v", 'v') \
+	X(XVRDPIP, "xvrdpip", "v", 'v') \
+	X(XVRDPIZ, "xvrdpiz", "v", 'v') \
+	X(XVRSPI, "xvrspi", "v", 'v') \
+	X(XVRSPIC, "xvrspic", "v", 'v') \
+	X(XVRSPIM, "xvrspim", "v", 'v') \
+	X(XVRSPIP, "xvrspip", "v", 'v') \
+	X(XVRSPIZ, "xvrspiz", "v", 'v') \
+	X(XVCVDPSP, "xvcvdpsp", "v", 'v') \
+	X(XVCVDPSXDS, "xvcvdpsxds", "v", 'v') \
+	X(XVCVDPSXWS, "xvcvdpsxws", "v", 'v') \
+	X(XVCVDPUXDS, "xvcvdpuxds", "v", 'v') \
+	X(XVCVDPUXWS, "xvcvdpuxws", "v", 'v') \
+	X(XVCVSPDP, "xvcvspdp", "v", 'v') \
+	X(XVCVSPSXDS, "xvcvspsxds", "v", 'v') \
+	X(XVCVSPSXWS, "xvcvspsxws", "v", 'v') \
+	X(XVCVSPUXDS, "xvcvspuxds", "v", 'v') \
+	X(XVCVSPUXWS, "xvcvspuxws", "v", 'v') \
+	X(XVCVSXDDP, "xvcvsxddp", "v", 'v') \
+	X(XVCVSXDSP, "xvcvsxdsp", "v", 'v') \
+	X(XVCVSXWDP, "xvcvsxwdp", "v", 'v') \
+	X(XVCVSXWSP, "xvcvsxwsp", "v", 'v') \
+	X(XVCVUXDDP, "xvcvuxddp", "v", 'v') \
+	X(XVCVUXDSP, "xvcvuxdsp", "v", 'v') \
+	X(XVCVUXWDP, "xvcvuxwdp", "v", 'v') \
+	X(XVCVUXWSP, "xvcvuxwsp", "v", 'v') \
+	X(XVMADDADP, "xvmaddadp", "Vvv", 'v') \
+	X(XVMADDASP, "xvmaddasp", "Vvv", 'v') \
+	X(XVMADDMDP, "xvmaddmdp", "Vvv", 'v') \
+	X(XVMADDMSP, "xvmaddmsp", "Vvv", 'v') \
+	X(XVMSUBADP, "xvmsubadp", "Vvv", 'v') \
+	X(XVMSUBASP, "xvmsubasp", "Vvv", 'v') \
+	X(XVMSUBMDP, "xvmsubmdp", "Vvv", 'v') \
+	X(XVMSUBMSP, "xvmsubmsp", "Vvv", 'v') \
+	X(XVNMADDADP, "xvnmaddadp", "Vvv", 'v') \
+	X(XVNMADDASP, "xvnmaddasp", "Vvv", 'v') \
+	X(XVNMADDMDP, "xvnmaddmdp", "Vvv", 'v') \
+	X(XVNMADDMSP, "xvnmaddmsp", "Vvv", 'v') \
+	X(XVNMSUBADP, "xvnmsubadp", "Vvv", 'v') \
+	X(XVNMSUBASP, "xvnmsubasp", "Vvv", 'v') \
+	X(XVNMSUBMDP, "xvnmsubmdp", "Vvv", 'v') \
+	X(XVNMSUBMSP, "xvnmsubmsp", "Vvv", 'v') \
+	X(XXSEL, "xxsel", "vvv", 'v') \
+	X(XXSLDWI, "xxsldwi", "vvi", 'v') \
+	X(XXSPLTW, "xxspltw", "vi", 'v') \
+	X(XSADDDP, "xsadddp", "dd", 'd') \
+	X(XSSUBDP, "xssubdp", "dd", 'd') \
+	X(XSMULDP, "xsmuldp", "dd", 'd') \
+	X(XSDIVDP, "xsdivdp", "dd", 'd') \
+	X(XSMAXDP, "xsmaxdp", "dd", 'd') \
+	X(XSMINDP, "xsmindp", "dd", 'd') \
+	X(XSCPSGNDP, "xscpsgndp", "dd", 'd') \
+	X(XSABSDP, "xsabsdp", "d", 'd') \
+	X(XSNABSDP, "xsnabsdp", "d", 'd') \
+	X(XSNEGDP, "xsnegdp", "d", 'd') \
+	X(XSSQRTDP, "xssqrtdp", "d", 'd') \
+	X(XSREDP, "xsredp", "d", 'd') \
+	X(XSRSQRTEDP, "xsrsqrtedp", "d", 'd') \
+	X(XSRDPI, "xsrdpi", "d", 'd') \
+	X(XSRDPIC, "xsrdpic", "d", 'd') \
+	X(XSRDPIM, "xsrdpim", "d", 'd') \
+	X(XSRDPIP, "xsrdpip", "d", 'd') \
+	X(XSRDPIZ, "xsrdpiz", "d", 'd') \
+	X(XSCVDPSP, "xscvdpsp", "d", 'd') \
+	X(XSCVSPDP, "xscvspdp", "d", 'd') \
+	X(XSCVDPSXDS, "xscvdpsxds", "d", 'd') \
+	X(XSCVDPSXWS, "xscvdpsxws", "d", 'd') \
+	X(XSCVDPUXDS, "xscvdpuxds", "d", 'd') \
+	X(XSCVDPUXWS, "xscvdpuxws", "d", 'd') \
+	X(XSCVSXDDP, "xscvsxddp", "d", 'd') \
+	X(XSCVUXDDP, "xscvuxddp", "d", 'd') \
+	X(XSMADDADP, "xsmaddadp", "Ddd", 'd') \
+	X(XSMADDMDP, "xsmaddmdp", "Ddd", 'd') \
+	X(XSMSUBADP, "xsmsubadp", "Ddd", 'd') \
+	X(XSMSUBMDP, "xsmsubmdp", "Ddd", 'd') \
+	X(XSNMADDADP, "xsnmaddadp", "Ddd", 'd') \
+	X(XSNMADDMDP, "xsnmaddmdp", "Ddd", 'd') \
+	X(XSNMSUBADP, "xsnmsubadp", "Ddd", 'd') \
+	X(XSNMSUBMDP, "xsnmsubmdp", "Ddd", 'd')
+
+#define VECTOR_INTRINSICS(X) \
+	VMX_INTRINSICS(X) \
+	VSX_INTRINSICS(X)
+
+enum ppc_vector_intrinsic {
+	PPC_INTRIN_VECTOR_BASE = 0x100 - 1,
+	#define VECTOR_ENUM(id, name, inputs, output) PPC_INTRIN_##id,
+	VECTOR_INTRINSICS(VECTOR_ENUM)
+	#undef VECTOR_ENUM
+	PPC_INTRIN_VECTOR_END
+};
+
+/* SPE, one intrinsic per instruction that has no plain LLIL equivalent:
+ * X(capstone id, name, inputs, output) where e is a 64 bit GPR, passed as its
+ * upper and lower half, and a the accumulator. Output E writes the
+ * accumulator along with the GPR. */
+#define SPE_INTRINSICS(X) \
+	X(EVABS, "evabs", "e", 'e') \
+	X(EVADDSMIAAW, "evaddsmiaaw", "ea", 'E') \
+	X(EVADDSSIAAW, "evaddssiaaw", "ea", 'E') \
+	X(EVADDUMIAAW, "evaddumiaaw", "ea", 'E') \
+	X(EVADDUSIAAW, "evaddusiaaw", "ea", 'E') \
+	X(EVCNTLSW, "evcntlsw", "e", 'e') \
+	X(EVCNTLZW, "evcntlzw", "e", 'e') \
+	X(EVDIVWS, "evdivws", "ee", 'e') \
+	X(EVDIVWU, "evdivwu", "ee", 'e') \
+	X(EVMHEGSMFAA, "evmhegsmfaa", "eea", 'E') \
+	X(EVMHEGSMFAN, "evmhegsmfan", "eea", 'E') \
+	X(EVMHEGSMIAA, "evmhegsmiaa", "eea", 'E') \
+	X(EVMHEGSMIAN, "evmhegsmian", "eea", 'E') \
+	X(EVMHEGUMIAA, "evmhegumiaa", "eea", 'E') \
+	X(EVMHEGUMIAN, "evmhegumian", "eea", 'E') \
+	X(EVMHESMF, "evmhesmf", "ee", 'e') \
+	X(EVMHESMFA, "evmhesmfa", "ee", 'E') \
+	X(EVMHESMFAAW, "evmhesmfaaw", "eea", 'E') \
+	X(EVMHESMFANW, "evmhesmfanw", "eea", 'E') \
+	X(EVMHESMI, "evmhesmi", "ee", 'e') \
+	X(EVMHESMIA, "evmhesmia", "ee", 'E') \
+	X(EVMHESMIAAW, "evmhesmiaaw", "eea", 'E') \
+	X(EVMHESMIANW, "evmhesmianw", "eea", 'E') \
+	X(EVMHESSF, "evmhessf", "ee", 'e') \
+	X(EVMHESSFA, "evmhessfa", "ee", 'E') \
+	X(EVMHESSFAAW, "evmhessfaaw", "eea", 'E') \
+	X(EVMHESSFANW, "evmhessfanw", "eea", 'E') \
+	X(EVMHESSIAAW, "evmhessiaaw", "eea", 'E') \
+	X(EVMHESSIANW, "evmhessianw", "eea", 'E') \
+	X(EVMHEUMI, "evmheumi", "ee", 'e') \
+	X(EVMHEUMIA, "evmheumia", "ee", 'E') \
+	X(EVMHEUMIAAW, "evmheumiaaw", "eea", 'E') \
+	X(EVMHEUMIANW, "evmheumianw", "eea", 'E') \
+	X(EVMHEUSIAAW, "evmheusiaaw", "eea", 'E') \
+	X(EVMHEUSIANW, "evmheusianw", "eea", 'E') \
+	X(EVMHOGSMFAA, "evmhogsmfaa", "eea", 'E') \
+	X(EVMHOGSMFAN, "evmhogsmfan", "eea", 'E') \
+	X(EVMHOGSMIAA, "evmhogsmiaa", "eea", 'E') \
+	X(EVMHOGSMIAN, "evmhogsmian", "eea", 'E') \
+	X(EVMHOGUMIAA, "evmhogumiaa", "eea", 'E') \
+	X(EVMHOGUMIAN, "evmhogumian", "eea", 'E') \
+	X(EVMHOSMF, "evmhosmf", "ee", 'e') \
+	X(EVMHOSMFA, "evmhosmfa", "ee", 'E') \
+	X(EVMHOSMFAAW, "evmhosmfaaw", "eea", 'E') \
+	X(EVMHOSMFANW, "evmhosmfanw", "eea", 'E') \
+	X(EVMHOSMI, "evmhosmi", "ee", 'e') \
+	X(EVMHOSMIA, "evmhosmia", "ee", 'E') \
+	X(EVMHOSMIAAW, "evmhosmiaaw", "eea", 'E') \
+	X(EVMHOSMIANW, "evmhosmianw", "eea", 'E') \
+	X(EVMHOSSF, "evmhossf", "ee", 'e') \
+	X(EVMHOSSFA, "evmhossfa", "ee", 'E') \
+	X(EVMHOSSFAAW, "evmhossfaaw", "eea", 'E') \
+	X(EVMHOSSFANW, "evmhossfanw", "eea", 'E') \
+	X(EVMHOSSIAAW, "evmhossiaaw", "eea", 'E') \
+	X(EVMHOSSIANW, "evmhossianw", "eea", 'E') \
+	X(EVMHOUMI, "evmhoumi", "ee", 'e') \
+	X(EVMHOUMIA, "evmhoumia", "ee", 'E') \
+	X(EVMHOUMIAAW, "evmhoumiaaw", "eea", 'E') \
+	X(EVMHOUMIANW, "evmhoumianw", "eea", 'E') \
+	X(EVMHOUSIAAW, "evmhousiaaw", "eea", 'E') \
+	X(EVMHOUSIANW, "evmhousianw", "eea", 'E') \
+	X(EVMWHSMF, "evmwhsmf", "ee", 'e') \
+	X(EVMWHSMFA, "evmwhsmfa", "ee", 'E') \
+	X(EVMWHSMI, "evmwhsmi", "ee", 'e') \
+	X(EVMWHSMIA, "evmwhsmia", "ee", 'E') \
+	X(EVMWHSSF, "evmwhssf", "ee", 'e') \
+	X(EVMWHSSFA, "evmwhssfa", "ee", 'E') \
+	X(EVMWHUMI, "evmwhumi", "ee", 'e') \
+	X(EVMWHUMIA, "evmwhumia", "ee", 'E') \
+	X(EVMWLSMIAAW, "evmwlsmiaaw", "eea", 'E') \
+	X(EVMWLSMIANW, "evmwlsmianw", "eea", 'E') \
+	X(EVMWLSSIAAW, "evmwlssiaaw", "eea", 'E') \
+	X(EVMWLSSIANW, "evmwlssianw", "eea", 'E') \
+	X(EVMWLUMI, "evmwlumi", "ee", 'e') \
+	X(EVMWLUMIA, "evmwlumia", "ee", 'E') \
+	X(EVMWLUMIAAW, "evmwlumiaaw", "eea", 'E') \
+	X(EVMWLUMIANW, "evmwlumianw", "eea", 'E') \
+	X(EVMWLUSIAAW, "evmwlusiaaw", "eea", 'E') \
+	X(EVMWLUSIANW, "evmwlusianw", "eea", 'E') \
+	X(EVMWSMF, "evmwsmf", "ee", 'e') \
+	X(EVMWSMFA, "evmwsmfa", "ee", 'E') \
+	X(EVMWSMFAA, "evmwsmfaa", "eea", 'E') \
+	X(EVMWSMFAN, "evmwsmfan", "eea", 'E') \
+	X(EVMWSMI, "evmwsmi", "ee", 'e') \
+	X(EVMWSMIA, "evmwsmia", "ee", 'E') \
+	X(EVMWSMIAA, "evmwsmiaa", "eea", 'E') \
+	X(EVMWSMIAN, "evmwsmian", "eea", 'E') \
+	X(EVMWSSF, "evmwssf", "ee", 'e') \
+	X(EVMWSSFA, "evmwssfa", "ee", 'E') \
+	X(EVMWSSFAA, "evmwssfaa", "eea", 'E') \
+	X(EVMWSSFAN, "evmwssfan", "eea", 'E') \
+	X(EVMWUMI, "evmwumi", "ee", 'e') \
+	X(EVMWUMIA, "evmwumia", "ee", 'E') \
+	X(EVMWUMIAA, "evmwumiaa", "eea", 'E') \
+	X(EVMWUMIAN, "evmwumian", "eea", 'E') \
+	X(EVRLW, "evrlw", "ee", 'e') \
+	X(EVRNDW, "evrndw", "e", 'e') \
+	X(EVSLW, "evslw", "ee", 'e') \
+	X(EVSRWS, "evsrws", "ee", 'e') \
+	X(EVSRWU, "evsrwu", "ee", 'e') \
+	X(EVSUBFSMIAAW, "evsubfsmiaaw", "ea", 'E') \
+	X(EVSUBFSSIAAW, "evsubfssiaaw", "ea", 'E') \
+	X(EVSUBFUMIAAW, "evsubfumiaaw", "ea", 'E') \
+	X(EVSUBFUSIAAW, "evsubfusiaaw", "ea", 'E')
+
+enum ppc_spe_intrinsic {
+	PPC_INTRIN_SPE_BASE = 0x400 - 1,
+	#define SPE_ENUM(id, name, inputs, output) PPC_INTRIN_##id,
+	SPE_INTRINSICS(SPE_ENUM)
+	#undef SPE_ENUM
+	PPC_INTRIN_SPE_END
+};
+
+
+bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction& il, const uint8_t *data, uint64_t addr, decomp_result *res, bool le, bool crRegisters = false);
+bool GetCachedLowLevelILForPPCInstruction(LowLevelILFunction& il, const uint8_t *data, bool le, bool crRegisters = false);
+bool GetLowLevelILForLocalInstruction(LowLevelILFunction& il, uint32_t insword, bool crRegisters = false);
+
+struct vle_insn;
+bool GetLowLevelILForVLEInstruction(Architecture *arch, LowLevelILFunction& il, uint64_t addr, const struct vle_insn *insn);
@@ -0,0 +1,165 @@
+/******************************************************************************
+
+See prologue.h for more information about how this fits into the PPC
+architecture plugin picture.
+
+******************************************************************************/
+
+#include <string.h>
+
+#include "disassembler.h"
+#include "prologue.h"
+#include "util.h"
+
+/* how far past the frame allocation to look for the rest of the prologue */
+#define PROLOGUE_WINDOW 8
+
+#define INSN_MFLR_R0   0x7c0802a6
+#define INSN_BLR       0x4e800020
+
+static inline uint32_t load_word(const uint8_t *data, bool lil_end)
+{
+	uint32_t iw;
+	memcpy(&iw, data, 4);
+	return lil_end ? iw : bswap32(iw);
+}
+
+/* stwu r1, -N(r1) (32-bit) or stdu r1, -N(r1) (64-bit), returns N or 0 */
+static inline uint32_t frame_size(uint32_t iw)
+{
+	if ((iw & 0xffff8000) == 0x94218000)
+		return (uint32_t)-(int32_t)(int16_t)(iw & 0xffff);
+	if ((iw & 0xffff8003) == 0xf8218001)
+		return (uint32_t)-(int32_t)(int16_t)(iw & 0xfffc);
+	return 0;
+}
+
+/* the out of line register save helpers (_savegpr_NN, _savegpr0_NN) are a
+	run of "stw rN, d(r11)" or "std rN, d(r1)" ending in blr */
+static bool is_savegpr(const uint8_t *data, size_t len, uint64_t base,
+	uint64_t target, bool lil_end)
+{
+	if (target < base || target + 4 > base + len || (target & 3))
+		return false;
+
+	uint32_t iw = load_word(data + (target - base), lil_end);
+	uint32_t rs = (iw >> 21) & 0x1f;
+
+	if (rs < 14)
+		return false;
+	if ((iw & 0xfc1f0000) == 0x900b0000) /* stw rN, d(r11) */
+		return true;
+	if ((iw & 0xfc1f0003) == 0xf8010000) /* std rN, d(r1) */
+		return true;
+	return false;
+}
+
+static prologue_candidate score_frame(const uint8_t *data, size_t len,
+	uint64_t base, bool lil_end, size_t i, uint32_t frame)
+{
+	prologue_candidate cand;
+	size_t start = i;
+	size_t words = len / 4;
+
+	cand.evidence = PROLOGUE_STACK_FRAME;
+	cand.score = 1;
+
+	/* 64-bit prologues save LR before allocating the frame:
+		mflr r0; std r0, 16(r1); stdu r1, -N(r1) */
+	for (size_t j = (i >= 2) ? i - 2 : 0; j < i; ++j)
+	{
+		uint32_t iw = load_word(data + 4*j, lil_end);
+
+		if (iw == INSN_MFLR_R0)
+		{
+			cand.evidence |= PROLOGUE_MFLR;
+			if (j < start)
+				start = j;
+		}
+		else if ((iw & 0xffff0003) == 0xf8010000) /* std r0, d(r1) */
+		{
+			cand.evidence |= PROLOGUE_SAVE_LR;
+			if (j < start)
+				start = j;
+		}
+	}
+
+	for (size_t j = i + 1; j < words && j <= i + PROLOGUE_WINDOW; ++j)
+	{
+		uint32_t iw = load_word(data + 4*j, lil_end);
+
+		if (iw == INSN_MFLR_R0)
+			cand.evidence |= PROLOGUE_MFLR;
+		else if ((iw & 0xffff0000) == 0x90010000 && (iw & 0xffff) == frame + 4)
+			cand.evidence |= PROLOGUE_SAVE_LR;
+		else if ((iw & 0xfc000003) == 0x48000001) /* bl */
+		{
+			uint32_t target = BranchTarget(iw, (uint32_t)(base + 4*j));
+
+			if (is_savegpr(data, len, base, target, lil_end))
+				cand.evidence |= PROLOGUE_SAVEGPR;
+		}
+		else if (frame_size(iw) || iw == INSN_BLR)
+			break;
+	}
+
+	if (start == 0)
+		cand.evidence |= PROLOGUE_BOUNDARY;
+	else
+	{
+		uint32_t prev = load_word(data + 4*(start - 1), lil_end);
+
+		if (prev == INSN_BLR || prev == 0 || (prev & 0xfc000003) == 0x48000000)
+			cand.evidence |= PROLOGUE_BOUNDARY;
+	}
+
+	if (cand.evidence & PROLOGUE_MFLR) cand.score += 1;
+	if (cand.evidence & PROLOGUE_SAVE_LR) cand.score += 2;
+	if (cand.evidence & PROLOGUE_SAVEGPR) cand.score += 2;
+	if (cand.evidence & PROLOGUE_BOUNDARY) cand.score += 1;
+
+	cand.addr = base + 4*start;
+	return cand;
+}
+
+void ppc_scan_prologues(const uint8_t *data, size_t len, uint64_t base,
+	bool lil_end, std::vector<prologue_candidate>& result)
+{
+	size_t words = len / 4;
+	uint64_t localEntry = 0;
+
+	for (size_t i = 0; i < words; ++i)
+	{
+		uint32_t iw = load_word(data + 4*i, lil_end);
+
+		/* cheap reject: every anchor is one of three primary opcodes
+			(15 addis, 37 stwu, 62 stdu) */
+		uint32_t op = iw >> 26;
+		if (op != 37 && op != 62 && op != 15)
+			continue;
+
+		uint32_t frame = frame_size(iw);
+		if (frame)
+		{
+			prologue_candidate cand = score_frame(data, len, base, lil_end, i, frame);
+
+			/* the local entry of an ELFv2 function was already reported
+				through its global entry */
+			if (cand.addr != localEntry)
+				result.push_back(cand);
+			continue;
+		}
+
+		/* ELFv2 global entry point: addis r2, r12, hi; addi r2, r2, lo */
+		if (i + 1 < words && IsElfV2GlobalEntry(iw, load_word(data + 4*(i+1), lil_end)))
+		{
+			prologue_candidate cand;
+			cand.addr = base + 4*i;
+			cand.evidence = PROLOGUE_TOC_SETUP;
+			cand.score = PROLOGUE_SCORE_LIKELY + 1;
+			result.push_back(cand);
+			localEntry = cand.addr + 8;
+			++i;
+		}
+	}
+}
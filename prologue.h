@@ -0,0 +1,44 @@
+/******************************************************************************
+
+Raw scanner for function prologues in stripped PowerPC code (firmware, boot
+loaders, etc.) where there are no symbols to seed function discovery.
+
+It never decodes through capstone: each word is matched against the bit
+patterns of a handful of canonical prologue instructions, and bl targets are
+decoded with BranchTarget() from util.h like GetInstructionInfo() does. Only
+words that look like an anchor (a stack frame allocation or an ELFv2 TOC
+setup) get a closer look at their neighbors.
+
+ppc_scan_prologues() - appends candidate function starts with a score
+
+A score of PROLOGUE_SCORE_LIKELY or more is a good enough signal to create a
+function on its own.
+
+******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+/* evidence contributing to a candidate's score */
+#define PROLOGUE_STACK_FRAME 0x01 /* stwu/stdu r1, -N(r1) */
+#define PROLOGUE_MFLR        0x02 /* mflr r0 */
+#define PROLOGUE_SAVE_LR     0x04 /* stw r0, N+4(r1) / std r0, 16(r1) */
+#define PROLOGUE_SAVEGPR     0x08 /* bl _savegpr_NN */
+#define PROLOGUE_BOUNDARY    0x10 /* preceded by blr, b, or padding */
+#define PROLOGUE_TOC_SETUP   0x20 /* ELFv2 addis r2, r12 / addi r2, r2 */
+
+#define PROLOGUE_SCORE_LIKELY 3
+
+struct prologue_candidate
+{
+	uint64_t addr;
+	uint32_t score;
+	uint32_t evidence; /* PROLOGUE_XXX */
+};
+
+void ppc_scan_prologues(const uint8_t *data, size_t len, uint64_t base,
+	bool lil_end, std::vector<prologue_candidate>& result);
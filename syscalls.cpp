@@ -0,0 +1,477 @@
+/******************************************************************************
+
+See syscalls.h for more information about how this fits into the PPC
+architecture plugin picture.
+
+Numbers follow arch/powerpc/kernel/syscalls/syscall.tbl.
+
+******************************************************************************/
+
+#include "syscalls.h"
+
+static const struct ppc_syscall syscalls[] = {
+	/*   0 */ { "restart_syscall", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*   1 */ { "exit", NULL, "void", "int status", PPC_SYSCALL_COMMON },
+	/*   2 */ { "fork", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/*   3 */ { "read", NULL, "long", "int fd, void* buf, unsigned long count", PPC_SYSCALL_COMMON },
+	/*   4 */ { "write", NULL, "long", "int fd, const void* buf, unsigned long count", PPC_SYSCALL_COMMON },
+	/*   5 */ { "open", NULL, "int", "const char* pathname, int flags, int mode", PPC_SYSCALL_COMMON },
+	/*   6 */ { "close", NULL, "int", "int fd", PPC_SYSCALL_COMMON },
+	/*   7 */ { "waitpid", NULL, "int", "int pid, int* wstatus, int options", PPC_SYSCALL_COMMON },
+	/*   8 */ { "creat", NULL, "int", "const char* pathname, int mode", PPC_SYSCALL_COMMON },
+	/*   9 */ { "link", NULL, "int", "const char* oldpath, const char* newpath", PPC_SYSCALL_COMMON },
+	/*  10 */ { "unlink", NULL, "int", "const char* pathname", PPC_SYSCALL_COMMON },
+	/*  11 */ { "execve", NULL, "int", "const char* pathname, char* const* argv, char* const* envp", PPC_SYSCALL_COMMON },
+	/*  12 */ { "chdir", NULL, "int", "const char* path", PPC_SYSCALL_COMMON },
+	/*  13 */ { "time", NULL, "long", "long* tloc", PPC_SYSCALL_COMMON },
+	/*  14 */ { "mknod", NULL, "int", "const char* pathname, int mode, unsigned int dev", PPC_SYSCALL_COMMON },
+	/*  15 */ { "chmod", NULL, "int", "const char* pathname, int mode", PPC_SYSCALL_COMMON },
+	/*  16 */ { "lchown", NULL, "int", "const char* pathname, unsigned int owner, unsigned int group", PPC_SYSCALL_COMMON },
+	/*  17 */ { "break", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  18 */ { "oldstat", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  19 */ { "lseek", NULL, "long", "int fd, long offset, int whence", PPC_SYSCALL_COMMON },
+	/*  20 */ { "getpid", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/*  21 */ { "mount", NULL, "int", "const char* source, const char* target, const char* filesystemtype, unsigned long mountflags, const void* data", PPC_SYSCALL_COMMON },
+	/*  22 */ { "umount", NULL, "int", "const char* target", PPC_SYSCALL_COMMON },
+	/*  23 */ { "setuid", NULL, "int", "unsigned int uid", PPC_SYSCALL_COMMON },
+	/*  24 */ { "getuid", NULL, "unsigned int", "", PPC_SYSCALL_COMMON },
+	/*  25 */ { "stime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  26 */ { "ptrace", NULL, "long", "long request, int pid, void* addr, void* data", PPC_SYSCALL_COMMON },
+	/*  27 */ { "alarm", NULL, "unsigned int", "unsigned int seconds", PPC_SYSCALL_COMMON },
+	/*  28 */ { "oldfstat", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  29 */ { "pause", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/*  30 */ { "utime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  31 */ { "stty", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  32 */ { "gtty", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  33 */ { "access", NULL, "int", "const char* pathname, int mode", PPC_SYSCALL_COMMON },
+	/*  34 */ { "nice", NULL, "int", "int inc", PPC_SYSCALL_COMMON },
+	/*  35 */ { "ftime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  36 */ { "sync", NULL, "void", "", PPC_SYSCALL_COMMON },
+	/*  37 */ { "kill", NULL, "int", "int pid, int sig", PPC_SYSCALL_COMMON },
+	/*  38 */ { "rename", NULL, "int", "const char* oldpath, const char* newpath", PPC_SYSCALL_COMMON },
+	/*  39 */ { "mkdir", NULL, "int", "const char* pathname, int mode", PPC_SYSCALL_COMMON },
+	/*  40 */ { "rmdir", NULL, "int", "const char* pathname", PPC_SYSCALL_COMMON },
+	/*  41 */ { "dup", NULL, "int", "int oldfd", PPC_SYSCALL_COMMON },
+	/*  42 */ { "pipe", NULL, "int", "int* pipefd", PPC_SYSCALL_COMMON },
+	/*  43 */ { "times", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  44 */ { "prof", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  45 */ { "brk", NULL, "long", "void* addr", PPC_SYSCALL_COMMON },
+	/*  46 */ { "setgid", NULL, "int", "unsigned int gid", PPC_SYSCALL_COMMON },
+	/*  47 */ { "getgid", NULL, "unsigned int", "", PPC_SYSCALL_COMMON },
+	/*  48 */ { "signal", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  49 */ { "geteuid", NULL, "unsigned int", "", PPC_SYSCALL_COMMON },
+	/*  50 */ { "getegid", NULL, "unsigned int", "", PPC_SYSCALL_COMMON },
+	/*  51 */ { "acct", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  52 */ { "umount2", NULL, "int", "const char* target, int flags", PPC_SYSCALL_COMMON },
+	/*  53 */ { "lock", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  54 */ { "ioctl", NULL, "int", "int fd, unsigned long request, void* argp", PPC_SYSCALL_COMMON },
+	/*  55 */ { "fcntl", NULL, "int", "int fd, int cmd, long arg", PPC_SYSCALL_COMMON },
+	/*  56 */ { "mpx", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  57 */ { "setpgid", NULL, "int", "int pid, int pgid", PPC_SYSCALL_COMMON },
+	/*  58 */ { "ulimit", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  59 */ { "oldolduname", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  60 */ { "umask", NULL, "int", "int mask", PPC_SYSCALL_COMMON },
+	/*  61 */ { "chroot", NULL, "int", "const char* path", PPC_SYSCALL_COMMON },
+	/*  62 */ { "ustat", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  63 */ { "dup2", NULL, "int", "int oldfd, int newfd", PPC_SYSCALL_COMMON },
+	/*  64 */ { "getppid", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/*  65 */ { "getpgrp", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/*  66 */ { "setsid", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/*  67 */ { "sigaction", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  68 */ { "sgetmask", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  69 */ { "ssetmask", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  70 */ { "setreuid", NULL, "int", "unsigned int ruid, unsigned int euid", PPC_SYSCALL_COMMON },
+	/*  71 */ { "setregid", NULL, "int", "unsigned int rgid, unsigned int egid", PPC_SYSCALL_COMMON },
+	/*  72 */ { "sigsuspend", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  73 */ { "sigpending", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  74 */ { "sethostname", NULL, "int", "const char* name, unsigned long len", PPC_SYSCALL_COMMON },
+	/*  75 */ { "setrlimit", NULL, "int", "int resource, const void* rlim", PPC_SYSCALL_COMMON },
+	/*  76 */ { "getrlimit", NULL, "int", "int resource, void* rlim", PPC_SYSCALL_COMMON },
+	/*  77 */ { "getrusage", NULL, "int", "int who, void* usage", PPC_SYSCALL_COMMON },
+	/*  78 */ { "gettimeofday", NULL, "int", "void* tv, void* tz", PPC_SYSCALL_COMMON },
+	/*  79 */ { "settimeofday", NULL, "int", "const void* tv, const void* tz", PPC_SYSCALL_COMMON },
+	/*  80 */ { "getgroups", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  81 */ { "setgroups", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  82 */ { "select", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  83 */ { "symlink", NULL, "int", "const char* target, const char* linkpath", PPC_SYSCALL_COMMON },
+	/*  84 */ { "oldlstat", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  85 */ { "readlink", NULL, "long", "const char* pathname, char* buf, unsigned long bufsiz", PPC_SYSCALL_COMMON },
+	/*  86 */ { "uselib", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  87 */ { "swapon", NULL, "int", "const char* path, int swapflags", PPC_SYSCALL_COMMON },
+	/*  88 */ { "reboot", NULL, "int", "int magic, int magic2, int cmd, void* arg", PPC_SYSCALL_COMMON },
+	/*  89 */ { "readdir", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  90 */ { "mmap", NULL, "void*", "void* addr, unsigned long length, int prot, int flags, int fd, long offset", PPC_SYSCALL_COMMON },
+	/*  91 */ { "munmap", NULL, "int", "void* addr, unsigned long length", PPC_SYSCALL_COMMON },
+	/*  92 */ { "truncate", NULL, "int", "const char* path, long length", PPC_SYSCALL_COMMON },
+	/*  93 */ { "ftruncate", NULL, "int", "int fd, long length", PPC_SYSCALL_COMMON },
+	/*  94 */ { "fchmod", NULL, "int", "int fd, int mode", PPC_SYSCALL_COMMON },
+	/*  95 */ { "fchown", NULL, "int", "int fd, unsigned int owner, unsigned int group", PPC_SYSCALL_COMMON },
+	/*  96 */ { "getpriority", NULL, "int", "int which, int who", PPC_SYSCALL_COMMON },
+	/*  97 */ { "setpriority", NULL, "int", "int which, int who, int prio", PPC_SYSCALL_COMMON },
+	/*  98 */ { "profil", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/*  99 */ { "statfs", NULL, "int", "const char* path, void* buf", PPC_SYSCALL_COMMON },
+	/* 100 */ { "fstatfs", NULL, "int", "int fd, void* buf", PPC_SYSCALL_COMMON },
+	/* 101 */ { "ioperm", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 102 */ { "socketcall", NULL, "int", "int call, unsigned long* args", PPC_SYSCALL_COMMON },
+	/* 103 */ { "syslog", NULL, "int", "int type, char* bufp, int len", PPC_SYSCALL_COMMON },
+	/* 104 */ { "setitimer", NULL, "int", "int which, const void* new_value, void* old_value", PPC_SYSCALL_COMMON },
+	/* 105 */ { "getitimer", NULL, "int", "int which, void* curr_value", PPC_SYSCALL_COMMON },
+	/* 106 */ { "stat", NULL, "int", "const char* pathname, void* statbuf", PPC_SYSCALL_COMMON },
+	/* 107 */ { "lstat", NULL, "int", "const char* pathname, void* statbuf", PPC_SYSCALL_COMMON },
+	/* 108 */ { "fstat", NULL, "int", "int fd, void* statbuf", PPC_SYSCALL_COMMON },
+	/* 109 */ { "olduname", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 110 */ { "iopl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 111 */ { "vhangup", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 112 */ { "idle", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 113 */ { "vm86", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 114 */ { "wait4", NULL, "int", "int pid, int* wstatus, int options, void* rusage", PPC_SYSCALL_COMMON },
+	/* 115 */ { "swapoff", NULL, "int", "const char* path", PPC_SYSCALL_COMMON },
+	/* 116 */ { "sysinfo", NULL, "int", "void* info", PPC_SYSCALL_COMMON },
+	/* 117 */ { "ipc", NULL, "int", "unsigned int call, int first, unsigned long second, unsigned long third, void* ptr, long fifth", PPC_SYSCALL_COMMON },
+	/* 118 */ { "fsync", NULL, "int", "int fd", PPC_SYSCALL_COMMON },
+	/* 119 */ { "sigreturn", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 120 */ { "clone", NULL, "long", "unsigned long flags, void* stack, int* parent_tid, unsigned long tls, int* child_tid", PPC_SYSCALL_COMMON },
+	/* 121 */ { "setdomainname", NULL, "int", "const char* name, unsigned long len", PPC_SYSCALL_COMMON },
+	/* 122 */ { "uname", NULL, "int", "void* buf", PPC_SYSCALL_COMMON },
+	/* 123 */ { "modify_ldt", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 124 */ { "adjtimex", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 125 */ { "mprotect", NULL, "int", "void* addr, unsigned long len, int prot", PPC_SYSCALL_COMMON },
+	/* 126 */ { "sigprocmask", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 127 */ { "create_module", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 128 */ { "init_module", NULL, "int", "void* module_image, unsigned long len, const char* param_values", PPC_SYSCALL_COMMON },
+	/* 129 */ { "delete_module", NULL, "int", "const char* name, unsigned int flags", PPC_SYSCALL_COMMON },
+	/* 130 */ { "get_kernel_syms", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 131 */ { "quotactl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 132 */ { "getpgid", NULL, "int", "int pid", PPC_SYSCALL_COMMON },
+	/* 133 */ { "fchdir", NULL, "int", "int fd", PPC_SYSCALL_COMMON },
+	/* 134 */ { "bdflush", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 135 */ { "sysfs", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 136 */ { "personality", NULL, "int", "unsigned long persona", PPC_SYSCALL_COMMON },
+	/* 137 */ { "afs_syscall", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 138 */ { "setfsuid", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 139 */ { "setfsgid", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 140 */ { "_llseek", NULL, "int", "unsigned int fd, unsigned long offset_high, unsigned long offset_low, long long* result, unsigned int whence", PPC_SYSCALL_COMMON },
+	/* 141 */ { "getdents", NULL, "int", "unsigned int fd, void* dirp, unsigned int count", PPC_SYSCALL_COMMON },
+	/* 142 */ { "_newselect", NULL, "int", "int nfds, void* readfds, void* writefds, void* exceptfds, void* timeout", PPC_SYSCALL_COMMON },
+	/* 143 */ { "flock", NULL, "int", "int fd, int operation", PPC_SYSCALL_COMMON },
+	/* 144 */ { "msync", NULL, "int", "void* addr, unsigned long length, int flags", PPC_SYSCALL_COMMON },
+	/* 145 */ { "readv", NULL, "long", "int fd, const void* iov, int iovcnt", PPC_SYSCALL_COMMON },
+	/* 146 */ { "writev", NULL, "long", "int fd, const void* iov, int iovcnt", PPC_SYSCALL_COMMON },
+	/* 147 */ { "getsid", NULL, "int", "int pid", PPC_SYSCALL_COMMON },
+	/* 148 */ { "fdatasync", NULL, "int", "int fd", PPC_SYSCALL_COMMON },
+	/* 149 */ { "_sysctl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 150 */ { "mlock", NULL, "int", "const void* addr, unsigned long len", PPC_SYSCALL_COMMON },
+	/* 151 */ { "munlock", NULL, "int", "const void* addr, unsigned long len", PPC_SYSCALL_COMMON },
+	/* 152 */ { "mlockall", NULL, "int", "int flags", PPC_SYSCALL_COMMON },
+	/* 153 */ { "munlockall", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 154 */ { "sched_setparam", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 155 */ { "sched_getparam", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 156 */ { "sched_setscheduler", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 157 */ { "sched_getscheduler", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 158 */ { "sched_yield", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 159 */ { "sched_get_priority_max", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 160 */ { "sched_get_priority_min", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 161 */ { "sched_rr_get_interval", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 162 */ { "nanosleep", NULL, "int", "const void* req, void* rem", PPC_SYSCALL_COMMON },
+	/* 163 */ { "mremap", NULL, "void*", "void* old_address, unsigned long old_size, unsigned long new_size, int flags, void* new_address", PPC_SYSCALL_COMMON },
+	/* 164 */ { "setresuid", NULL, "int", "unsigned int ruid, unsigned int euid, unsigned int suid", PPC_SYSCALL_COMMON },
+	/* 165 */ { "getresuid", NULL, "int", "unsigned int* ruid, unsigned int* euid, unsigned int* suid", PPC_SYSCALL_COMMON },
+	/* 166 */ { "query_module", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 167 */ { "poll", NULL, "int", "void* fds, unsigned long nfds, int timeout", PPC_SYSCALL_COMMON },
+	/* 168 */ { "nfsservctl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 169 */ { "setresgid", NULL, "int", "unsigned int rgid, unsigned int egid, unsigned int sgid", PPC_SYSCALL_COMMON },
+	/* 170 */ { "getresgid", NULL, "int", "unsigned int* rgid, unsigned int* egid, unsigned int* sgid", PPC_SYSCALL_COMMON },
+	/* 171 */ { "prctl", NULL, "int", "int option, unsigned long arg2, unsigned long arg3, unsigned long arg4, unsigned long arg5", PPC_SYSCALL_COMMON },
+	/* 172 */ { "rt_sigreturn", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 173 */ { "rt_sigaction", NULL, "int", "int signum, const void* act, void* oldact, unsigned long sigsetsize", PPC_SYSCALL_COMMON },
+	/* 174 */ { "rt_sigprocmask", NULL, "int", "int how, const void* set, void* oldset, unsigned long sigsetsize", PPC_SYSCALL_COMMON },
+	/* 175 */ { "rt_sigpending", NULL, "int", "void* set, unsigned long sigsetsize", PPC_SYSCALL_COMMON },
+	/* 176 */ { "rt_sigtimedwait", NULL, "int", "const void* set, void* info, const void* timeout, unsigned long sigsetsize", PPC_SYSCALL_COMMON },
+	/* 177 */ { "rt_sigqueueinfo", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 178 */ { "rt_sigsuspend", NULL, "int", "const void* mask, unsigned long sigsetsize", PPC_SYSCALL_COMMON },
+	/* 179 */ { "pread64", NULL, "long", "int fd, void* buf, unsigned long count, long offset", PPC_SYSCALL_COMMON },
+	/* 180 */ { "pwrite64", NULL, "long", "int fd, const void* buf, unsigned long count, long offset", PPC_SYSCALL_COMMON },
+	/* 181 */ { "chown", NULL, "int", "const char* pathname, unsigned int owner, unsigned int group", PPC_SYSCALL_COMMON },
+	/* 182 */ { "getcwd", NULL, "long", "char* buf, unsigned long size", PPC_SYSCALL_COMMON },
+	/* 183 */ { "capget", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 184 */ { "capset", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 185 */ { "sigaltstack", NULL, "int", "const void* ss, void* old_ss", PPC_SYSCALL_COMMON },
+	/* 186 */ { "sendfile", NULL, "long", "int out_fd, int in_fd, long* offset, unsigned long count", PPC_SYSCALL_COMMON },
+	/* 187 */ { "getpmsg", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 188 */ { "putpmsg", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 189 */ { "vfork", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 190 */ { "ugetrlimit", NULL, "int", "int resource, void* rlim", PPC_SYSCALL_COMMON },
+	/* 191 */ { "readahead", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 192 */ { "mmap2", NULL, "void*", "void* addr, unsigned long length, int prot, int flags, int fd, unsigned long pgoffset", PPC_SYSCALL_32 },
+	/* 193 */ { "truncate64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 194 */ { "ftruncate64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 195 */ { "stat64", NULL, "int", "const char* pathname, void* statbuf", PPC_SYSCALL_32 },
+	/* 196 */ { "lstat64", NULL, "int", "const char* pathname, void* statbuf", PPC_SYSCALL_32 },
+	/* 197 */ { "fstat64", NULL, "int", "int fd, void* statbuf", PPC_SYSCALL_32 },
+	/* 198 */ { "pciconfig_read", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 199 */ { "pciconfig_write", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 200 */ { "pciconfig_iobase", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 201 */ { "multiplexer", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 202 */ { "getdents64", NULL, "long", "int fd, void* dirp, unsigned long count", PPC_SYSCALL_COMMON },
+	/* 203 */ { "pivot_root", NULL, "int", "const char* new_root, const char* put_old", PPC_SYSCALL_COMMON },
+	/* 204 */ { "fcntl64", NULL, "int", "int fd, int cmd, long arg", PPC_SYSCALL_32 },
+	/* 205 */ { "madvise", NULL, "int", "void* addr, unsigned long length, int advice", PPC_SYSCALL_COMMON },
+	/* 206 */ { "mincore", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 207 */ { "gettid", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 208 */ { "tkill", NULL, "int", "int tid, int sig", PPC_SYSCALL_COMMON },
+	/* 209 */ { "setxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 210 */ { "lsetxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 211 */ { "fsetxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 212 */ { "getxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 213 */ { "lgetxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 214 */ { "fgetxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 215 */ { "listxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 216 */ { "llistxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 217 */ { "flistxattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 218 */ { "removexattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 219 */ { "lremovexattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 220 */ { "fremovexattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 221 */ { "futex", NULL, "long", "unsigned int* uaddr, int futex_op, unsigned int val, const void* timeout, unsigned int* uaddr2, unsigned int val3", PPC_SYSCALL_COMMON },
+	/* 222 */ { "sched_setaffinity", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 223 */ { "sched_getaffinity", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 224 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 225 */ { "tuxcall", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 226 */ { "sendfile64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 227 */ { "io_setup", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 228 */ { "io_destroy", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 229 */ { "io_getevents", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 230 */ { "io_submit", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 231 */ { "io_cancel", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 232 */ { "set_tid_address", NULL, "int", "int* tidptr", PPC_SYSCALL_COMMON },
+	/* 233 */ { "fadvise64", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 234 */ { "exit_group", NULL, "void", "int status", PPC_SYSCALL_COMMON },
+	/* 235 */ { "lookup_dcookie", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 236 */ { "epoll_create", NULL, "int", "int size", PPC_SYSCALL_COMMON },
+	/* 237 */ { "epoll_ctl", NULL, "int", "int epfd, int op, int fd, void* event", PPC_SYSCALL_COMMON },
+	/* 238 */ { "epoll_wait", NULL, "int", "int epfd, void* events, int maxevents, int timeout", PPC_SYSCALL_COMMON },
+	/* 239 */ { "remap_file_pages", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 240 */ { "timer_create", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 241 */ { "timer_settime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 242 */ { "timer_gettime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 243 */ { "timer_getoverrun", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 244 */ { "timer_delete", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 245 */ { "clock_settime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 246 */ { "clock_gettime", NULL, "int", "int clockid, void* tp", PPC_SYSCALL_COMMON },
+	/* 247 */ { "clock_getres", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 248 */ { "clock_nanosleep", NULL, "int", "int clockid, int flags, const void* request, void* remain", PPC_SYSCALL_COMMON },
+	/* 249 */ { "swapcontext", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 250 */ { "tgkill", NULL, "int", "int tgid, int tid, int sig", PPC_SYSCALL_COMMON },
+	/* 251 */ { "utimes", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 252 */ { "statfs64", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 253 */ { "fstatfs64", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 254 */ { "fadvise64_64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 255 */ { "rtas", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 256 */ { "sys_debug_setcontext", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 257 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 258 */ { "migrate_pages", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 259 */ { "mbind", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 260 */ { "get_mempolicy", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 261 */ { "set_mempolicy", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 262 */ { "mq_open", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 263 */ { "mq_unlink", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 264 */ { "mq_timedsend", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 265 */ { "mq_timedreceive", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 266 */ { "mq_notify", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 267 */ { "mq_getsetattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 268 */ { "kexec_load", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 269 */ { "add_key", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 270 */ { "request_key", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 271 */ { "keyctl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 272 */ { "waitid", NULL, "int", "int idtype, int id, void* infop, int options, void* rusage", PPC_SYSCALL_COMMON },
+	/* 273 */ { "ioprio_set", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 274 */ { "ioprio_get", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 275 */ { "inotify_init", NULL, "int", "", PPC_SYSCALL_COMMON },
+	/* 276 */ { "inotify_add_watch", NULL, "int", "int fd, const char* pathname, unsigned int mask", PPC_SYSCALL_COMMON },
+	/* 277 */ { "inotify_rm_watch", NULL, "int", "int fd, int wd", PPC_SYSCALL_COMMON },
+	/* 278 */ { "spu_run", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 279 */ { "spu_create", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 280 */ { "pselect6", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 281 */ { "ppoll", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 282 */ { "unshare", NULL, "int", "int flags", PPC_SYSCALL_COMMON },
+	/* 283 */ { "splice", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 284 */ { "tee", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 285 */ { "vmsplice", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 286 */ { "openat", NULL, "int", "int dirfd, const char* pathname, int flags, int mode", PPC_SYSCALL_COMMON },
+	/* 287 */ { "mkdirat", NULL, "int", "int dirfd, const char* pathname, int mode", PPC_SYSCALL_COMMON },
+	/* 288 */ { "mknodat", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 289 */ { "fchownat", NULL, "int", "int dirfd, const char* pathname, unsigned int owner, unsigned int group, int flags", PPC_SYSCALL_COMMON },
+	/* 290 */ { "futimesat", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 291 */ { "fstatat64", "newfstatat", "int", "int dirfd, const char* pathname, void* statbuf, int flags", PPC_SYSCALL_COMMON },
+	/* 292 */ { "unlinkat", NULL, "int", "int dirfd, const char* pathname, int flags", PPC_SYSCALL_COMMON },
+	/* 293 */ { "renameat", NULL, "int", "int olddirfd, const char* oldpath, int newdirfd, const char* newpath", PPC_SYSCALL_COMMON },
+	/* 294 */ { "linkat", NULL, "int", "int olddirfd, const char* oldpath, int newdirfd, const char* newpath, int flags", PPC_SYSCALL_COMMON },
+	/* 295 */ { "symlinkat", NULL, "int", "const char* target, int newdirfd, const char* linkpath", PPC_SYSCALL_COMMON },
+	/* 296 */ { "readlinkat", NULL, "long", "int dirfd, const char* pathname, char* buf, unsigned long bufsiz", PPC_SYSCALL_COMMON },
+	/* 297 */ { "fchmodat", NULL, "int", "int dirfd, const char* pathname, int mode, int flags", PPC_SYSCALL_COMMON },
+	/* 298 */ { "faccessat", NULL, "int", "int dirfd, const char* pathname, int mode, int flags", PPC_SYSCALL_COMMON },
+	/* 299 */ { "get_robust_list", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 300 */ { "set_robust_list", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 301 */ { "move_pages", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 302 */ { "getcpu", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 303 */ { "epoll_pwait", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 304 */ { "utimensat", NULL, "int", "int dirfd, const char* pathname, const void* times, int flags", PPC_SYSCALL_COMMON },
+	/* 305 */ { "signalfd", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 306 */ { "timerfd_create", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 307 */ { "eventfd", NULL, "int", "unsigned int initval", PPC_SYSCALL_COMMON },
+	/* 308 */ { "sync_file_range2", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 309 */ { "fallocate", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 310 */ { "subpage_prot", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 311 */ { "timerfd_settime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 312 */ { "timerfd_gettime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 313 */ { "signalfd4", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 314 */ { "eventfd2", NULL, "int", "unsigned int initval, int flags", PPC_SYSCALL_COMMON },
+	/* 315 */ { "epoll_create1", NULL, "int", "int flags", PPC_SYSCALL_COMMON },
+	/* 316 */ { "dup3", NULL, "int", "int oldfd, int newfd, int flags", PPC_SYSCALL_COMMON },
+	/* 317 */ { "pipe2", NULL, "int", "int* pipefd, int flags", PPC_SYSCALL_COMMON },
+	/* 318 */ { "inotify_init1", NULL, "int", "int flags", PPC_SYSCALL_COMMON },
+	/* 319 */ { "perf_event_open", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 320 */ { "preadv", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 321 */ { "pwritev", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 322 */ { "rt_tgsigqueueinfo", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 323 */ { "fanotify_init", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 324 */ { "fanotify_mark", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 325 */ { "prlimit64", NULL, "int", "int pid, int resource, const void* new_limit, void* old_limit", PPC_SYSCALL_COMMON },
+	/* 326 */ { "socket", NULL, "int", "int domain, int type, int protocol", PPC_SYSCALL_COMMON },
+	/* 327 */ { "bind", NULL, "int", "int sockfd, const void* addr, unsigned int addrlen", PPC_SYSCALL_COMMON },
+	/* 328 */ { "connect", NULL, "int", "int sockfd, const void* addr, unsigned int addrlen", PPC_SYSCALL_COMMON },
+	/* 329 */ { "listen", NULL, "int", "int sockfd, int backlog", PPC_SYSCALL_COMMON },
+	/* 330 */ { "accept", NULL, "int", "int sockfd, void* addr, unsigned int* addrlen", PPC_SYSCALL_COMMON },
+	/* 331 */ { "getsockname", NULL, "int", "int sockfd, void* addr, unsigned int* addrlen", PPC_SYSCALL_COMMON },
+	/* 332 */ { "getpeername", NULL, "int", "int sockfd, void* addr, unsigned int* addrlen", PPC_SYSCALL_COMMON },
+	/* 333 */ { "socketpair", NULL, "int", "int domain, int type, int protocol, int* sv", PPC_SYSCALL_COMMON },
+	/* 334 */ { "send", NULL, "long", "int sockfd, const void* buf, unsigned long len, int flags", PPC_SYSCALL_COMMON },
+	/* 335 */ { "sendto", NULL, "long", "int sockfd, const void* buf, unsigned long len, int flags, const void* dest_addr, unsigned int addrlen", PPC_SYSCALL_COMMON },
+	/* 336 */ { "recv", NULL, "long", "int sockfd, void* buf, unsigned long len, int flags", PPC_SYSCALL_COMMON },
+	/* 337 */ { "recvfrom", NULL, "long", "int sockfd, void* buf, unsigned long len, int flags, void* src_addr, unsigned int* addrlen", PPC_SYSCALL_COMMON },
+	/* 338 */ { "shutdown", NULL, "int", "int sockfd, int how", PPC_SYSCALL_COMMON },
+	/* 339 */ { "setsockopt", NULL, "int", "int sockfd, int level, int optname, const void* optval, unsigned int optlen", PPC_SYSCALL_COMMON },
+	/* 340 */ { "getsockopt", NULL, "int", "int sockfd, int level, int optname, void* optval, unsigned int* optlen", PPC_SYSCALL_COMMON },
+	/* 341 */ { "sendmsg", NULL, "long", "int sockfd, const void* msg, int flags", PPC_SYSCALL_COMMON },
+	/* 342 */ { "recvmsg", NULL, "long", "int sockfd, void* msg, int flags", PPC_SYSCALL_COMMON },
+	/* 343 */ { "recvmmsg", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 344 */ { "accept4", NULL, "int", "int sockfd, void* addr, unsigned int* addrlen, int flags", PPC_SYSCALL_COMMON },
+	/* 345 */ { "name_to_handle_at", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 346 */ { "open_by_handle_at", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 347 */ { "clock_adjtime", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 348 */ { "syncfs", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 349 */ { "sendmmsg", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 350 */ { "setns", NULL, "int", "int fd, int nstype", PPC_SYSCALL_COMMON },
+	/* 351 */ { "process_vm_readv", NULL, "long", "int pid, const void* local_iov, unsigned long liovcnt, const void* remote_iov, unsigned long riovcnt, unsigned long flags", PPC_SYSCALL_COMMON },
+	/* 352 */ { "process_vm_writev", NULL, "long", "int pid, const void* local_iov, unsigned long liovcnt, const void* remote_iov, unsigned long riovcnt, unsigned long flags", PPC_SYSCALL_COMMON },
+	/* 353 */ { "finit_module", NULL, "int", "int fd, const char* param_values, int flags", PPC_SYSCALL_COMMON },
+	/* 354 */ { "kcmp", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 355 */ { "sched_setattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 356 */ { "sched_getattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 357 */ { "renameat2", NULL, "int", "int olddirfd, const char* oldpath, int newdirfd, const char* newpath, unsigned int flags", PPC_SYSCALL_COMMON },
+	/* 358 */ { "seccomp", NULL, "int", "unsigned int operation, unsigned int flags, void* args", PPC_SYSCALL_COMMON },
+	/* 359 */ { "getrandom", NULL, "long", "void* buf, unsigned long buflen, unsigned int flags", PPC_SYSCALL_COMMON },
+	/* 360 */ { "memfd_create", NULL, "int", "const char* name, unsigned int flags", PPC_SYSCALL_COMMON },
+	/* 361 */ { "bpf", NULL, "int", "int cmd, void* attr, unsigned int size", PPC_SYSCALL_COMMON },
+	/* 362 */ { "execveat", NULL, "int", "int dirfd, const char* pathname, char* const* argv, char* const* envp, int flags", PPC_SYSCALL_COMMON },
+	/* 363 */ { "switch_endian", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 364 */ { "userfaultfd", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 365 */ { "membarrier", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 366 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 367 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 368 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 369 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 370 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 371 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 372 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 373 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 374 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 375 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 376 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 377 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 378 */ { "mlock2", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 379 */ { "copy_file_range", NULL, "long", "int fd_in, long* off_in, int fd_out, long* off_out, unsigned long len, unsigned int flags", PPC_SYSCALL_COMMON },
+	/* 380 */ { "preadv2", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 381 */ { "pwritev2", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 382 */ { "kexec_file_load", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 383 */ { "statx", NULL, "int", "int dirfd, const char* pathname, int flags, unsigned int mask, void* statxbuf", PPC_SYSCALL_COMMON },
+	/* 384 */ { "pkey_alloc", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 385 */ { "pkey_free", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 386 */ { "pkey_mprotect", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 387 */ { "rseq", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 388 */ { "io_pgetevents", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 389 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 390 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 391 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 392 */ { "semtimedop", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 393 */ { "semget", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 394 */ { "semctl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 395 */ { "shmget", NULL, "int", "int key, unsigned long size, int shmflg", PPC_SYSCALL_COMMON },
+	/* 396 */ { "shmctl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 397 */ { "shmat", NULL, "void*", "int shmid, const void* shmaddr, int shmflg", PPC_SYSCALL_COMMON },
+	/* 398 */ { "shmdt", NULL, "int", "const void* shmaddr", PPC_SYSCALL_COMMON },
+	/* 399 */ { "msgget", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 400 */ { "msgsnd", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 401 */ { "msgrcv", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 402 */ { "msgctl", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 403 */ { "clock_gettime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 404 */ { "clock_settime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 405 */ { "clock_adjtime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 406 */ { "clock_getres_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 407 */ { "clock_nanosleep_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 408 */ { "timer_gettime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 409 */ { "timer_settime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 410 */ { "timerfd_gettime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 411 */ { "timerfd_settime64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 412 */ { "utimensat_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 413 */ { "pselect6_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 414 */ { "ppoll_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 415 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 416 */ { "io_pgetevents_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 417 */ { "recvmmsg_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 418 */ { "mq_timedsend_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 419 */ { "mq_timedreceive_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 420 */ { "semtimedop_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 421 */ { "rt_sigtimedwait_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 422 */ { "futex_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 423 */ { "sched_rr_get_interval_time64", NULL, NULL, NULL, PPC_SYSCALL_32 },
+	/* 424 */ { "pidfd_send_signal", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 425 */ { "io_uring_setup", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 426 */ { "io_uring_enter", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 427 */ { "io_uring_register", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 428 */ { "open_tree", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 429 */ { "move_mount", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 430 */ { "fsopen", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 431 */ { "fsconfig", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 432 */ { "fsmount", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 433 */ { "fspick", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 434 */ { "pidfd_open", NULL, "int", "int pid, unsigned int flags", PPC_SYSCALL_COMMON },
+	/* 435 */ { "clone3", NULL, "long", "void* cl_args, unsigned long size", PPC_SYSCALL_COMMON },
+	/* 436 */ { "close_range", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 437 */ { "openat2", NULL, "long", "int dirfd, const char* pathname, void* how, unsigned long size", PPC_SYSCALL_COMMON },
+	/* 438 */ { "pidfd_getfd", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 439 */ { "faccessat2", NULL, "int", "int dirfd, const char* pathname, int mode, int flags", PPC_SYSCALL_COMMON },
+	/* 440 */ { "process_madvise", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 441 */ { "epoll_pwait2", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 442 */ { "mount_setattr", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 443 */ { "quotactl_fd", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 444 */ { "landlock_create_ruleset", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 445 */ { "landlock_add_rule", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 446 */ { "landlock_restrict_self", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 447 */ { NULL, NULL, NULL, NULL, 0 },
+	/* 448 */ { "process_mrelease", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 449 */ { "futex_waitv", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+	/* 450 */ { "set_mempolicy_home_node", NULL, NULL, NULL, PPC_SYSCALL_COMMON },
+};
+
+const struct ppc_syscall *ppc_linux_syscall(uint32_t number, bool is64)
+{
+	if (number >= sizeof(syscalls) / sizeof(syscalls[0]))
+		return NULL;
+
+	const struct ppc_syscall *entry = &syscalls[number];
+	if (!entry->name)
+		return NULL;
+	if (is64 && entry->abi == PPC_SYSCALL_32)
+		return NULL;
+	return entry;
+}
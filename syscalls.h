@@ -0,0 +1,34 @@
+/******************************************************************************
+
+Linux system call table for PowerPC, shared by ppc32 and ppc64 (they use one
+numbering, with a handful of calls that only exist on 32-bit).
+
+The table is indexed directly by the number the caller loads into r0 before
+"sc", so a lookup is a bounds check and an array access.
+
+ppc_linux_syscall() - returns the entry for a number, or NULL
+
+Entries carry the C return and argument types where they are well known, as
+plain C types so they parse without any headers. Calls without a signature
+still have a name.
+
+******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PPC_SYSCALL_COMMON 0
+#define PPC_SYSCALL_32     1 /* not present on ppc64 */
+
+struct ppc_syscall
+{
+	const char *name;
+	const char *name64; /* ppc64 name when it differs, else NULL */
+	const char *ret;    /* return type, NULL if no signature */
+	const char *args;   /* argument list without parentheses */
+	uint8_t abi;        /* PPC_SYSCALL_XXX */
+};
+
+const struct ppc_syscall *ppc_linux_syscall(uint32_t number, bool is64);
@@ -2,11 +2,11 @@
 
 tests_mfcr = [
     # mfcr 0
-    (b'\x7c\x00\x00\x26', 'LLIL_SET_REG.d{none}(r0,LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(lt,31),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(gt,30),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(eq,29),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(so,28),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_lt,27),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_gt,26),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_eq,25),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_so,24),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_lt,23),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_gt,22),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_eq,21),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_so,20),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_lt,19),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_gt,18),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_eq,17),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_so,16),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_lt,15),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_gt,14),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_eq,13),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_so,12),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_lt,11),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_gt,10),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_eq,9),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_so,8),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_lt,7),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_gt,6),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_eq,5),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_so,4),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_lt,3),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_gt,2),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_eq,1),LLIL_FLAG_BIT.d{none}(cr7_so,0)))))))))))))))))))))))))))))))))'),
+    (b'\x7c\x00\x00\x26', 'LLIL_SET_REG.d{none}(r0,LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr0_field),LLIL_CONST.d(0x1C)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr1_field),LLIL_CONST.d(0x18)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr2_field),LLIL_CONST.d(0x14)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr3_field),LLIL_CONST.d(0x10)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr4_field),LLIL_CONST.d(0xC)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr5_field),LLIL_CONST.d(0x8)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr6_field),LLIL_CONST.d(0x4)),LLIL_FLAG_GROUP{none}(cr7_field)))))))))'),
     # mfcr 15
-    (b'\x7d\xe0\x00\x26', 'LLIL_SET_REG.d{none}(r15,LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(lt,31),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(gt,30),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(eq,29),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(so,28),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_lt,27),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_gt,26),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_eq,25),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_so,24),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_lt,23),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_gt,22),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_eq,21),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_so,20),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_lt,19),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_gt,18),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_eq,17),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_so,16),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_lt,15),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_gt,14),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_eq,13),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_so,12),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_lt,11),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_gt,10),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_eq,9),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_so,8),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_lt,7),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_gt,6),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_eq,5),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_so,4),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_lt,3),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_gt,2),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_eq,1),LLIL_FLAG_BIT.d{none}(cr7_so,0)))))))))))))))))))))))))))))))))'),
+    (b'\x7d\xe0\x00\x26', 'LLIL_SET_REG.d{none}(r15,LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr0_field),LLIL_CONST.d(0x1C)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr1_field),LLIL_CONST.d(0x18)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr2_field),LLIL_CONST.d(0x14)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr3_field),LLIL_CONST.d(0x10)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr4_field),LLIL_CONST.d(0xC)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr5_field),LLIL_CONST.d(0x8)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr6_field),LLIL_CONST.d(0x4)),LLIL_FLAG_GROUP{none}(cr7_field)))))))))'),
     # mfcr 31
-    (b'\x7f\xe0\x00\x26', 'LLIL_SET_REG.d{none}(r31,LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(lt,31),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(gt,30),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(eq,29),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(so,28),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_lt,27),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_gt,26),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_eq,25),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr1_so,24),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_lt,23),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_gt,22),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_eq,21),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr2_so,20),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_lt,19),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_gt,18),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_eq,17),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr3_so,16),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_lt,15),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_gt,14),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_eq,13),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr4_so,12),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_lt,11),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_gt,10),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_eq,9),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr5_so,8),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_lt,7),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_gt,6),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_eq,5),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr6_so,4),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_lt,3),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_gt,2),LLIL_OR.d{none}(LLIL_FLAG_BIT.d{none}(cr7_eq,1),LLIL_FLAG_BIT.d{none}(cr7_so,0)))))))))))))))))))))))))))))))))')
+    (b'\x7f\xe0\x00\x26', 'LLIL_SET_REG.d{none}(r31,LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr0_field),LLIL_CONST.d(0x1C)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr1_field),LLIL_CONST.d(0x18)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr2_field),LLIL_CONST.d(0x14)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr3_field),LLIL_CONST.d(0x10)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr4_field),LLIL_CONST.d(0xC)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr5_field),LLIL_CONST.d(0x8)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_FLAG_GROUP{none}(cr6_field),LLIL_CONST.d(0x4)),LLIL_FLAG_GROUP{none}(cr7_field)))))))))')
 ]
 
 tests_basics = [
@@ -14,16 +14,156 @@ tests_basics = [
     (b'\x38\x60\x00\x64', 'LLIL_SET_REG.d{none}(r3,LLIL_CONST.d(0x64))')
 ]
 
+tests_branches = [
+    # bcl 20, 31, .+4 (PIC thunk, not a call)
+    (b'\x42\x9f\x00\x05', 'LLIL_SET_REG.d{none}(lr,LLIL_CONST.d(0x4))'),
+    # bl .+4
+    (b'\x48\x00\x00\x05', 'LLIL_SET_REG.d{none}(lr,LLIL_CONST.d(0x4))')
+]
+
+tests_multiple = [
+    # stmw 30, -8(1)
+    (b'\xbf\xc1\xff\xf8', 'LLIL_SET_REG.d{none}(temp0,LLIL_ADD.d{none}(LLIL_REG.d{none}(r1),LLIL_CONST.d(0xFFFFFFF8))); LLIL_STORE.d{none}(LLIL_REG.d{none}(temp0),LLIL_REG.d{none}(r30)); LLIL_STORE.d{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(temp0),LLIL_CONST.d(0x4)),LLIL_REG.d{none}(r31))'),
+    # lmw 30, 8(1)
+    (b'\xbb\xc1\x00\x08', 'LLIL_SET_REG.d{none}(temp0,LLIL_ADD.d{none}(LLIL_REG.d{none}(r1),LLIL_CONST.d(0x8))); LLIL_SET_REG.d{none}(r30,LLIL_LOAD.d{none}(LLIL_REG.d{none}(temp0))); LLIL_SET_REG.d{none}(r31,LLIL_LOAD.d{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(temp0),LLIL_CONST.d(0x4))))')
+]
+
+tests_byte_reverse = [
+    # lwbrx 3, 0, 4
+    (b'\x7c\x60\x24\x2c', 'LLIL_INTRINSIC{none}([r3],__bswap32,LLIL_CALL_PARAM{none}([LLIL_LOAD.d{none}(LLIL_ADD.d{none}(LLIL_CONST.d(0x0),LLIL_REG.d{none}(r4)))]))')
+]
+
+tests_doubleword = [
+    # ld 3, 8(1)
+    (b'\xe8\x61\x00\x08', 'LLIL_SET_REG.d{none}(r3,LLIL_LOW_PART.d{none}(LLIL_LOAD.q{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r1),LLIL_CONST.d(0x8)))))'),
+    # std 3, 8(1)
+    (b'\xf8\x61\x00\x08', 'LLIL_STORE.q{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r1),LLIL_CONST.d(0x8)),LLIL_ZX.q{none}(LLIL_REG.d{none}(r3)))')
+]
+
+tests_float = [
+    # lfd 1, 8(1)
+    (b'\xc8\x21\x00\x08', 'LLIL_SET_REG.q{none}(f1,LLIL_LOAD.q{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r1),LLIL_CONST.d(0x8))))'),
+    # fadd 1, 2, 3
+    (b'\xfc\x22\x18\x2a', 'LLIL_SET_REG.q{none}(f1,LLIL_FADD.q{none}(LLIL_REG.q{none}(f2),LLIL_REG.q{none}(f3)))')
+]
+
+tests_altivec = [
+    # lvx 2, 3, 4
+    (b'\x7c\x43\x20\xce', 'LLIL_SET_REG.o{none}(v2,LLIL_LOAD.o{none}(LLIL_AND.d{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4)),LLIL_CONST.d(0xFFFFFFF0))))')
+]
+
+tests_vsx = [
+    # lxvd2x vs0, r3, r4
+    (b'\x7c\x03\x26\x98', 'LLIL_SET_REG.o{none}(vs0,LLIL_OR.o{none}(LLIL_LSL.o{none}(LLIL_ZX.o{none}(LLIL_LOAD.q{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4)))),LLIL_CONST.d(0x40)),LLIL_ZX.o{none}(LLIL_LOAD.q{none}(LLIL_ADD.d{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4)),LLIL_CONST.d(0x8))))))')
+]
+
+tests_spe = [
+    # evstdd r31, 8(r1)
+    (b'\x13\xe1\x0b\x21', 'LLIL_STORE.q{none}(LLIL_ADD.d{none}(LLIL_REG.d{none}(r1),LLIL_CONST.d(0x8)),LLIL_OR.q{none}(LLIL_LSL.q{none}(LLIL_ZX.q{none}(LLIL_REG.d{none}(r31h)),LLIL_CONST.d(0x20)),LLIL_ZX.q{none}(LLIL_REG.d{none}(r31))))')
+]
+
+tests_spr = [
+    # mfspr 3, 26 (mfsrr0 3)
+    (b'\x7c\x7a\x02\xa6', 'LLIL_SET_REG.d{none}(r3,LLIL_REG.d{none}(srr0))')
+]
+
 test_cases = \
     tests_mfcr + \
-    tests_basics
+    tests_basics + \
+    tests_branches + \
+    tests_multiple + \
+    tests_byte_reverse + \
+    tests_doubleword + \
+    tests_float + \
+    tests_altivec + \
+    tests_vsx + \
+    tests_spe + \
+    tests_spr
+
+# VLE, lifted on the ppc_vle architecture: 16-bit se_ and 32-bit e_ forms
+tests_vle = [
+    # se_add 3, 4
+    (b'\x04\x43', 'LLIL_SET_REG.d{none}(r3,LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4)))'),
+    # se_subi. 3, 1
+    (b'\x26\x03', 'LLIL_SET_REG.d{cr0_signed}(r3,LLIL_SUB.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x1)))'),
+    # e_add16i 3, 4, -1
+    (b'\x1c\x64\xff\xff', 'LLIL_SET_REG.d{none}(r3,LLIL_ADD.d{none}(LLIL_REG.d{none}(r4),LLIL_CONST.d(0xFFFFFFFF)))'),
+    # e_lis 3, 0x1234; e_add16i 3, 3, 0x5678
+    (b'\x70\x62\xe2\x34\x1c\x63\x56\x78', 'LLIL_SET_REG.d{none}(r3,LLIL_CONST.d(0x12340000)); LLIL_SET_REG.d{none}(r3,LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x5678)))'),
+    # se_blr
+    (b'\x00\x04', 'LLIL_RET{none}(LLIL_REG.d{none}(lr))'),
+    # se_cmpi 3, 0; e_beq .+6; se_blr; se_blr
+    (b'\x2a\x03\x7a\x12\x00\x06\x00\x04\x00\x04', 'LLIL_SUB.d{cr0_signed}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x0)); LLIL_IF{none}(LLIL_FLAG_GROUP{none}(cr0_eq),3,2); LLIL_RET{none}(LLIL_REG.d{none}(lr)); LLIL_RET{none}(LLIL_REG.d{none}(lr))'),
+    # se_cmpi 3, 0; se_bne .+4; se_blr; se_blr
+    (b'\x2a\x03\xe2\x02\x00\x04\x00\x04', 'LLIL_SUB.d{cr0_signed}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x0)); LLIL_IF{none}(LLIL_FLAG_GROUP{none}(cr0_ne),3,2); LLIL_RET{none}(LLIL_REG.d{none}(lr)); LLIL_RET{none}(LLIL_REG.d{none}(lr))'),
+    # se_mflr 0; se_li 3, 0x10; e_add16i 3, 3, 0x20; se_add 3, 4; e_lis 4, 1;
+    # se_mtlr 0; se_blr
+    (b'\x00\x80\x49\x03\x1c\x63\x00\x20\x04\x43\x70\x80\xe0\x01\x00\x90\x00\x04', 'LLIL_SET_REG.d{none}(r0,LLIL_REG.d{none}(lr)); LLIL_SET_REG.d{none}(r3,LLIL_CONST.d(0x10)); LLIL_SET_REG.d{none}(r3,LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x20))); LLIL_SET_REG.d{none}(r3,LLIL_ADD.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4))); LLIL_SET_REG.d{none}(r4,LLIL_CONST.d(0x10000)); LLIL_SET_REG.d{none}(lr,LLIL_REG.d{none}(r0)); LLIL_RET{none}(LLIL_REG.d{none}(lr))')
+]
+
+# expectations under arch.ppc.conditionRegisters, where cr0-cr7 are registers
+tests_cr_registers = [
+    # cmpw 3, 4; bltlr
+    (b'\x7c\x03\x20\x00\x4d\x80\x00\x20', 'LLIL_SET_REG.d{none}(cr0,LLIL_OR.d{none}(LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_BOOL_TO_INT.d{none}(LLIL_CMP_SLT.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4))),LLIL_CONST.d(0x3)),LLIL_LSL.d{none}(LLIL_BOOL_TO_INT.d{none}(LLIL_CMP_SGT.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4))),LLIL_CONST.d(0x2))),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_BOOL_TO_INT.d{none}(LLIL_CMP_E.d{none}(LLIL_REG.d{none}(r3),LLIL_REG.d{none}(r4))),LLIL_CONST.d(0x1)),LLIL_BOOL_TO_INT.d{none}(LLIL_FLAG{none}(xer_so))))); LLIL_IF{none}(LLIL_CMP_NE.d{none}(LLIL_AND.d{none}(LLIL_REG.d{none}(cr0),LLIL_CONST.d(0x8)),LLIL_CONST.d(0x0)),2,3); LLIL_RET{none}(LLIL_REG.d{none}(lr))'),
+    # add. 3, 4, 5
+    (b'\x7c\x64\x2a\x15', 'LLIL_SET_REG.d{none}(r3,LLIL_ADD.d{none}(LLIL_REG.d{none}(r4),LLIL_REG.d{none}(r5))); LLIL_SET_REG.d{none}(cr0,LLIL_OR.d{none}(LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_BOOL_TO_INT.d{none}(LLIL_CMP_SLT.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x0))),LLIL_CONST.d(0x3)),LLIL_LSL.d{none}(LLIL_BOOL_TO_INT.d{none}(LLIL_CMP_SGT.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x0))),LLIL_CONST.d(0x2))),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_BOOL_TO_INT.d{none}(LLIL_CMP_E.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x0))),LLIL_CONST.d(0x1)),LLIL_BOOL_TO_INT.d{none}(LLIL_FLAG{none}(xer_so)))))'),
+    # crxor 0, 1, 2
+    (b'\x4c\x01\x11\x82', 'LLIL_SET_REG.d{none}(cr0,LLIL_OR.d{none}(LLIL_AND.d{none}(LLIL_REG.d{none}(cr0),LLIL_CONST.d(0x7)),LLIL_LSL.d{none}(LLIL_XOR.d{none}(LLIL_AND.d{none}(LLIL_LSR.d{none}(LLIL_REG.d{none}(cr0),LLIL_CONST.d(0x2)),LLIL_CONST.d(0x1)),LLIL_AND.d{none}(LLIL_LSR.d{none}(LLIL_REG.d{none}(cr0),LLIL_CONST.d(0x1)),LLIL_CONST.d(0x1))),LLIL_CONST.d(0x3))))'),
+    # mfcr 0
+    (b'\x7c\x00\x00\x26', 'LLIL_SET_REG.d{none}(r0,LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr0),LLIL_CONST.d(0x1C)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr1),LLIL_CONST.d(0x18)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr2),LLIL_CONST.d(0x14)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr3),LLIL_CONST.d(0x10)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr4),LLIL_CONST.d(0xC)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr5),LLIL_CONST.d(0x8)),LLIL_OR.d{none}(LLIL_LSL.d{none}(LLIL_REG.d{none}(cr6),LLIL_CONST.d(0x4)),LLIL_REG.d{none}(cr7)))))))))'),
+    # mtcrf 0x81, 3
+    (b'\x7c\x68\x11\x20', 'LLIL_SET_REG.d{none}(cr0,LLIL_AND.d{none}(LLIL_LSR.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0x1C)),LLIL_CONST.d(0xF))); LLIL_SET_REG.d{none}(cr7,LLIL_AND.d{none}(LLIL_REG.d{none}(r3),LLIL_CONST.d(0xF)))')
+]
+
+# jump tables resolved by the switch recognizer, the same in either model:
+#   cmplwi 3, 2; bgtlr; lis 9, 0; addi 9, 9, 0x28; slwi 0, 3, 2
+#   lwzx 0, 9, 0; mtctr 0; bctr; blr; blr; .long 0x20, 0x24, 0x20
+tests_switch = [
+    (b'\x28\x03\x00\x02\x4d\x81\x00\x20\x3d\x20\x00\x00\x39\x29\x00\x28' +
+     b'\x54\x60\x10\x3a\x7c\x09\x00\x2e\x7c\x09\x03\xa6\x4e\x80\x04\x20' +
+     b'\x4e\x80\x00\x20\x4e\x80\x00\x20\x00\x00\x00\x20\x00\x00\x00\x24' +
+     b'\x00\x00\x00\x20', [0x20, 0x24])
+]
+
+import struct
+
+# Mach-O object with lis 3, ha(_g+0x1010); addi 3, 3, lo(_g+0x1010); blr at
+# 0x1000, relocated by an extern HA16 and LO16 each with its PAIR. The PAIR
+# of the HA16 carries 0x1010, above the section base: (symbol, offset)
+def macho_reloc_object():
+    text = struct.pack('>III', 0x3c600000, 0x38631010, 0x4e800020)
+    # r_symbolnum:24 r_pcrel:1 r_length:2 r_extern:1 r_type:4, PAIR is type 1
+    reloc = lambda address, symbol, extern, rtype: \
+        struct.pack('>iI', address, symbol << 8 | 2 << 5 | extern << 4 | rtype)
+    relocs = reloc(0, 1, 1, 6) + reloc(0x1010, 0, 0, 1) + \
+        reloc(4, 1, 1, 5) + reloc(0, 0, 0, 1)
+    symbols = struct.pack('>IBBhI', 1, 0x0f, 1, 0, 0x1000) + \
+        struct.pack('>IBBhI', 4, 0x01, 0, 0, 0)
+    strings = b'\0_f\0_g\0\0'
+
+    text_off = 28 + 124 + 24
+    reloc_off = text_off + len(text)
+    sym_off = reloc_off + len(relocs)
+    str_off = sym_off + len(symbols)
+
+    header = struct.pack('>7I', 0xfeedface, 18, 0, 1, 2, 124 + 24, 0)
+    segment = struct.pack('>II16sIIIIiiII', 1, 124, b'', 0x1000, len(text),
+        text_off, len(text), 7, 7, 1, 0)
+    section = struct.pack('>16s16sIIIIIIIII', b'__text', b'__TEXT', 0x1000,
+        len(text), text_off, 2, reloc_off, 4, 0x80000400, 0, 0)
+    symtab = struct.pack('>6I', 2, 24, sym_off, 2, str_off, len(strings))
+
+    data = header + segment + section + symtab + text + relocs + symbols + strings
+    return (data, '_g', 0x1010)
+
+tests_macho_reloc = [macho_reloc_object()]
 
 import re
 import sys
 import binaryninja
 from binaryninja import binaryview
 from binaryninja import lowlevelil
-from binaryninja.enums import LowLevelILOperation
+from binaryninja.enums import LowLevelILOperation, SegmentFlag, SettingsScope
 
 def il2str(il):
     sz_lookup = {1:'.b', 2:'.w', 4:'.d', 8:'.q', 16:'.o'}
@@ -44,11 +184,25 @@ def il2str(il):
     else:
         return str(il)
 
+CR_REGISTERS = 'arch.ppc.conditionRegisters'
+
+# the cr register model is read per view, so it is switched on in the view's
+# own (resource) scope and nothing outlives the test
+def new_view(data, cr_registers):
+    bv = binaryview.BinaryView.new(data)
+    if cr_registers:
+        binaryninja.Settings().set_bool(CR_REGISTERS, True, view=bv,
+            scope=SettingsScope.SettingsResourceScope)
+    return bv
+
 # TODO: make this less hacky
-def instr_to_il(data):
-    platform = binaryninja.Platform['linux-ppc32']
+def instr_to_il(data, cr_registers=False, vle=False):
+    if vle:
+        platform = binaryninja.Architecture['ppc_vle'].standalone_platform
+    else:
+        platform = binaryninja.Platform['linux-ppc32']
     # make a pretend function that returns
-    bv = binaryview.BinaryView.new(data)
+    bv = new_view(data, cr_registers)
     bv.add_function(0, plat=platform)
     assert len(bv.functions) == 1
 
@@ -65,6 +219,24 @@ def instr_to_il(data):
 
     return result
 
+def switch_targets(data, cr_registers=False):
+    platform = binaryninja.Platform['linux-ppc32']
+    bv = new_view(data, cr_registers)
+    bv.add_user_segment(0, len(data), 0, len(data),
+        SegmentFlag.SegmentReadable | SegmentFlag.SegmentExecutable)
+    bv.add_function(0, plat=platform)
+    bv.update_analysis_and_wait()
+
+    return sorted(set([b.dest_addr for b in bv.functions[0].indirect_branches]))
+
+# the lis/addi pair at 0x1000 once the view applied its relocations
+def relocated_ha_lo(data):
+    bv = binaryninja.load(data, update_analysis=False)
+    (hi, lo) = struct.unpack('>II', bv.read(0x1000, 8))
+    lo = lo & 0xffff
+    value = ((hi & 0xffff) << 16) + (lo - 0x10000 if lo & 0x8000 else lo)
+    return (bv, value & 0xffffffff)
+
 def il_str_to_tree(ilstr):
     result = ''
     depth = 0
@@ -84,8 +256,11 @@ def il_str_to_tree(ilstr):
     return result
 
 def test_all():
-    for (test_i, (data, expected)) in enumerate(test_cases):
-        actual = instr_to_il(data)
+    cases = [(data, expected, False, False) for (data, expected) in test_cases] + \
+        [(data, expected, True, False) for (data, expected) in tests_cr_registers] + \
+        [(data, expected, False, True) for (data, expected) in tests_vle]
+    for (test_i, (data, expected, cr_registers, vle)) in enumerate(cases):
+        actual = instr_to_il(data, cr_registers, vle)
         if actual != expected:
             print('MISMATCH AT TEST %d!' % test_i)
             print('\t   input: %s' % data.hex())
@@ -96,6 +271,27 @@ def test_all():
 
             return False
 
+    for (test_i, (data, expected)) in enumerate(tests_switch):
+        for cr_registers in [False, True]:
+            actual = switch_targets(data, cr_registers)
+            if actual != expected:
+                print('SWITCH MISMATCH AT TEST %d%s!' % (test_i, ' (cr registers)' if cr_registers else ''))
+                print('\t   input: %s' % data.hex())
+                print('\texpected: %s' % [hex(x) for x in expected])
+                print('\t  actual: %s' % [hex(x) for x in actual])
+
+                return False
+
+    for (test_i, (data, symbol, offset)) in enumerate(tests_macho_reloc):
+        (bv, actual) = relocated_ha_lo(data)
+        expected = (bv.get_symbol_by_raw_name(symbol).address + offset) & 0xffffffff
+        if actual != expected:
+            print('RELOCATION MISMATCH AT TEST %d!' % test_i)
+            print('\texpected: %s+0x%x = 0x%x' % (symbol, offset, expected))
+            print('\t  actual: 0x%x' % actual)
+
+            return False
+
     return True
 
 if __name__ == '__main__':
@@ -14,5 +14,32 @@ inline uint32_t bswap32(uint32_t x)
 		((x&0xFF000000)>>24);
 }
 
+/* target of an I-form branch (b, ba, bl, bla) at addr: a 24-bit word
+	displacement, absolute when AA is set */
+inline uint32_t BranchTarget(uint32_t iw, uint32_t addr)
+{
+	uint32_t target = iw & 0x03fffffc;
+
+	/* sign extend target */
+	if ((target >> 25) & 1)
+		target |= 0xfc000000;
+
+	/* account for absolute addressing */
+	if (!(iw & 2))
+		target += addr;
+
+	return target;
+}
+
+/* ELFv2 global entry point prologue, the caller supplies the function's
+	address in r12:
+	addis r2, r12, toc@ha
+	addi  r2, r2, toc@l */
+inline bool IsElfV2GlobalEntry(uint32_t iw0, uint32_t iw1)
+{
+	return (iw0 & 0xffff0000) == 0x3c4c0000 &&
+		(iw1 & 0xffff0000) == 0x38420000;
+}
+
 void printOperandVerbose(decomp_result *res, cs_ppc_op *opers);
 void printInstructionVerbose(decomp_result *res);
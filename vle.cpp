@@ -0,0 +1,577 @@
+/******************************************************************************
+
+See vle.h for more information about how this fits into the PPC architecture
+plugin picture.
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#define MYLOG(...) while(0);
+//#include <binaryninjaapi.h>
+//#define MYLOG BinaryNinja::LogDebug
+
+#include "vle.h"
+
+/* 16-bit forms name r0-r7 and r24-r31 with a 4-bit field */
+#define SE_GPR(x) (((x) < 8) ? (PPC_REG_R0 + (x)) : (PPC_REG_R24 + ((x) - 8)))
+/* ... and the alternate registers r8-r23 (se_mtar, se_mfar) */
+#define SE_ALT(x) (PPC_REG_R8 + (x))
+#define GPR(x) (PPC_REG_R0 + (x))
+#define CRF(x) (PPC_REG_CR0 + (x))
+
+static inline void op_reg(struct vle_insn *r, uint32_t reg)
+{
+	struct vle_op *op = &(r->operands[r->op_count++]);
+	op->type = VLE_OP_REG;
+	op->reg = reg;
+}
+
+static inline void op_imm(struct vle_insn *r, int32_t imm)
+{
+	struct vle_op *op = &(r->operands[r->op_count++]);
+	op->type = VLE_OP_IMM;
+	op->imm = imm;
+}
+
+static inline void op_mem(struct vle_insn *r, uint32_t base, int32_t disp)
+{
+	struct vle_op *op = &(r->operands[r->op_count++]);
+	op->type = VLE_OP_MEM;
+	op->mem.base = base;
+	op->mem.disp = disp;
+}
+
+static inline void op_crbit(struct vle_insn *r, uint32_t crbit)
+{
+	struct vle_op *op = &(r->operands[r->op_count++]);
+	op->type = VLE_OP_CRBIT;
+	op->crbit = crbit;
+}
+
+static inline void op_label(struct vle_insn *r, uint32_t label)
+{
+	struct vle_op *op = &(r->operands[r->op_count++]);
+	op->type = VLE_OP_LABEL;
+	op->label = label;
+}
+
+/* SCI8 immediate: UI8 shifted into byte SCL, other bytes filled with F */
+static inline uint32_t sci8(uint32_t insword)
+{
+	uint32_t scl = ((insword >> 8) & 3) * 8;
+	uint32_t result = (insword & 0xff) << scl;
+
+	if (insword & 0x400)
+		result |= ~(0xffu << scl);
+
+	return result;
+}
+
+static int decode16(uint16_t hw, uint32_t addr, struct vle_insn *r)
+{
+	uint32_t rx = hw & 0xf;
+	uint32_t ry = (hw >> 4) & 0xf;
+	uint32_t ui5 = (hw >> 4) & 0x1f;
+
+	switch (hw >> 12)
+	{
+		case 0x0:
+			/* C form */
+			if (hw < 0x10)
+			{
+				static const uint8_t c_form[16] = {
+					VLE_INS_SE_ILLEGAL, VLE_INS_SE_ISYNC, VLE_INS_SE_SC, VLE_INS_INVALID,
+					VLE_INS_SE_BLR, VLE_INS_SE_BLRL, VLE_INS_SE_BCTR, VLE_INS_SE_BCTRL,
+					VLE_INS_SE_RFI, VLE_INS_SE_RFCI, VLE_INS_SE_RFDI, VLE_INS_SE_RFMCI,
+					VLE_INS_INVALID, VLE_INS_INVALID, VLE_INS_INVALID, VLE_INS_INVALID
+				};
+
+				r->id = c_form[hw];
+				r->lk = (r->id == VLE_INS_SE_BLRL || r->id == VLE_INS_SE_BCTRL);
+				break;
+			}
+
+			/* R form */
+			if (hw < 0x100)
+			{
+				static const uint8_t r_form[16] = {
+					VLE_INS_INVALID, VLE_INS_INVALID, VLE_INS_SE_NOT, VLE_INS_SE_NEG,
+					VLE_INS_INVALID, VLE_INS_INVALID, VLE_INS_INVALID, VLE_INS_INVALID,
+					VLE_INS_SE_MFLR, VLE_INS_SE_MTLR, VLE_INS_SE_MFCTR, VLE_INS_SE_MTCTR,
+					VLE_INS_SE_EXTZB, VLE_INS_SE_EXTSB, VLE_INS_SE_EXTZH, VLE_INS_SE_EXTSH
+				};
+
+				r->id = r_form[hw >> 4];
+				op_reg(r, SE_GPR(rx));
+				break;
+			}
+
+			/* RR form */
+			switch (hw >> 8)
+			{
+				case 0x01: r->id = VLE_INS_SE_MR; op_reg(r, SE_GPR(rx)); op_reg(r, SE_GPR(ry)); break;
+				case 0x02: r->id = VLE_INS_SE_MTAR; op_reg(r, SE_ALT(rx)); op_reg(r, SE_GPR(ry)); break;
+				case 0x03: r->id = VLE_INS_SE_MFAR; op_reg(r, SE_GPR(rx)); op_reg(r, SE_ALT(ry)); break;
+				case 0x04: r->id = VLE_INS_SE_ADD; break;
+				case 0x05: r->id = VLE_INS_SE_MULLW; break;
+				case 0x06: r->id = VLE_INS_SE_SUB; break;
+				case 0x07: r->id = VLE_INS_SE_SUBF; break;
+				case 0x0c: r->id = VLE_INS_SE_CMP; break;
+				case 0x0d: r->id = VLE_INS_SE_CMPL; break;
+				case 0x0e: r->id = VLE_INS_SE_CMPH; break;
+				case 0x0f: r->id = VLE_INS_SE_CMPHL; break;
+			}
+
+			if (!r->op_count && r->id != VLE_INS_INVALID)
+			{
+				op_reg(r, SE_GPR(rx));
+				op_reg(r, SE_GPR(ry));
+			}
+			break;
+
+		case 0x2:
+			/* OIM5 and IM5 forms */
+			switch ((hw >> 9) & 7)
+			{
+				case 0: r->id = VLE_INS_SE_ADDI; ui5++; break;
+				case 1: r->id = VLE_INS_SE_CMPLI; ui5++; break;
+				case 2: r->id = VLE_INS_SE_SUBI; ui5++; break;
+				case 3: r->id = VLE_INS_SE_SUBI; ui5++; r->rc = true; break;
+				case 5: r->id = VLE_INS_SE_CMPI; break;
+				case 6: r->id = VLE_INS_SE_BMASKI; break;
+				case 7: r->id = VLE_INS_SE_ANDI; break;
+				default: return -1;
+			}
+
+			op_reg(r, SE_GPR(rx));
+			op_imm(r, ui5);
+			break;
+
+		case 0x4:
+			/* IM7 form */
+			if (hw & 0x0800)
+			{
+				r->id = VLE_INS_SE_LI;
+				op_reg(r, SE_GPR(rx));
+				op_imm(r, (hw >> 4) & 0x7f);
+				break;
+			}
+
+			/* RR form */
+			switch ((hw >> 8) & 7)
+			{
+				case 0: r->id = VLE_INS_SE_SRW; break;
+				case 1: r->id = VLE_INS_SE_SRAW; break;
+				case 2: r->id = VLE_INS_SE_SLW; break;
+				case 4: r->id = VLE_INS_SE_OR; break;
+				case 5: r->id = VLE_INS_SE_ANDC; break;
+				case 6: r->id = VLE_INS_SE_AND; break;
+				case 7: r->id = VLE_INS_SE_AND; r->rc = true; break;
+				default: return -1;
+			}
+
+			op_reg(r, SE_GPR(rx));
+			op_reg(r, SE_GPR(ry));
+			break;
+
+		case 0x6:
+			/* IM5 form */
+			switch ((hw >> 9) & 7)
+			{
+				case 0: r->id = VLE_INS_SE_BCLRI; break;
+				case 1: r->id = VLE_INS_SE_BGENI; break;
+				case 2: r->id = VLE_INS_SE_BSETI; break;
+				case 3: r->id = VLE_INS_SE_BTSTI; break;
+				case 4: r->id = VLE_INS_SE_SRWI; break;
+				case 5: r->id = VLE_INS_SE_SRAWI; break;
+				case 6: r->id = VLE_INS_SE_SLWI; break;
+				default: return -1;
+			}
+
+			op_reg(r, SE_GPR(rx));
+			op_imm(r, ui5);
+			break;
+
+		case 0x8: case 0x9: case 0xa: case 0xb: case 0xc: case 0xd:
+		{
+			/* SD4 form, displacement is scaled by the access size */
+			static const uint8_t sd4_form[6] = {
+				VLE_INS_SE_LBZ, VLE_INS_SE_STB, VLE_INS_SE_LHZ,
+				VLE_INS_SE_STH, VLE_INS_SE_LWZ, VLE_INS_SE_STW
+			};
+			static const uint8_t sd4_scale[6] = { 0, 0, 1, 1, 2, 2 };
+
+			uint32_t index = (hw >> 12) - 8;
+			r->id = sd4_form[index];
+			op_reg(r, SE_GPR(ry));
+			op_mem(r, SE_GPR(rx), ((hw >> 8) & 0xf) << sd4_scale[index]);
+			break;
+		}
+
+		case 0xe:
+			/* BD8 form */
+			if ((hw & 0x0800) == 0)
+			{
+				/* BO16: branch if the bit is true (1) or false (0) */
+				r->id = VLE_INS_SE_BC;
+				r->bo = (hw & 0x0400) ? 12 : 4;
+				r->bi = (hw >> 8) & 3;
+			}
+			else if ((hw & 0x0600) == 0)
+			{
+				r->id = VLE_INS_SE_B;
+				r->lk = hw & 0x0100;
+			}
+			else
+				return -1;
+
+			op_label(r, addr + ((int32_t)(int8_t)(hw & 0xff) << 1));
+			break;
+
+		default:
+			return -1;
+	}
+
+	return (r->id == VLE_INS_INVALID) ? -1 : 0;
+}
+
+static int decode32(uint32_t iw, uint32_t addr, struct vle_insn *r)
+{
+	uint32_t rd = (iw >> 21) & 0x1f;
+	uint32_t ra = (iw >> 16) & 0x1f;
+	uint32_t rb = (iw >> 11) & 0x1f;
+
+	switch (iw >> 26)
+	{
+		case 4: /* SPE, shared with Book E */
+			r->id = VLE_INS_BOOKE;
+			break;
+
+		case 6:
+			if (((iw >> 12) & 0xf) == 0)
+			{
+				/* D8 form */
+				static const uint8_t d8_form[10] = {
+					VLE_INS_E_LBZU, VLE_INS_E_LHZU, VLE_INS_E_LWZU, VLE_INS_E_LHAU,
+					VLE_INS_E_STBU, VLE_INS_E_STHU, VLE_INS_E_STWU, VLE_INS_INVALID,
+					VLE_INS_E_LMW, VLE_INS_E_STMW
+				};
+
+				uint32_t xo = (iw >> 8) & 0xf;
+				if (xo >= sizeof(d8_form))
+					return -1;
+
+				r->id = d8_form[xo];
+				op_reg(r, GPR(rd));
+				op_mem(r, GPR(ra), (int8_t)(iw & 0xff));
+				break;
+			}
+
+			/* SCI8 form */
+			r->rc = iw & 0x800;
+
+			switch ((iw >> 12) & 0xf)
+			{
+				case 8: r->id = VLE_INS_E_ADDI; break;
+				case 9: r->id = VLE_INS_E_ADDIC; break;
+				case 10:
+					if (!r->rc)
+					{
+						r->id = VLE_INS_E_MULLI;
+						break;
+					}
+
+					/* SCI8BF form, e_cmpi/e_cmpli have no record bit */
+					r->rc = false;
+					if ((iw >> 23) & 6)
+						return -1;
+					r->id = (iw & 0x00800000) ? VLE_INS_E_CMPLI : VLE_INS_E_CMPI;
+					op_reg(r, CRF(rd & 3));
+					op_reg(r, GPR(ra));
+					op_imm(r, sci8(iw));
+					return 0;
+				case 11: r->id = VLE_INS_E_SUBFIC; break;
+				case 12: r->id = VLE_INS_E_ANDI; break;
+				case 13: r->id = VLE_INS_E_ORI; break;
+				case 14: r->id = VLE_INS_E_XORI; break;
+				default: return -1;
+			}
+
+			/* logical forms have rS in the first field and rA in the second */
+			if (r->id == VLE_INS_E_ANDI || r->id == VLE_INS_E_ORI || r->id == VLE_INS_E_XORI)
+			{
+				op_reg(r, GPR(ra));
+				op_reg(r, GPR(rd));
+			}
+			else
+			{
+				op_reg(r, GPR(rd));
+				op_reg(r, GPR(ra));
+			}
+
+			op_imm(r, sci8(iw));
+			break;
+
+		case 7:
+			r->id = VLE_INS_E_ADD16I;
+			op_reg(r, GPR(rd));
+			op_reg(r, GPR(ra));
+			op_imm(r, (int16_t)(iw & 0xffff));
+			break;
+
+		case 12: r->id = VLE_INS_E_LBZ; goto d_form;
+		case 13: r->id = VLE_INS_E_STB; goto d_form;
+		case 14: r->id = VLE_INS_E_LHA; goto d_form;
+		case 20: r->id = VLE_INS_E_LWZ; goto d_form;
+		case 21: r->id = VLE_INS_E_STW; goto d_form;
+		case 22: r->id = VLE_INS_E_LHZ; goto d_form;
+		case 23: r->id = VLE_INS_E_STH; goto d_form;
+		d_form:
+			op_reg(r, GPR(rd));
+			op_mem(r, GPR(ra), (int16_t)(iw & 0xffff));
+			break;
+
+		case 28:
+		{
+			uint32_t xo = (iw >> 11) & 0x1f;
+
+			if (xo < 16)
+			{
+				/* LI20 form */
+				int32_t li20 = ((iw >> 11) & 0xf) << 16 | ra << 11 | (iw & 0x7ff);
+				if (li20 & 0x80000)
+					li20 |= 0xfff00000;
+
+				r->id = VLE_INS_E_LI;
+				op_reg(r, GPR(rd));
+				op_imm(r, li20);
+				break;
+			}
+
+			if (xo < 24)
+			{
+				/* I16A form, high bits of the immediate take the place of rD */
+				int32_t si = (int16_t)(rd << 11 | (iw & 0x7ff));
+
+				switch (xo)
+				{
+					case 17: r->id = VLE_INS_E_ADD2I; r->rc = true; break;
+					case 18: r->id = VLE_INS_E_ADD2IS; break;
+					case 19: r->id = VLE_INS_E_CMP16I; break;
+					case 20: r->id = VLE_INS_E_MULL2I; break;
+					case 21: r->id = VLE_INS_E_CMPL16I; si &= 0xffff; break;
+					case 22: r->id = VLE_INS_E_CMPH16I; break;
+					case 23: r->id = VLE_INS_E_CMPHL16I; si &= 0xffff; break;
+					default: return -1;
+				}
+
+				op_reg(r, GPR(ra));
+				op_imm(r, si);
+				break;
+			}
+
+			/* I16L form, high bits of the immediate take the place of rA */
+			switch (xo)
+			{
+				case 24: r->id = VLE_INS_E_OR2I; break;
+				case 25: r->id = VLE_INS_E_AND2I; r->rc = true; break;
+				case 26: r->id = VLE_INS_E_OR2IS; break;
+				case 28: r->id = VLE_INS_E_LIS; break;
+				case 29: r->id = VLE_INS_E_AND2IS; r->rc = true; break;
+				default: return -1;
+			}
+
+			op_reg(r, GPR(rd));
+			op_imm(r, ra << 11 | (iw & 0x7ff));
+			break;
+		}
+
+		case 29: /* M form */
+			r->id = (iw & 1) ? VLE_INS_E_RLWINM : VLE_INS_E_RLWIMI;
+			op_reg(r, GPR(ra));
+			op_reg(r, GPR(rd));
+			op_imm(r, rb);
+			op_imm(r, (iw >> 6) & 0x1f);
+			op_imm(r, (iw >> 1) & 0x1f);
+			break;
+
+		case 30:
+			r->lk = iw & 1;
+
+			if ((iw & 0x02000000) == 0)
+			{
+				/* BD24 form */
+				int32_t bd24 = iw & 0x01fffffe;
+				if (bd24 & 0x01000000)
+					bd24 |= 0xfe000000;
+
+				r->id = VLE_INS_E_B;
+				op_label(r, addr + bd24);
+				break;
+			}
+
+			if (((iw >> 22) & 0xf) != 8)
+				return -1;
+
+			/* BD15 form, BO32 selects: false, true, ctr != 0, ctr == 0 */
+			{
+				static const uint8_t bo32[4] = { 4, 12, 16, 18 };
+				uint32_t bi = (iw >> 16) & 0xf;
+
+				r->id = VLE_INS_E_BC;
+				r->bo = bo32[(iw >> 20) & 3];
+				r->bi = bi;
+
+				if ((r->bo & 0x10) == 0 && bi >= 4)
+					op_reg(r, CRF(bi / 4));
+
+				op_label(r, addr + (int16_t)(iw & 0xfffe));
+			}
+			break;
+
+		case 31:
+			r->rc = iw & 1;
+
+			switch ((iw >> 1) & 0x3ff)
+			{
+				case 14:
+				case 46:
+					r->rc = false;
+					r->id = (iw & 0x40) ? VLE_INS_E_CMPHL : VLE_INS_E_CMPH;
+					op_reg(r, CRF(rd >> 2));
+					op_reg(r, GPR(ra));
+					op_reg(r, GPR(rb));
+					break;
+
+				case 16:
+					r->rc = false;
+					r->id = VLE_INS_E_MCRF;
+					op_reg(r, CRF(rd >> 2));
+					op_reg(r, CRF(ra >> 2));
+					break;
+
+				case 33: r->id = VLE_INS_E_CRNOR; goto xl_form;
+				case 129: r->id = VLE_INS_E_CRANDC; goto xl_form;
+				case 193: r->id = VLE_INS_E_CRXOR; goto xl_form;
+				case 225: r->id = VLE_INS_E_CRNAND; goto xl_form;
+				case 257: r->id = VLE_INS_E_CRAND; goto xl_form;
+				case 289: r->id = VLE_INS_E_CREQV; goto xl_form;
+				case 417: r->id = VLE_INS_E_CRORC; goto xl_form;
+				case 449: r->id = VLE_INS_E_CROR; goto xl_form;
+				xl_form:
+					r->rc = false;
+					op_crbit(r, rd);
+					op_crbit(r, ra);
+					op_crbit(r, rb);
+					break;
+
+				case 36:
+					r->rc = false;
+					r->id = VLE_INS_E_SC;
+					break;
+
+				case 280:
+					r->id = VLE_INS_E_RLW;
+					op_reg(r, GPR(ra));
+					op_reg(r, GPR(rd));
+					op_reg(r, GPR(rb));
+					break;
+
+				case 312: r->id = VLE_INS_E_RLWI; goto shift_form;
+				case 56: r->id = VLE_INS_E_SLWI; goto shift_form;
+				case 568: r->id = VLE_INS_E_SRWI; goto shift_form;
+				shift_form:
+					op_reg(r, GPR(ra));
+					op_reg(r, GPR(rd));
+					op_imm(r, rb);
+					break;
+
+				default:
+					r->rc = false;
+					r->id = VLE_INS_BOOKE;
+					break;
+			}
+			break;
+
+		default:
+			return -1;
+	}
+
+	return (r->id == VLE_INS_INVALID) ? -1 : 0;
+}
+
+extern "C" int
+vle_decompose(const uint8_t *data, size_t size, uint32_t addr, bool lil_end,
+	struct vle_insn *result)
+{
+	if (size < 2)
+		return -1;
+
+	uint16_t hw = lil_end ? (data[1] << 8 | data[0]) : (data[0] << 8 | data[1]);
+
+	memset(result, 0, sizeof(*result));
+
+	/* fast path: anything but primary opcodes 0b0xx1xx is a 16-bit form */
+	if ((hw & 0x9000) != 0x1000)
+	{
+		result->size = 2;
+		result->insword = hw;
+		return decode16(hw, addr, result);
+	}
+
+	if (size < 4)
+		return -1;
+
+	uint16_t lo = lil_end ? (data[3] << 8 | data[2]) : (data[2] << 8 | data[3]);
+
+	result->size = 4;
+	result->insword = (uint32_t)hw << 16 | lo;
+	return decode32(result->insword, addr, result);
+}
+
+extern "C" int
+vle_mnemonic(const struct vle_insn *insn, char *buf, size_t len)
+{
+	static const char *names[VLE_INS_ENDING] = {
+		#define VLE_NAME(id, name) name,
+		VLE_INSTRUCTIONS(VLE_NAME)
+		#undef VLE_NAME
+	};
+
+	if (insn->id >= VLE_INS_ENDING)
+		return -1;
+
+	const char *name = names[insn->id];
+
+	if (insn->id == VLE_INS_SE_BC || insn->id == VLE_INS_E_BC)
+	{
+		/* use the simplified mnemonics, eg: se_beq, e_bnel, e_bdnz */
+		static const char *conditions[2][4] = {
+			{ "ge", "le", "ne", "ns" },
+			{ "lt", "gt", "eq", "so" }
+		};
+
+		const char *prefix = (insn->id == VLE_INS_SE_BC) ? "se_b" : "e_b";
+		const char *cond;
+
+		if (insn->bo & 0x10)
+			cond = (insn->bo & 2) ? "dz" : "dnz";
+		else
+			cond = conditions[(insn->bo >> 3) & 1][insn->bi & 3];
+
+		snprintf(buf, len, "%s%s%s", prefix, cond, insn->lk ? "l" : "");
+		return 0;
+	}
+
+	size_t n = strlen(name);
+	bool dot = insn->rc && name[n-1] != '.';
+
+	if (insn->id == VLE_INS_SE_B || insn->id == VLE_INS_E_B)
+		snprintf(buf, len, "%s%s", name, insn->lk ? "l" : "");
+	else
+		snprintf(buf, len, "%s%s", name, dot ? "." : "");
+
+	return 0;
+}
@@ -0,0 +1,203 @@
+/******************************************************************************
+
+Decoder for the PowerPC VLE (Variable Length Encoding) instruction set found on
+e200 cores.
+
+VLE mixes 16-bit "se_" and 32-bit "e_" instructions. The instruction length is
+determined by the top nibble of the first halfword, and the 16-bit forms are
+decoded straight out of that halfword without ever touching capstone.
+
+The 32-bit encodings that VLE shares with Book E (primary opcodes 4 and 31,
+except the VLE specific extended opcodes under 31) are reported with id
+VLE_INS_BOOKE so the caller can hand them to powerpc_decompose().
+
+vle_decompose() - converts bytes into vle_insn
+vle_mnemonic() - converts vle_insn to a mnemonic string
+
+Registers are reported using capstone's PPC_REG_XXX ids so they share the
+register model of the regular architecture.
+
+******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capstone/ppc.h"
+
+#define VLE_INSTRUCTIONS(X) \
+	X(INVALID, "invalid") \
+	X(BOOKE, "booke") \
+	/* 16-bit */ \
+	X(SE_ILLEGAL, "se_illegal") \
+	X(SE_ISYNC, "se_isync") \
+	X(SE_SC, "se_sc") \
+	X(SE_BLR, "se_blr") \
+	X(SE_BLRL, "se_blrl") \
+	X(SE_BCTR, "se_bctr") \
+	X(SE_BCTRL, "se_bctrl") \
+	X(SE_RFI, "se_rfi") \
+	X(SE_RFCI, "se_rfci") \
+	X(SE_RFDI, "se_rfdi") \
+	X(SE_RFMCI, "se_rfmci") \
+	X(SE_NOT, "se_not") \
+	X(SE_NEG, "se_neg") \
+	X(SE_MFLR, "se_mflr") \
+	X(SE_MTLR, "se_mtlr") \
+	X(SE_MFCTR, "se_mfctr") \
+	X(SE_MTCTR, "se_mtctr") \
+	X(SE_EXTZB, "se_extzb") \
+	X(SE_EXTSB, "se_extsb") \
+	X(SE_EXTZH, "se_extzh") \
+	X(SE_EXTSH, "se_extsh") \
+	X(SE_MR, "se_mr") \
+	X(SE_MTAR, "se_mtar") \
+	X(SE_MFAR, "se_mfar") \
+	X(SE_ADD, "se_add") \
+	X(SE_MULLW, "se_mullw") \
+	X(SE_SUB, "se_sub") \
+	X(SE_SUBF, "se_subf") \
+	X(SE_CMP, "se_cmp") \
+	X(SE_CMPL, "se_cmpl") \
+	X(SE_CMPH, "se_cmph") \
+	X(SE_CMPHL, "se_cmphl") \
+	X(SE_ADDI, "se_addi") \
+	X(SE_CMPLI, "se_cmpli") \
+	X(SE_SUBI, "se_subi") \
+	X(SE_CMPI, "se_cmpi") \
+	X(SE_BMASKI, "se_bmaski") \
+	X(SE_ANDI, "se_andi") \
+	X(SE_SRW, "se_srw") \
+	X(SE_SRAW, "se_sraw") \
+	X(SE_SLW, "se_slw") \
+	X(SE_OR, "se_or") \
+	X(SE_ANDC, "se_andc") \
+	X(SE_AND, "se_and") \
+	X(SE_LI, "se_li") \
+	X(SE_BCLRI, "se_bclri") \
+	X(SE_BGENI, "se_bgeni") \
+	X(SE_BSETI, "se_bseti") \
+	X(SE_BTSTI, "se_btsti") \
+	X(SE_SRWI, "se_srwi") \
+	X(SE_SRAWI, "se_srawi") \
+	X(SE_SLWI, "se_slwi") \
+	X(SE_LBZ, "se_lbz") \
+	X(SE_STB, "se_stb") \
+	X(SE_LHZ, "se_lhz") \
+	X(SE_STH, "se_sth") \
+	X(SE_LWZ, "se_lwz") \
+	X(SE_STW, "se_stw") \
+	X(SE_BC, "se_bc") \
+	X(SE_B, "se_b") \
+	/* 32-bit */ \
+	X(E_ADD16I, "e_add16i") \
+	X(E_LBZ, "e_lbz") \
+	X(E_STB, "e_stb") \
+	X(E_LHA, "e_lha") \
+	X(E_LWZ, "e_lwz") \
+	X(E_STW, "e_stw") \
+	X(E_LHZ, "e_lhz") \
+	X(E_STH, "e_sth") \
+	X(E_LBZU, "e_lbzu") \
+	X(E_LHZU, "e_lhzu") \
+	X(E_LWZU, "e_lwzu") \
+	X(E_LHAU, "e_lhau") \
+	X(E_STBU, "e_stbu") \
+	X(E_STHU, "e_sthu") \
+	X(E_STWU, "e_stwu") \
+	X(E_LMW, "e_lmw") \
+	X(E_STMW, "e_stmw") \
+	X(E_ADDI, "e_addi") \
+	X(E_ADDIC, "e_addic") \
+	X(E_MULLI, "e_mulli") \
+	X(E_SUBFIC, "e_subfic") \
+	X(E_ANDI, "e_andi") \
+	X(E_ORI, "e_ori") \
+	X(E_XORI, "e_xori") \
+	X(E_CMPI, "e_cmpi") \
+	X(E_CMPLI, "e_cmpli") \
+	X(E_LI, "e_li") \
+	X(E_ADD2I, "e_add2i.") \
+	X(E_ADD2IS, "e_add2is") \
+	X(E_CMP16I, "e_cmp16i") \
+	X(E_MULL2I, "e_mull2i") \
+	X(E_CMPL16I, "e_cmpl16i") \
+	X(E_CMPH16I, "e_cmph16i") \
+	X(E_CMPHL16I, "e_cmphl16i") \
+	X(E_OR2I, "e_or2i") \
+	X(E_AND2I, "e_and2i.") \
+	X(E_OR2IS, "e_or2is") \
+	X(E_LIS, "e_lis") \
+	X(E_AND2IS, "e_and2is.") \
+	X(E_RLWIMI, "e_rlwimi") \
+	X(E_RLWINM, "e_rlwinm") \
+	X(E_B, "e_b") \
+	X(E_BC, "e_bc") \
+	X(E_CMPH, "e_cmph") \
+	X(E_CMPHL, "e_cmphl") \
+	X(E_MCRF, "e_mcrf") \
+	X(E_CRAND, "e_crand") \
+	X(E_CRANDC, "e_crandc") \
+	X(E_CRNAND, "e_crnand") \
+	X(E_CROR, "e_cror") \
+	X(E_CRORC, "e_crorc") \
+	X(E_CRNOR, "e_crnor") \
+	X(E_CREQV, "e_creqv") \
+	X(E_CRXOR, "e_crxor") \
+	X(E_RLW, "e_rlw") \
+	X(E_RLWI, "e_rlwi") \
+	X(E_SLWI, "e_slwi") \
+	X(E_SRWI, "e_srwi") \
+	X(E_SC, "e_sc")
+
+enum vle_insn_id {
+	#define VLE_ENUM(id, name) VLE_INS_##id,
+	VLE_INSTRUCTIONS(VLE_ENUM)
+	#undef VLE_ENUM
+	VLE_INS_ENDING
+};
+
+enum vle_op_type {
+	VLE_OP_INVALID = 0,
+	VLE_OP_REG,   /* reg: PPC_REG_XXX (gpr or crN) */
+	VLE_OP_IMM,   /* imm: already scaled/extended */
+	VLE_OP_MEM,   /* mem.base + mem.disp */
+	VLE_OP_CRBIT, /* crbit: 0..31, same numbering as IL_FLAG_XXX */
+	VLE_OP_LABEL  /* label: absolute branch target */
+};
+
+struct vle_op {
+	enum vle_op_type type;
+	union {
+		uint32_t reg;
+		int32_t imm;
+		struct {
+			uint32_t base;
+			int32_t disp;
+		} mem;
+		uint32_t crbit;
+		uint32_t label;
+	};
+};
+
+struct vle_insn {
+	uint32_t id;      /* VLE_INS_XXX */
+	uint32_t size;    /* 2 or 4 */
+	uint32_t insword; /* 16-bit forms occupy the low halfword */
+
+	bool rc;          /* record form, updates cr0 */
+	bool lk;          /* branch and link */
+
+	/* conditional branches (se_bc, e_bc) are normalized to the classic BO/BI
+		encoding so they can share the regular branch lifting */
+	uint8_t bo;
+	uint8_t bi;
+
+	uint8_t op_count;
+	struct vle_op operands[5];
+};
+
+extern "C" int vle_decompose(const uint8_t *data, size_t size, uint32_t addr,
+	bool lil_end, struct vle_insn *result);
+extern "C" int vle_mnemonic(const struct vle_insn *insn, char *buf, size_t len);